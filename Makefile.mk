@@ -32,7 +32,8 @@ YYINCLUDEFILE=$(YACCFILE:.y=.tab.h)
 YYPREFIX=$(basename $(YACCFILE))
 
 ASMCFILES=asm_main.c gen_asm.c
-SIMCFILES=sim_main.c gen_sim.c
+SIMCFILES=sim_main.c sim_sampling.c gen_sim.c jit_x86_64.c sim_cache.c sim_branch.c sim_pipeline.c sim_calls.c
+BATCHCFILES=batch_main.c gen_sim.c jit_x86_64.c sim_cache.c sim_branch.c sim_pipeline.c sim_calls.c
 
 SHCFILES=libasm_sparc_v8.c libsim_sparc_v8.c \
 libasm_sparc_v8-blockicc-movcc.c libsim_sparc_v8-blockicc-movcc.c \
@@ -3,11 +3,20 @@
 echo "Number of bytes:";
 head -n 1 $1 | sed "s/\(Contents of instruction memory (\)\([0-9]*\)\( bytes):.*\)/\2/g";
 
-echo "Max cycles:";
-egrep "Current" $1 | sed s/"Current simulated cycles: "//g | awk 'max=="" || $1 > max {max=$1} END{ print max}' FS=".";
+# logs simulated with --cycle-stats contain a summary of all regions
+if egrep -q "^all " $1; then
+	echo "Max cycles:";
+	egrep "^all " $1 | awk '{ print $9 }';
 
-echo "Min cycles:";
-egrep "Current" $1 | sed s/"Current simulated cycles: "//g | awk 'min=="" || $1 < min {min=$1} END{ print min}' FS=".";
+	echo "Min cycles:";
+	egrep "^all " $1 | awk '{ print $4 }';
+else
+	echo "Max cycles:";
+	egrep "Current" $1 | sed s/"Current simulated cycles: "//g | awk 'max=="" || $1 > max {max=$1} END{ print max}' FS=".";
+
+	echo "Min cycles:";
+	egrep "Current" $1 | sed s/"Current simulated cycles: "//g | awk 'min=="" || $1 < min {min=$1} END{ print min}' FS=".";
+fi
 
 tail -n 2 $1;
 
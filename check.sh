@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# SPARC V8 Instruction Set Extension Simulator
+#                                                                               
+# File: check.sh
+#                                                                               
+# Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+# 
+# Permission is hereby granted, free of charge, to any person obtaining a copy 
+# of this software and associated documentation files (the "Software"), to 
+# deal in the Software without restriction, including without limitation the 
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#                                                                               
+# The above copyright notice and this permission notice shall be included in 
+# all copies or substantial portions of the Software.
+#                                                                               
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+# THE SOFTWARE.
+#
+# Simulates the given binary with the reference interpreter, the default
+# engine, the JIT, the checked JIT, from a restored snapshot and after a
+# fast-forward, and compares the output of every run with the reference
+# interpreter. Only the simulated cycles may differ after the fast-forward.
+# Must be called from the top directory.
+# Usage: ./check.sh <binfile> <target> <logprefix>
+#
+
+SIM=${SIM:-./simulator}
+FORWARD=${FORWARD:-i100}
+
+if [ $# -ne 3 ]; then
+	echo "Usage: $0 <binfile> <target> <logprefix>"
+	exit 1
+fi
+bin=$1
+target=$2
+out=$3
+
+$SIM -i $bin -t $target -o $out.reference -r &&
+$SIM -i $bin -t $target -o $out.default -S $out.snapshot &&
+$SIM -i $bin -t $target -o $out.jit -j &&
+$SIM -i $bin -t $target -o $out.check -d &&
+$SIM -i $bin -t $target -o $out.restore -L $out.snapshot &&
+$SIM -i $bin -t $target -o $out.forward -F $FORWARD || exit 1
+
+grep -v "imulated cycles" $out.reference > $out.expected
+grep -v "imulated cycles" $out.forward > $out.actual
+
+for run in default jit check restore forward; do
+	if [ $run = forward ]; then
+		diff $out.expected $out.actual > $out.diff
+	else
+		diff $out.reference $out.$run > $out.diff
+	fi
+	if [ $? -ne 0 ]; then
+		echo "$bin differs from the reference with '$run', see $out.diff"
+		exit 1
+	fi
+done
+
+rm -f $out.reference $out.default $out.jit $out.check $out.restore $out.forward \
+	$out.snapshot $out.expected $out.actual $out.diff
@@ -0,0 +1,83 @@
+! Control transfers in delay slots, leaf calls, deep
+! recursion and the less common loads and stores.
+	.file	"check_calls_v8.s"
+	.text
+	.globl	main
+	.align	4
+	.type	main,@function
+main:
+	save	%sp, -96, %sp
+	or	%g0, 0, %l0
+	or	%g0, 5, %l3
+.again:
+	ba	.first
+	ba	.second
+	add	%l0, 1000, %l0
+.first:
+	add	%l0, 1, %l0
+	add	%l0, 100, %l0
+.second:
+	add	%l0, 10, %l0
+	sim-printcycles
+	add	%l0, 3, %l0
+	subcc	%l3, 1, %l3
+	bne	.again
+	sll	%l0, 1, %l0
+	subcc	%g0, 1, %g0
+	be	.third
+	add	%l0, 7, %l0
+.third:
+	ba	.fourth
+	call	leaf
+	add	%l0, 2000, %l0
+.fourth:
+	add	%l0, 5, %l0
+	call	deep
+	or	%g0, 12, %o0
+	add	%l0, %o0, %l0
+	sethi	%hi(cells), %l1
+	or	%l1, %lo(cells), %l1
+	or	%g0, %l0, %o1
+	swap	[%l1], %o1
+	ldstub	[%l1+5], %o2
+	add	%o1, %o2, %o1
+	ld	[%l1], %o3
+	ldub	[%l1+5], %o4
+	add	%o3, %o4, %o3
+	xor	%o1, %o3, %o1
+	wr	%o1, 3, %y
+	mulscc	%o1, %o3, %o5
+	rd	%y, %o4
+	add	%o5, %o4, %o5
+	st	%o5, [%l1+8]
+	add	%l0, %o5, %i0
+	jmp	%i7+8
+	restore	%g0, %g0, %g0
+
+	.globl	leaf
+	.type	leaf,@function
+leaf:
+	jmp	%o7+8
+	add	%l0, 50, %l0
+
+	.globl	deep
+	.type	deep,@function
+deep:
+	save	%sp, -96, %sp
+	orcc	%i0, 0, %l0
+	be	.deep_done
+	add	%g0, 1, %i0
+	call	deep
+	sub	%l0, 1, %o0
+	smul	%o0, 3, %o0
+	add	%o0, %l0, %i0
+.deep_done:
+	jmp	%i7+8
+	restore	%g0, %g0, %g0
+
+	.data
+	.align	4
+cells:
+	.word	305419896
+	.word	-559038737
+	.word	0
@@ -0,0 +1,125 @@
+! Sums, scales and copies an array, computes a gcd and a recursive
+! factorial, and accesses bytes and halfwords of the data memory.
+	.file	"check_loops_v8.s"
+	.text
+	.globl	main
+	.align	4
+	.type	main,@function
+main:
+	save	%sp, -96, %sp
+	sethi	%hi(array), %l0
+	or	%l0, %lo(array), %l0
+	or	%g0, 0, %l1
+	or	%g0, 0, %l2
+	sim-clearcycles
+.sum:
+	sll	%l2, 2, %l3
+	ld	[%l0+%l3], %l4
+	add	%l1, %l4, %l1
+	add	%l2, 1, %l2
+	subcc	%l2, 16, %g0
+	bl	.sum
+	nop
+	sim-printcycles
+	sethi	%hi(copy), %l5
+	or	%l5, %lo(copy), %l5
+	or	%g0, 0, %l2
+.scale:
+	ld	[%l0], %l4
+	smul	%l4, -3, %l4
+	sra	%l4, 1, %l4
+	st	%l4, [%l5]
+	add	%l0, 4, %l0
+	add	%l5, 4, %l5
+	add	%l2, 1, %l2
+	subcc	%l2, 16, %g0
+	bne	.scale
+	nop
+	sim-printcycles
+	sethi	%hi(bytes), %l6
+	or	%l6, %lo(bytes), %l6
+	ldub	[%l6+1], %o0
+	ldsb	[%l6+2], %o1
+	lduh	[%l6+2], %o2
+	ldsh	[%l6], %o3
+	stb	%o1, [%l6+3]
+	sth	%o0, [%l6+4]
+	add	%o0, %o1, %o0
+	xor	%o0, %o2, %o0
+	call	gcd
+	or	%g0, 1071, %o1
+	add	%l1, %o0, %l1
+	call	fact
+	or	%g0, 9, %o0
+	wr	%g0, 0, %y
+	udiv	%o0, 7, %o1
+	umul	%o1, 7, %o2
+	sub	%o0, %o2, %o2
+	add	%l1, %o2, %l1
+	sim-printcycles
+	or	%g0, %l1, %i0
+	jmp	%i7+8
+	restore	%g0, %g0, %g0
+
+	.globl	gcd
+	.type	gcd,@function
+gcd:
+	subcc	%o1, 0, %g0
+	be	.gcd_done
+	nop
+.gcd_loop:
+	wr	%g0, 0, %y
+	udiv	%o0, %o1, %o2
+	umul	%o2, %o1, %o2
+	sub	%o0, %o2, %o2
+	or	%g0, %o1, %o0
+	orcc	%g0, %o2, %o1
+	bne	.gcd_loop
+	nop
+.gcd_done:
+	jmp	%o7+8
+	nop
+
+	.globl	fact
+	.type	fact,@function
+fact:
+	save	%sp, -96, %sp
+	subcc	%i0, 1, %g0
+	ble	.fact_done
+	or	%g0, 1, %l0
+	call	fact
+	sub	%i0, 1, %o0
+	smul	%o0, %i0, %l0
+.fact_done:
+	or	%g0, %l0, %i0
+	jmp	%i7+8
+	restore	%g0, %g0, %g0
+
+	.data
+	.align	4
+array:
+	.word	3
+	.word	-7
+	.word	12
+	.word	5
+	.word	100
+	.word	-42
+	.word	8
+	.word	1
+	.word	0
+	.word	77
+	.word	-1
+	.word	2048
+	.word	9
+	.word	-300
+	.word	15
+	.word	6
+copy:
+	.skip	64
+bytes:
+	.byte	-3
+	.byte	200
+	.byte	-128
+	.byte	17
+	.half	0
+	.half	0
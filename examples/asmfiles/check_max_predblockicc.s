@@ -0,0 +1,65 @@
+! Maximum and sum of the negative elements of an array in a hardware
+! loop with conditional selects and predicated blocks.
+	.file	"check_max_predblockicc.s"
+	.text
+	.globl	main
+	.align	4
+	.type	main,@function
+main:
+	save	%sp, -96, %sp
+	sethi	%hi(array), %l0
+	or	%l0, %lo(array), %l0
+	or	%g0, 0, %l1
+	or	%g0, 0, %l7
+	sim-clearcycles
+	hwloop init .loop, %loops
+	hwloop init .loop_end, %loope
+	hwloop init 12, %loopb
+	hwloop start
+.loop:
+	ld	[%l0], %l2
+	subcc	%l2, %l1, %g0
+	sel	[g] %l2, %l1, %l1
+	sel	[l] %l2, -7, %o1
+	add	%l7, %o1, %l7
+	sel	[ge] 5, -6, %o2
+	add	%l7, %o2, %l7
+	subcc	%l2, 0, %g0
+	predbegin	[l]
+	add	%l7, %l2, %l7
+	st	%l7, [%l0]
+	addcc	%l7, 0, %g0
+	predend
+	add	%l0, 4, %l0
+.loop_end:
+	sim-printcycles
+	or	%g0, 7, %o3
+	hwloop init .scale, %loops
+	hwloop init .scale_end, %loope
+	hwloop init %o3, %loopb
+	hwloop start
+.scale:
+	add	%l7, 3, %l7
+	sll	%l7, 1, %l7
+.scale_end:
+	sim-printcycles
+	sll	%l1, 16, %l1
+	add	%l1, %l7, %i0
+	jmp	%i7+8
+	restore	%g0, %g0, %g0
+
+	.data
+	.align	4
+array:
+	.word	3
+	.word	-1
+	.word	4
+	.word	-1
+	.word	5
+	.word	-9
+	.word	2
+	.word	6
+	.word	5
+	.word	-3
+	.word	58
+	.word	-97
@@ -0,0 +1,908 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/gen_sim_core.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+/*
+ * Core of the threaded code engine, which is included by gen_sim.c once
+ * per target feature set. CORE_NAME names the generated core function,
+ * CORE_FEATURES is the mask of enabled TARGET_FEATURE_* bits. Handlers of
+ * disabled features fall back to stepInstruction(), and neither the hardware
+ * loop nor the predication state is checked per instruction, if the 
+ * target cannot enable them. If CORE_MODELS is 1, the core accesses the
+ * instruction and data cache models, the branch predictor and the 
+ * pipeline model (see readTimingModel()).
+ */
+
+#if !defined(CORE_NAME) || !defined(CORE_FEATURES)
+#error "CORE_NAME and CORE_FEATURES have to be defined!"
+#endif
+
+#ifndef CORE_MODELS
+#define CORE_MODELS 0
+#endif
+
+/** Whether the core supports a feature of the target */
+#define CORE_HAS(feature) (((CORE_FEATURES) & (feature)) != 0)
+
+/** Register contents of the current window */
+#define REG(r) SPARC_REGISTER(r)
+
+/** Whether the current instruction is not disabled by predication */
+#if CORE_HAS(TARGET_FEATURE_PRED_ICC) && CORE_HAS(TARGET_FEATURE_PRED_PREG)
+#define THREADED_EXECUTED() \
+	(context->pred_state.predicate_state == PREDICATE_STATE_NONE || evaluatePredState(context))
+#elif CORE_HAS(TARGET_FEATURE_PRED_ICC)
+#define THREADED_EXECUTED() \
+	(context->pred_state.predicate_state == PREDICATE_STATE_NONE || \
+		evaluateICC(context, context->pred_state.predicate_condition.icc))
+#elif CORE_HAS(TARGET_FEATURE_PRED_PREG)
+#define THREADED_EXECUTED() \
+	(context->pred_state.predicate_state == PREDICATE_STATE_NONE || \
+		evaluatePred(context, context->pred_state.predicate_condition.preg_condition.preg, \
+			context->pred_state.predicate_condition.preg_condition.tf))
+#else
+#define THREADED_EXECUTED() 1
+#endif
+
+/** Writes the destination register if the instruction is executed */
+#define THREADED_WRITE_RD(value) \
+	if (THREADED_EXECUTED() && ip->rd) { \
+		REG(ip->rd) = (value); \
+	}
+
+/** 
+  * Writes destination register and records the icc setting operation 
+  * on src1 and src2 if the instruction is executed 
+  */
+#define THREADED_WRITE_RD_ICC(value, op) \
+	if (THREADED_EXECUTED()) { \
+		if (ip->rd) { \
+			REG(ip->rd) = (value); \
+		} \
+		setLazyICC(context, (op), src1, src2, (value)); \
+	}
+
+/**
+  * Advances the program counters exactly as the reference interpreter,
+  * including the branch back at the end of an active hardware loop.
+  */
+#if CORE_HAS(TARGET_FEATURE_HWLOOP)
+#define THREADED_NEXT_PC() \
+	cur_pc = pc; \
+	pc = npc; \
+	npc++; \
+	if (context->hwloop_state.hwloop_state == HWLOOP_STATE_ACTIVE && \
+		npc == context->hwloop_state.end_address) { \
+		(context->hwloop_state.loop_counter)--; \
+		if (context->hwloop_state.loop_counter > 0) { \
+			npc = context->hwloop_state.start_address; \
+		} else { \
+			context->hwloop_state.hwloop_state = HWLOOP_STATE_IDLE; \
+		} \
+	}
+#else
+#define THREADED_NEXT_PC() \
+	cur_pc = pc; \
+	pc = npc; \
+	npc++;
+#endif
+
+/** Whether compiled blocks may be executed in the current state */
+#if CORE_HAS(TARGET_FEATURE_HWLOOP) || CORE_HAS(TARGET_FEATURE_PRED_ICC) || \
+	CORE_HAS(TARGET_FEATURE_PRED_PREG)
+#define THREADED_NATIVE_ALLOWED() \
+	(context->hwloop_state.hwloop_state == HWLOOP_STATE_IDLE && \
+		context->pred_state.predicate_state == PREDICATE_STATE_NONE)
+#else
+#define THREADED_NATIVE_ALLOWED() 1
+#endif
+
+/** Accesses the data cache for the memory address of an executed load/store */
+#if CORE_MODELS
+#define THREADED_DATA_ACCESS() \
+	if (THREADED_EXECUTED()) { \
+		accessDataCache(context, address); \
+	}
+#else
+#define THREADED_DATA_ACCESS()
+#endif
+
+/** 
+  * Enters an executed store into the store buffer, the cycles of the 
+  * block after the store have already been charged 
+  */
+#if CORE_MODELS
+#define THREADED_STORE() \
+	if (context->pipeline.store_entries && THREADED_EXECUTED()) { \
+		chargeStore(context, block->cycles - block->offsets[ip - block->code]); \
+	}
+#else
+#define THREADED_STORE()
+#endif
+
+/** Predicts the conditional branch at cur_pc to ip->imm */
+#if CORE_MODELS
+#define THREADED_PREDICT_BRANCH(taken) \
+	predictBranch(context, cur_pc, ip->imm, (taken))
+#else
+#define THREADED_PREDICT_BRANCH(taken)
+#endif
+
+/** Jumps to the handler of the next instruction within the block */
+#define THREADED_NEXT() \
+	ip++; \
+	goto *(ip->handler)
+
+/** 
+  * Defines register and immediate form of an instruction with operands 
+  * rd, rs1 and rs2/simm13. The body works on src1 and src2.
+  */
+#define THREADED_FORM_HANDLERS(name, ...) \
+	L_##name##_R: \
+		src1 = REG(ip->rs1); \
+		src2 = REG(ip->rs2); \
+		THREADED_NEXT_PC(); \
+		__VA_ARGS__ \
+		THREADED_NEXT(); \
+	L_##name##_I: \
+		src1 = REG(ip->rs1); \
+		src2 = ip->imm; \
+		THREADED_NEXT_PC(); \
+		__VA_ARGS__ \
+		THREADED_NEXT();
+
+/**
+  * @brief Threaded code engine specialized for CORE_FEATURES, see run().
+  */
+static int CORE_NAME(sim_context_t* context, FILE* outstream, uint32_t max_steps, 
+		uint32_t stop_mask) {
+
+	/* handler addresses, indexed by the handler identifiers */
+#define THREADED_LABEL(name) &&L_##name,
+	static void* const handlers[THREADED_NUM_HANDLERS] = {
+		THREADED_HANDLERS(THREADED_LABEL)
+	};
+#undef THREADED_LABEL
+
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+
+	/* program counters are kept local during simulation */
+	uint32_t pc = context->pc;
+	uint32_t npc = context->npc;
+	uint32_t cur_pc = pc;
+
+	/* current block and pre-decoded instruction */
+	threaded_block_t* block;
+	threaded_block_t* next;
+	const threaded_instruction_t* ip;
+
+	/* source operands, result and memory address of current instruction */
+	uint32_t src1;
+	uint32_t src2;
+	uint32_t result;
+	uint32_t address;
+	uint32_t icc;
+
+	/* for multiplication and division */
+	uint64_t tmp_udivmul_result;
+	int64_t tmp_sdivmul_result;
+
+	/* executed instructions and reason for stopping */
+	uint32_t steps = 0;
+	uint32_t first = pc;
+	int reason = RUN_EXIT;
+
+	if (!context->threaded_code) {
+		buildThreadedCode(context, handlers);
+	}
+
+	context->run_events = 0;
+	if (!(context->run_num_breakpoints)) {
+		stop_mask &= ~RUN_BREAKPOINT;
+	}
+
+	if (pc >= number_instructions) {
+		goto leave;
+	}
+	block = lookupBlock(context, pc, npc, handlers);
+
+	/* enter block and charge all of its cycles */
+	enter:
+		/* blocks which would cross the step budget or a breakpoint are 
+		   executed instruction by instruction */
+		if ((max_steps && max_steps - steps < block->length) ||
+			((stop_mask & RUN_BREAKPOINT) && hasBreakpoint(context, block->start, block->length))) {
+			goto step;
+		}
+		context->fault_start = block->start;
+		context->fault_length = block->length;
+		steps += block->length;
+		if (context->block_counts) {
+			context->block_counts[block->start] += block->length;
+		}
+		if (context->profile_entries) {
+			profileBlock(context, block->start, block->length);
+		}
+		if (context->calls.nodes) {
+			traceCalls(context, block->start, block->length);
+		}
+		context->cycle_counter += block->cycles;
+		context->cycle_counter_local += block->cycles;
+		context->instruction_counter += block->instructions;
+#if CORE_MODELS
+		if (context->icache.tags) {
+			fetchInstructions(context, block->start, block->length);
+		}
+		if (context->pipeline.enabled) {
+			chargeStalls(context, context->pipeline.last, block->start);
+			context->pipeline.last = block->start + block->length - 1;
+			context->pipeline.stats.load_use += block->load_use_stalls;
+			context->pipeline.stats.control += block->control_stalls;
+		}
+#endif
+		if (block->native) {
+			/* compiled blocks neither handle hardware loops nor predication */
+			if (THREADED_NATIVE_ALLOWED()) {
+				if (context->jit_mode != JIT_MODE_CHECK) {
+					pc = block->native();
+					npc = pc + 1;
+					goto L_BLOCK_END;
+				}
+				/* run compiled block, then the same block by the handlers */
+				saveCheckState(context, &context->jit_check_before);
+				context->jit_check_pc = block->native();
+				saveCheckState(context, &context->jit_check_after);
+				restoreCheckState(context, &context->jit_check_before);
+				context->jit_check_block = block;
+			}
+		} else if (context->jit_mode != JIT_MODE_OFF && context->threaded_blocks[block->start] == block &&
+			++(block->executions) == JIT_HOT_THRESHOLD) {
+			/* single instruction blocks are not compiled, as they are 
+			   entered with npc != pc + 1 */
+			block->native = compileBlock(context, block);
+		}
+		ip = block->code;
+		goto *(ip->handler);
+
+	/* follow the chained successors, if possible */
+	L_BLOCK_END:
+		if (context->jit_check_block) {
+			checkCompiledBlock(context, pc, npc);
+			context->jit_check_block = 0;
+		}
+		if (pc >= number_instructions) {
+			goto leave;
+		}
+		if (context->run_events & stop_mask) {
+			reason = context->run_events & stop_mask;
+			goto stop;
+		}
+		if (npc == pc + 1) {
+			if (block->fallthrough && block->fallthrough->start == pc) {
+				block = block->fallthrough;
+				goto enter;
+			}
+			if (block->taken && block->taken->start == pc) {
+				block = block->taken;
+				goto enter;
+			}
+			next = lookupBlock(context, pc, npc, handlers);
+			if (pc == block->start + block->length) {
+				block->fallthrough = next;
+			} else {
+				block->taken = next;
+			}
+			block = next;
+			goto enter;
+		}
+		block = lookupBlock(context, pc, npc, handlers);
+		goto enter;
+
+	/* execute a single instruction by the interpreter */
+	step:
+		if ((stop_mask & RUN_BREAKPOINT) && context->run_breakpoints[pc] && 
+			!(steps == 0 && pc == first)) {
+			reason = RUN_BREAKPOINT;
+			goto stop;
+		}
+		if (max_steps && steps == max_steps) {
+			reason = RUN_STEPS;
+			goto stop;
+		}
+		if (context->block_counts) {
+			context->block_counts[pc]++;
+		}
+		context->pc = pc;
+		context->npc = npc;
+		simulateInstruction(context, outstream);
+		pc = context->pc;
+		npc = context->npc;
+		steps++;
+		if (pc >= number_instructions) {
+			goto leave;
+		}
+		if (context->run_events & stop_mask) {
+			reason = context->run_events & stop_mask;
+			goto stop;
+		}
+		block = lookupBlock(context, pc, npc, handlers);
+		goto enter;
+
+	/* instructions without specialized handler */
+	L_FALLBACK:
+		context->pc = pc;
+		context->npc = npc;
+#if CORE_MODELS
+		/* the instruction has been fetched with its block */
+		if (block->offsets) {
+			context->pipeline.ahead = block->cycles - block->offsets[ip - block->code];
+		}
+		executeInstruction(context, outstream);
+		context->pipeline.ahead = 0;
+#else
+		stepInstruction(context, outstream);
+#endif
+		pc = context->pc;
+		npc = context->npc;
+		THREADED_NEXT();
+
+	L_NOP:
+		THREADED_NEXT_PC();
+		THREADED_NEXT();
+
+	L_SETHI:
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(ip->imm);
+		THREADED_NEXT();
+
+	/* control transfer instructions do not depend on predication */
+	L_CALL:
+		THREADED_NEXT_PC();
+		npc = ip->imm;
+		REG(CALL_ADDR_REGISTER) = (cur_pc << 2);
+		THREADED_NEXT();
+
+	L_BA:
+		THREADED_NEXT_PC();
+		npc = ip->imm;
+		THREADED_NEXT();
+
+	L_BN:
+		THREADED_NEXT_PC();
+		THREADED_NEXT();
+
+	L_BICC:
+		THREADED_NEXT_PC();
+		if (evaluateICC(context, ip->icc)) {
+			npc = ip->imm;
+			THREADED_PREDICT_BRANCH(1);
+		} else {
+			THREADED_PREDICT_BRANCH(0);
+		}
+		THREADED_NEXT();
+
+	/* meta instructions do not need any cycles */
+	L_CYCLE_PRINT:
+		THREADED_NEXT_PC();
+		closeRegion(context, cur_pc, outstream);
+		THREADED_NEXT();
+
+	L_CYCLE_CLEAR:
+		THREADED_NEXT_PC();
+		openRegion(context, cur_pc);
+		context->run_events |= RUN_CYCLE_CLEAR;
+		THREADED_NEXT();
+
+	L_RD_Y:
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(context->y);
+		THREADED_NEXT();
+
+	/* instructions of features which are not enabled by the target 
+	   are executed by stepInstruction(context) */
+#if CORE_HAS(TARGET_FEATURE_MOVCC)
+	L_MOV:
+		THREADED_NEXT_PC();
+		result = evaluateICC(context, ip->icc) ? REG(ip->rs1) : REG(ip->rd);
+		THREADED_WRITE_RD(result);
+		THREADED_NEXT();
+#else
+	L_MOV:
+		goto L_FALLBACK;
+#endif
+
+#if CORE_HAS(TARGET_FEATURE_SELCC)
+	L_SEL_RR:
+		THREADED_NEXT_PC();
+		result = evaluateICC(context, ip->icc) ? REG(ip->rs1) : REG(ip->rs2);
+		THREADED_WRITE_RD(result);
+		THREADED_NEXT();
+
+	L_SEL_RI:
+		THREADED_NEXT_PC();
+		result = evaluateICC(context, ip->icc) ? REG(ip->rs1) : ip->imm;
+		THREADED_WRITE_RD(result);
+		THREADED_NEXT();
+
+	L_SEL_II:
+		THREADED_NEXT_PC();
+		result = evaluateICC(context, ip->icc) ? ip->imm : (uint32_t) ((int8_t) ip->rs2);
+		THREADED_WRITE_RD(result);
+		THREADED_NEXT();
+#else
+	L_SEL_RR:
+	L_SEL_RI:
+	L_SEL_II:
+		goto L_FALLBACK;
+#endif
+
+	/* hardware loop and predication instructions do not depend on predication */
+#if CORE_HAS(TARGET_FEATURE_HWLOOP)
+	L_HWLOOP_S:
+		THREADED_NEXT_PC();
+		context->hwloop_state.start_address = ip->imm;
+		THREADED_NEXT();
+
+	L_HWLOOP_E:
+		THREADED_NEXT_PC();
+		context->hwloop_state.end_address = ip->imm;
+		THREADED_NEXT();
+
+	L_HWLOOP_B_R:
+		THREADED_NEXT_PC();
+		context->hwloop_state.loop_counter = REG(ip->rs1);
+		THREADED_NEXT();
+
+	L_HWLOOP_B_I:
+		THREADED_NEXT_PC();
+		context->hwloop_state.loop_counter = ip->imm;
+		THREADED_NEXT();
+
+	L_HWLOOP_START:
+		THREADED_NEXT_PC();
+		context->hwloop_state.hwloop_state = HWLOOP_STATE_ACTIVE;
+		THREADED_NEXT();
+#else
+	L_HWLOOP_S:
+	L_HWLOOP_E:
+	L_HWLOOP_B_R:
+	L_HWLOOP_B_I:
+	L_HWLOOP_START:
+		goto L_FALLBACK;
+#endif
+
+#if CORE_HAS(TARGET_FEATURE_PRED_ICC)
+	L_PREDBEGIN_ICC:
+		THREADED_NEXT_PC();
+		context->pred_state.predicate_state = PREDICATE_STATE_ICC;
+		context->pred_state.predicate_condition.icc = ip->icc;
+		THREADED_NEXT();
+#else
+	L_PREDBEGIN_ICC:
+		goto L_FALLBACK;
+#endif
+
+#if CORE_HAS(TARGET_FEATURE_PRED_ICC) || CORE_HAS(TARGET_FEATURE_PRED_PREG)
+	L_PREDEND:
+		THREADED_NEXT_PC();
+		context->pred_state.predicate_state = PREDICATE_STATE_NONE;
+		THREADED_NEXT();
+#else
+	L_PREDEND:
+		goto L_FALLBACK;
+#endif
+
+#if CORE_HAS(TARGET_FEATURE_PRED_PREG)
+	L_PREDBEGIN_PREG:
+		THREADED_NEXT_PC();
+		context->pred_state.predicate_state = PREDICATE_STATE_PREG;
+		context->pred_state.predicate_condition.preg_condition.preg = ip->rs1;
+		context->pred_state.predicate_condition.preg_condition.tf = ip->rs2;
+		THREADED_NEXT();
+
+	L_PREDSET:
+		THREADED_NEXT_PC();
+		if (THREADED_EXECUTED()) {
+			context->preg |= (1<<(2*ip->rd));
+			context->preg |= (1<<(2*ip->rd + 1));
+		}
+		THREADED_NEXT();
+
+	L_PREDSET_ICC:
+		THREADED_NEXT_PC();
+		result = evaluateICC(context, ip->icc);
+		if (THREADED_EXECUTED()) {
+			if (result) {
+				context->preg &= ~(1<<(2*ip->rd));
+				context->preg |= (1<<(2*ip->rd + 1));
+			} else {
+				context->preg &= ~(1<<(2*ip->rd + 1));
+				context->preg |= (1<<(2*ip->rd));
+			}
+		}
+		THREADED_NEXT();
+
+	L_PREDCLEAR:
+		THREADED_NEXT_PC();
+		if (THREADED_EXECUTED()) {
+			context->preg &= ~(1<<(2*ip->rd));
+			context->preg &= ~(1<<(2*ip->rd + 1));
+		}
+		THREADED_NEXT();
+#else
+	L_PREDBEGIN_PREG:
+	L_PREDSET:
+	L_PREDSET_ICC:
+	L_PREDCLEAR:
+		goto L_FALLBACK;
+#endif
+
+	/* logic instructions */
+	THREADED_FORM_HANDLERS(AND,
+		THREADED_WRITE_RD(src1 & src2);
+	)
+	THREADED_FORM_HANDLERS(ANDCC,
+		result = src1 & src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(ANDN,
+		THREADED_WRITE_RD(~(src1 & src2));
+	)
+	THREADED_FORM_HANDLERS(ANDNCC,
+		result = ~(src1 & src2);
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(OR,
+		THREADED_WRITE_RD(src1 | src2);
+	)
+	THREADED_FORM_HANDLERS(ORCC,
+		result = src1 | src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(ORN,
+		THREADED_WRITE_RD(~(src1 | src2));
+	)
+	THREADED_FORM_HANDLERS(ORNCC,
+		result = ~(src1 | src2);
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(XOR,
+		THREADED_WRITE_RD(src1 ^ src2);
+	)
+	THREADED_FORM_HANDLERS(XORCC,
+		result = src1 ^ src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(XNOR,
+		THREADED_WRITE_RD(~(src1 ^ src2));
+	)
+	THREADED_FORM_HANDLERS(XNORCC,
+		result = ~(src1 ^ src2);
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+
+	/* shift instructions */
+	THREADED_FORM_HANDLERS(SLL,
+		THREADED_WRITE_RD(src1 << src2);
+	)
+	THREADED_FORM_HANDLERS(SRL,
+		THREADED_WRITE_RD(src1 >> src2);
+	)
+	THREADED_FORM_HANDLERS(SRA,
+		THREADED_WRITE_RD(shiftRightArithmetic(src1, src2));
+	)
+
+	/* arithmetic instructions */
+	THREADED_FORM_HANDLERS(ADD,
+		THREADED_WRITE_RD(src1 + src2);
+	)
+	THREADED_FORM_HANDLERS(ADDCC,
+		result = src1 + src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_ADD);
+	)
+	THREADED_FORM_HANDLERS(ADDX,
+		materializeICC(context);
+		THREADED_WRITE_RD(src1 + src2 + PSR_GET_C(context->psr));
+	)
+	/* addxcc does not change the icc (as the reference interpreter) */
+	THREADED_FORM_HANDLERS(ADDXCC,
+		materializeICC(context);
+		THREADED_WRITE_RD(src1 + src2 + PSR_GET_C(context->psr));
+	)
+	THREADED_FORM_HANDLERS(SUB,
+		THREADED_WRITE_RD(src1 - src2);
+	)
+	THREADED_FORM_HANDLERS(SUBCC,
+		result = src1 - src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_SUB);
+	)
+	THREADED_FORM_HANDLERS(SUBX,
+		materializeICC(context);
+		THREADED_WRITE_RD(src1 - src2 - PSR_GET_C(context->psr));
+	)
+	/* subxcc does not change the icc (as the reference interpreter) */
+	THREADED_FORM_HANDLERS(SUBXCC,
+		materializeICC(context);
+		THREADED_WRITE_RD(src1 - src2 - PSR_GET_C(context->psr));
+	)
+
+	/* multiply instructions */
+	THREADED_FORM_HANDLERS(UMUL,
+		tmp_udivmul_result = ((uint64_t) src1) * ((uint64_t) src2);
+		if (THREADED_EXECUTED()) {
+			if (ip->rd) {
+				REG(ip->rd) = (uint32_t) (tmp_udivmul_result & 0xffffffffL);
+			}
+			context->y = (uint32_t) ((tmp_udivmul_result >> 32) & 0xffffffffL);
+		}
+	)
+	THREADED_FORM_HANDLERS(UMULCC,
+		tmp_udivmul_result = ((uint64_t) src1) * ((uint64_t) src2);
+		result = (uint32_t) (tmp_udivmul_result & 0xffffffffL);
+		if (THREADED_EXECUTED()) {
+			context->y = (uint32_t) ((tmp_udivmul_result >> 32) & 0xffffffffL);
+		}
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(SMUL,
+		tmp_sdivmul_result = ((int64_t) src1) * ((int64_t) ((int32_t) src2));
+		if (THREADED_EXECUTED()) {
+			if (ip->rd) {
+				REG(ip->rd) = (uint32_t) (tmp_sdivmul_result & 0xffffffffL);
+			}
+			context->y = (uint32_t) ((tmp_sdivmul_result >> 32) & 0xffffffffL);
+		}
+	)
+	THREADED_FORM_HANDLERS(SMULCC,
+		tmp_sdivmul_result = ((int64_t) src1) * ((int64_t) ((int32_t) src2));
+		result = (uint32_t) (tmp_sdivmul_result & 0xffffffffL);
+		if (THREADED_EXECUTED()) {
+			context->y = (uint32_t) ((tmp_sdivmul_result >> 32) & 0xffffffffL);
+		}
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+
+	/* divide instructions */
+	THREADED_FORM_HANDLERS(UDIV,
+		tmp_udivmul_result = divideUnsigned(context, src1, src2);
+		THREADED_WRITE_RD((uint32_t) (tmp_udivmul_result & 0xffffffffL));
+	)
+	/* udivcc only sets N and Z (as the reference interpreter) */
+	THREADED_FORM_HANDLERS(UDIVCC,
+		tmp_udivmul_result = divideUnsigned(context, src1, src2);
+		result = (uint32_t) (tmp_udivmul_result & 0xffffffffL);
+		THREADED_WRITE_RD_ICC(result, ICC_OP_LOGIC);
+	)
+	THREADED_FORM_HANDLERS(SDIV,
+		tmp_sdivmul_result = divideSigned(context, src1, src2);
+		THREADED_WRITE_RD((uint32_t) (tmp_sdivmul_result & 0xffffffffL));
+	)
+	THREADED_FORM_HANDLERS(SDIVCC,
+		tmp_sdivmul_result = divideSigned(context, src1, src2);
+		result = (uint32_t) (tmp_sdivmul_result & 0xffffffffL);
+		if (THREADED_EXECUTED()) {
+			if (ip->rd) {
+				REG(ip->rd) = result;
+			}
+			/* overflow depends on the whole quotient => calculate icc directly */
+			icc = iccLogic(result);
+			if ((tmp_sdivmul_result & 0xffffffff00000000L) && 
+				((tmp_sdivmul_result >> 32) != 0xffffffffL)) {
+				PSR_SET_V(icc);
+			}
+			context->lazy_icc.op = ICC_OP_NONE;
+			PSR_CLR_ICCS(context->psr);
+			context->psr |= icc;
+		}
+	)
+
+	/* window instructions */
+	THREADED_FORM_HANDLERS(SAVE,
+		changeCWP(context, 0);
+		THREADED_WRITE_RD(src1 + src2);
+	)
+	THREADED_FORM_HANDLERS(RESTORE,
+		changeCWP(context, 1);
+		THREADED_WRITE_RD(src1 + src2);
+	)
+
+	THREADED_FORM_HANDLERS(JUMPL,
+		if (THREADED_EXECUTED()) {
+			npc = (src1 + src2) >> 2;
+			if (ip->rd) {
+				REG(ip->rd) = (cur_pc << 2);
+			}
+		}
+	)
+
+	THREADED_FORM_HANDLERS(WR,
+		if (THREADED_EXECUTED()) {
+			context->y = src1 ^ src2;
+		}
+	)
+
+	/* load instructions */
+	THREADED_FORM_HANDLERS(LDSB,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		if (THREADED_EXECUTED() && ip->rd) {
+			REG(ip->rd) = LOAD_SBYTE(address);
+		}
+	)
+	THREADED_FORM_HANDLERS(LDSH,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		if (THREADED_EXECUTED() && ip->rd) {
+			CHECK_ALIGNMENT(address, 0x00000001, 
+				"Unknown memory address for ldsh instruction!");
+			REG(ip->rd) = LOAD_SHALF(address);
+		}
+	)
+	THREADED_FORM_HANDLERS(LDUB,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		if (THREADED_EXECUTED() && ip->rd) {
+			REG(ip->rd) = LOAD_BYTE(address);
+		}
+	)
+	THREADED_FORM_HANDLERS(LDUH,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		if (THREADED_EXECUTED() && ip->rd) {
+			CHECK_ALIGNMENT(address, 0x00000001, 
+				"Unknown memory address for lduh instruction!");
+			REG(ip->rd) = LOAD_HALF(address);
+		}
+	)
+	THREADED_FORM_HANDLERS(LD,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		if (THREADED_EXECUTED() && ip->rd) {
+			CHECK_ALIGNMENT(address, 0x00000003, 
+				"Unknown memory address for ld instruction!");
+			REG(ip->rd) = LOAD_WORD(address);
+		}
+	)
+
+	/* store instructions */
+	THREADED_FORM_HANDLERS(STB,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		THREADED_STORE();
+		if (THREADED_EXECUTED()) {
+			STORE_BYTE(address, REG(ip->rd));
+		}
+	)
+	THREADED_FORM_HANDLERS(STH,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		THREADED_STORE();
+		if (THREADED_EXECUTED()) {
+			CHECK_ALIGNMENT(address, 0x00000001, 
+				"Unknown destination address for sth instruction!");
+			STORE_HALF(address, REG(ip->rd));
+		}
+	)
+	THREADED_FORM_HANDLERS(ST,
+		address = src1 + src2;
+		THREADED_DATA_ACCESS();
+		THREADED_STORE();
+		if (THREADED_EXECUTED()) {
+			CHECK_ALIGNMENT(address, 0x00000003, 
+				"Unknown destination address for st instruction!");
+			STORE_WORD(address, REG(ip->rd));
+		}
+	)
+
+	/* fused instruction pairs (see fuseInstructions()), the handler 
+	   executes the second instruction from the next entry */
+	L_SETHI_OR_I:
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(ip->imm);
+		ip++;
+		src1 = REG(ip->rs1);
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(src1 | ip->imm);
+		THREADED_NEXT();
+
+	L_SLL_I_ADD_R:
+		src1 = REG(ip->rs1);
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(src1 << ip->imm);
+		ip++;
+		src1 = REG(ip->rs1);
+		src2 = REG(ip->rs2);
+		THREADED_NEXT_PC();
+		THREADED_WRITE_RD(src1 + src2);
+		THREADED_NEXT();
+
+	L_SUBCC_R_BICC:
+		src1 = REG(ip->rs1);
+		src2 = REG(ip->rs2);
+		goto subcc_bicc;
+	L_SUBCC_I_BICC:
+		src1 = REG(ip->rs1);
+		src2 = ip->imm;
+	subcc_bicc:
+		THREADED_NEXT_PC();
+		result = src1 - src2;
+		THREADED_WRITE_RD_ICC(result, ICC_OP_SUB);
+		ip++;
+		THREADED_NEXT_PC();
+		if (evaluateICC(context, ip->icc)) {
+			npc = ip->imm;
+			THREADED_PREDICT_BRANCH(1);
+		} else {
+			THREADED_PREDICT_BRANCH(0);
+		}
+		THREADED_NEXT();
+
+	/* only fused for jmpl to %g0, i.e. the operands of restore can 
+	   be read in advance */
+	L_JUMPL_I_RESTORE_R:
+		src2 = REG(ip[1].rs2);
+		goto jumpl_restore;
+	L_JUMPL_I_RESTORE_I:
+		src2 = ip[1].imm;
+	jumpl_restore:
+		src1 = REG(ip->rs1);
+		THREADED_NEXT_PC();
+		if (THREADED_EXECUTED()) {
+			npc = (src1 + ip->imm) >> 2;
+		}
+		ip++;
+		src1 = REG(ip->rs1);
+		THREADED_NEXT_PC();
+		changeCWP(context, 1);
+		THREADED_WRITE_RD(src1 + src2);
+		THREADED_NEXT();
+
+	/* program counter left the instruction memory */
+	leave:
+		if (pc != (END_OF_INS_MEM>>2)) {
+			context->simulator->cleanUp(context);
+			simerror("Program counter outside of instruction memory!");
+		}
+	stop:
+		context->pc = pc;
+		context->npc = npc;
+		return reason;
+}
+
+#undef THREADED_FORM_HANDLERS
+#undef THREADED_NEXT
+#undef THREADED_DATA_ACCESS
+#undef THREADED_STORE
+#undef THREADED_PREDICT_BRANCH
+#undef THREADED_NEXT_PC
+#undef THREADED_NATIVE_ALLOWED
+#undef THREADED_WRITE_RD_ICC
+#undef THREADED_WRITE_RD
+#undef THREADED_EXECUTED
+#undef REG
+#undef CORE_HAS
+#undef CORE_MODELS
+#undef CORE_FEATURES
+#undef CORE_NAME
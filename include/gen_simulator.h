@@ -32,20 +32,137 @@
 
 #include "sparc_target.h"
 
+/** Modes of the just-in-time compiler for hot blocks */
+typedef enum {
+	JIT_MODE_OFF = 0,
+	JIT_MODE_ON,
+	/* compare every compiled block against the interpreter */
+	JIT_MODE_CHECK
+} jit_mode_t;
+
+/** Reasons for run() to return, also the bits of its stop mask */
+typedef enum {
+	/* the main function returned */
+	RUN_EXIT = (1<<0),
+	/* the given number of instructions has been executed */
+	RUN_STEPS = (1<<1),
+	/* a cycle print instruction has been executed */
+	RUN_CYCLE_PRINT = (1<<2),
+	/* the next instruction has a breakpoint */
+	RUN_BREAKPOINT = (1<<3),
+	/* a cycle clear instruction has been executed */
+	RUN_CYCLE_CLEAR = (1<<4)
+} run_reason_t;
+
 typedef struct {
 	uint16_t		target_id;
 	uint32_t		memory_size;
 	uint32_t		instruction_size;
 } simulator_header_t;
 
-typedef void (* void_fct_t)(void);
-typedef int (* boolean_fct_t)(void);
-typedef uint32_t (* size_fct_t)(void);
-typedef void (* read_file_fct_t)(FILE*);
-typedef void (* write_file_fct_t)(FILE*);
-typedef simulator_header_t* (* file_hdr_fct_t)(void);
-typedef sparc_instruction** (* get_paddr_fct_t)(void);
-typedef int (* sim_fct_t)(FILE*);
+/** 
+  * State of one simulation, which is opaque outside of the generic 
+  * simulator. All functions of gen_simulator_t work on a context, and
+  * independent contexts may be simulated concurrently.
+  */
+typedef struct sim_context sim_context_t;
+
+/** 
+  * Complete processor state and data memory of a simulation, which is 
+  * opaque outside of the generic simulator (see saveSnapshot()) 
+  */
+typedef struct sim_snapshot sim_snapshot_t;
+
+/** Accesses and misses of a cache model (see readTimingModel()) */
+typedef struct {
+	uint64_t		accesses;
+	uint64_t		misses;
+} sim_cache_stats_t;
+
+/** Conditional branches and mispredictions of a branch predictor (see readTimingModel()) */
+typedef struct {
+	uint64_t		branches;
+	uint64_t		taken;
+	uint64_t		mispredictions;
+} sim_branch_stats_t;
+
+/** Stall cycles of the pipeline model (see readTimingModel()) */
+typedef struct {
+	/* waiting for loaded registers */
+	uint64_t		load_use;
+	/* waiting for condition flags and jump targets */
+	uint64_t		control;
+	/* waiting for a free entry of the store buffer */
+	uint64_t		store;
+} sim_pipeline_stats_t;
+
+/** Results of a simulation (see getResults()) */
+typedef struct {
+	/* value returned by the main function */
+	uint32_t		return_value;
+	/* simulated cycles since the reset */
+	uint64_t		cycles;
+	/* executed instructions since the reset */
+	uint64_t		instructions;
+	/* cycles of the region closed by the last cycle print instruction */
+	uint64_t		region_cycles;
+	/* number of regions closed by cycle print instructions */
+	uint32_t		regions;
+	/* instruction and data cache statistics, zero if a cache is disabled */
+	sim_cache_stats_t	icache;
+	sim_cache_stats_t	dcache;
+	/* branch prediction statistics, zero if no predictor is enabled */
+	sim_branch_stats_t	branches;
+	/* pipeline stalls, zero if the pipeline is not modeled */
+	sim_pipeline_stats_t	pipeline;
+} sim_results_t;
+
+/** 
+  * Accumulated executions of one region, i.e. the code between a cycle 
+  * clear or cycle print instruction (or the program start) and the next
+  * cycle print instruction (see printRegions())
+  */
+typedef struct {
+	/* word address of the opening instruction, REGION_START_PROGRAM for the program start */
+	uint32_t		start;
+	/* word address of the closing cycle print instruction */
+	uint32_t		end;
+	/* number of executions */
+	uint64_t		count;
+	/* minimum, maximum and summed cycles of all executions */
+	uint64_t		min_cycles;
+	uint64_t		max_cycles;
+	uint64_t		sum_cycles;
+	/* summed instructions of all executions */
+	uint64_t		sum_instructions;
+	/* summed instruction and data cache statistics of all executions */
+	sim_cache_stats_t	icache;
+	sim_cache_stats_t	dcache;
+} sim_region_t;
+
+/** Start address of the region which starts with the program */
+#define REGION_START_PROGRAM	UINT32_MAX
+
+typedef void (* void_fct_t)(sim_context_t*);
+typedef int (* boolean_fct_t)(sim_context_t*);
+typedef uint32_t (* size_fct_t)(sim_context_t*);
+typedef void (* read_file_fct_t)(sim_context_t*, FILE*);
+typedef void (* write_file_fct_t)(sim_context_t*, FILE*);
+typedef simulator_header_t* (* file_hdr_fct_t)(sim_context_t*);
+typedef sparc_instruction** (* get_paddr_fct_t)(sim_context_t*);
+typedef int (* sim_fct_t)(sim_context_t*, FILE*);
+typedef void (* mode_fct_t)(sim_context_t*, int);
+typedef int (* run_fct_t)(sim_context_t*, FILE*, uint32_t, uint32_t);
+typedef int (* fast_forward_fct_t)(sim_context_t*, uint32_t, uint32_t);
+typedef void (* block_counts_fct_t)(sim_context_t*, uint32_t*);
+typedef int (* breakpoint_fct_t)(sim_context_t*, uint32_t, int);
+typedef sim_snapshot_t* (* snapshot_save_fct_t)(sim_context_t*);
+typedef void (* snapshot_restore_fct_t)(sim_context_t*, const sim_snapshot_t*);
+typedef int (* snapshot_write_fct_t)(const sim_snapshot_t*, FILE*);
+typedef sim_snapshot_t* (* snapshot_read_fct_t)(sim_context_t*, FILE*);
+typedef void (* snapshot_free_fct_t)(sim_snapshot_t*);
+typedef void (* share_fct_t)(sim_context_t*, sim_context_t*);
+typedef void (* results_fct_t)(sim_context_t*, sim_results_t*);
 
 typedef void (* error_fct_t)(char*);
 
@@ -55,14 +172,38 @@ typedef struct {
 	boolean_fct_t			checkTargetID;
 	read_file_fct_t			readMemory;
 	read_file_fct_t			readInstructions;
+	read_file_fct_t			readTimingModel;
+	read_file_fct_t			readFunctionMap;
 	write_file_fct_t		printInstructions;
 	write_file_fct_t		printMemory;
 	write_file_fct_t		printRegisters;
 	write_file_fct_t		printResults;
+	write_file_fct_t		printRegions;
+	write_file_fct_t		printBranches;
+	write_file_fct_t		printProfile;
+	write_file_fct_t		printFunctions;
+	write_file_fct_t		writeCallStacks;
 	sim_fct_t				simulateStep;
+	run_fct_t				run;
+	fast_forward_fct_t		fastForward;
+	block_counts_fct_t		setBlockCounts;
+	breakpoint_fct_t		setBreakpoint;
+	mode_fct_t				setJITMode;
+	boolean_fct_t			hasModels;
+	mode_fct_t				setCycleStatistics;
+	mode_fct_t				setProfiling;
+	mode_fct_t				setCallTracing;
 	void_fct_t				resetSimulator;
+	snapshot_save_fct_t		saveSnapshot;
+	snapshot_restore_fct_t	restoreSnapshot;
+	snapshot_write_fct_t	writeSnapshot;
+	snapshot_read_fct_t		readSnapshot;
+	snapshot_free_fct_t		freeSnapshot;
+	share_fct_t				shareProgram;
+	results_fct_t			getResults;
 	get_paddr_fct_t			getInstructions;
 	size_fct_t				getNumberOfInstructions;
+	size_fct_t				getTargetFeatures;
 	void_fct_t				cleanUp;
 } gen_simulator_t;
 
@@ -70,4 +211,8 @@ typedef int (* simulator_init_fct_t)(gen_simulator_t* simulator, error_fct_t);
 
 int gen_simulator_init(gen_simulator_t* simulator, error_fct_t);
 
+sim_context_t* gen_simulator_create_context(gen_simulator_t* simulator);
+
+void gen_simulator_destroy_context(sim_context_t* context);
+
 #endif /* __GEN_SIMULATOR_H__ */
@@ -0,0 +1,97 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/jit_x86_64.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __JIT_X86_64_H__
+#define __JIT_X86_64_H__
+
+#include <stdint.h>
+
+#include "sparc_target.h"
+
+/** Number of executions after which a block is compiled to host code */
+#define JIT_HOT_THRESHOLD	16
+/** Size of the executable arena for compiled blocks in bytes */
+#define JIT_ARENA_SIZE		(16*1024*1024)
+/** Granularity of the protection of the arena in bytes */
+#define JIT_PAGE_SIZE		4096
+
+/** 
+  * Compiled block: executes all instructions of the block and returns 
+  * the word address of the next instruction (npc is always pc + 1).
+  */
+typedef uint32_t (* jit_block_fct_t)(void);
+
+/** Simulator context, which is passed to the helper functions */
+struct sim_context;
+
+/**
+  * Processor state and helper functions of the simulator core which 
+  * are accessed by compiled blocks, and the arena of the compiled 
+  * blocks of one simulator context.
+  */
+typedef struct {
+	/** Context of the simulation, first argument of all helpers */
+	struct sim_context*	context;
+	/** Global registers */
+	uint32_t*		glob_regs;
+	/** Pointer to the out, local and in registers of the current window */
+	uint32_t**		window;
+	/** Sparc processor state register */
+	uint32_t*		psr;
+	/** Last icc setting operation, the icc of the psr are only valid 
+	    if no operation is pending */
+	lazy_icc_state_t*	lazy_icc;
+	/** Sparc Y register */
+	uint32_t*		y;
+	/** Pointer to the data memory pointer */
+	uint8_t**		data_memory;
+	/** Changes the current window as save (0) or restore (1) */
+	void			(* change_cwp)(struct sim_context*, int);
+	/** Evaluates an integer condition code */
+	int				(* evaluate_icc)(struct sim_context*, int);
+	/** Writes the icc of a pending operation to the psr */
+	void			(* materialize_icc)(struct sim_context*);
+	/** Terminates the simulation for a misaligned access of an opcode */
+	void			(* memory_error)(struct sim_context*, int);
+	/** Arena for the compiled blocks, allocated on first use, either 
+	    writable or executable */
+	uint8_t*		arena;
+	/** Number of used bytes of the arena */
+	uint32_t		arena_used;
+	/** Set if a block did not fit into the arena, see jitFlush() */
+	int				arena_full;
+	/** Number of flushes of the arena */
+	uint32_t		arena_flushes;
+} jit_environment_t;
+
+jit_block_fct_t jitCompileBlock(jit_environment_t* env, 
+		sparc_instruction* instructions, uint32_t start, uint32_t length);
+
+void jitFlush(jit_environment_t* env);
+
+void jitCleanUp(jit_environment_t* env);
+
+#endif /* __JIT_X86_64_H__ */
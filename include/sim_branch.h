@@ -0,0 +1,122 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/sim_branch.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __SIM_BRANCH_H__
+#define __SIM_BRANCH_H__
+
+#include <stdint.h>
+
+#include "gen_simulator.h"
+
+/** Index bits of the counter tables if none are given */
+#define PREDICTOR_DEFAULT_BITS	12
+/** Maximum index bits of the counter tables */
+#define PREDICTOR_MAX_BITS		24
+
+/** Models of the branch predictor */
+typedef enum {
+	/* no prediction, branches have no penalty */
+	PREDICTOR_NONE,
+	/* static: backward taken, forward not taken */
+	PREDICTOR_BTFN,
+	/* last outcome of the branch */
+	PREDICTOR_1BIT,
+	/* 2-bit saturating counter of the branch (bimodal) */
+	PREDICTOR_2BIT,
+	/* 2-bit saturating counter indexed by the address XOR global history */
+	PREDICTOR_GSHARE,
+	PREDICTOR_NUM_MODELS
+} predictor_model_t;
+
+/**
+  * Branch predictor for conditional branches. The counter tables are 
+  * allocated by predictorInit(), so a prediction never allocates memory.
+  */
+typedef struct {
+	predictor_model_t	model;
+	/** One counter per entry, 0 for the static model */
+	uint8_t*			counters;
+	uint32_t			index_mask;
+	/** Global history of the outcomes, the last one in the lowest bit */
+	uint32_t			history;
+	/** Cycles charged for each misprediction */
+	uint32_t			penalty;
+	sim_branch_stats_t	stats;
+} predictor_t;
+
+int predictorInit(predictor_t* predictor, predictor_model_t model, uint32_t bits, 
+	uint32_t penalty);
+
+int predictorInitFrom(predictor_t* predictor, const predictor_t* source);
+
+void predictorReset(predictor_t* predictor);
+
+void predictorFree(predictor_t* predictor);
+
+/**
+  * @brief Predicts a conditional branch and trains the predictor with 
+  *        its outcome.
+  * @param[in,out] predictor The predictor, which is not PREDICTOR_NONE.
+  * @param[in] pc Word address of the branch.
+  * @param[in] target Word address of the branch target.
+  * @param[in] taken Whether the branch is taken.
+  * @return 1 if the branch has been mispredicted, 0 otherwise.
+  */
+static inline int predictorUpdate(predictor_t* predictor, uint32_t pc, uint32_t target, 
+	int taken) {
+
+	uint8_t* counter;
+	int predicted;
+
+	if (predictor->model == PREDICTOR_BTFN) {
+		predicted = (target <= pc);
+	} else {
+		if (predictor->model == PREDICTOR_GSHARE) {
+			pc ^= predictor->history;
+			predictor->history = (predictor->history << 1) | taken;
+		}
+		counter = &(predictor->counters[pc & predictor->index_mask]);
+		if (predictor->model == PREDICTOR_1BIT) {
+			predicted = *counter;
+			*counter = taken;
+		} else {
+			predicted = (*counter >= 2);
+			if (taken && *counter < 3) {
+				(*counter)++;
+			} else if (!taken && *counter > 0) {
+				(*counter)--;
+			}
+		}
+	}
+
+	(predictor->stats.branches)++;
+	predictor->stats.taken += taken;
+	predictor->stats.mispredictions += (predicted != taken);
+
+	return predicted != taken;
+}
+
+#endif /* __SIM_BRANCH_H__ */
@@ -0,0 +1,108 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/sim_cache.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __SIM_CACHE_H__
+#define __SIM_CACHE_H__
+
+#include <stdint.h>
+
+#include "gen_simulator.h"
+
+/** Maximum associativity, the order of the ways of a set fits into 64 bits */
+#define CACHE_MAX_WAYS		16
+/** Minimum line size in bytes, so that no access crosses a line */
+#define CACHE_MIN_LINE_SIZE	8
+/** Tag of an empty way, no line address can be equal */
+#define CACHE_INVALID		UINT32_MAX
+
+/** Replacement policies of the cache model */
+typedef enum {
+	/* least recently used */
+	CACHE_POLICY_LRU,
+	/* first in, first out */
+	CACHE_POLICY_FIFO,
+	/* random way */
+	CACHE_POLICY_RANDOM,
+	CACHE_NUM_POLICIES
+} cache_policy_t;
+
+/**
+  * Set-associative cache model, which only keeps the tags of the cached
+  * lines. All arrays are allocated by cacheInit(), so an access never 
+  * allocates memory.
+  */
+typedef struct {
+	/** Line addresses of the ways, set by set, CACHE_INVALID if empty */
+	uint32_t*			tags;
+	/** 
+	  * Ways of each set, 4 bits per way: the most recently used (LRU, 
+	  * random) or inserted (FIFO) way in the lowest bits, the victim of
+	  * LRU and FIFO at position ways - 1
+	  */
+	uint64_t*			order;
+	uint32_t			ways;
+	uint32_t			set_mask;
+	uint32_t			line_bits;
+	cache_policy_t		policy;
+	/** Cycles charged for each miss */
+	uint32_t			penalty;
+	/** State of the random replacement */
+	uint32_t			seed;
+	sim_cache_stats_t	stats;
+} cache_t;
+
+int cacheInit(cache_t* cache, uint32_t size, uint32_t ways, uint32_t line_size, 
+	cache_policy_t policy, uint32_t penalty);
+
+int cacheInitFrom(cache_t* cache, const cache_t* source);
+
+void cacheReset(cache_t* cache);
+
+void cacheFree(cache_t* cache);
+
+uint32_t cacheLookup(cache_t* cache, uint32_t set, uint32_t line);
+
+/**
+  * @brief Accesses the line of an address. Hits on the most recently 
+  *        used way of a set are handled inline, all other accesses by 
+  *        cacheLookup().
+  * @param[in,out] cache The cache.
+  * @param[in] address Byte address of the access.
+  * @return The penalty of a miss, 0 on a hit.
+  */
+static inline uint32_t cacheAccess(cache_t* cache, uint32_t address) {
+
+	uint32_t line = address >> cache->line_bits;
+	uint32_t set = line & cache->set_mask;
+
+	(cache->stats.accesses)++;
+	if (cache->tags[set*cache->ways + (cache->order[set] & 0xf)] == line) {
+		return 0;
+	}
+	return cacheLookup(cache, set, line);
+}
+
+#endif /* __SIM_CACHE_H__ */
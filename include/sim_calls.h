@@ -0,0 +1,123 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/sim_calls.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __SIM_CALLS_H__
+#define __SIM_CALLS_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "sparc_target.h"
+
+/** No node, frame or instruction */
+#define CALLS_NONE		UINT32_MAX
+
+/** 
+  * Node of the call tree: a function called along one path of calls 
+  * from main, with the cycles and instructions spent in the function
+  * itself (exclusive)
+  */
+typedef struct {
+	/* word address of the function */
+	uint32_t		function;
+	/* index of the calling node, CALLS_NONE for main */
+	uint32_t		parent;
+	/* index of the first called node and of the next node with the 
+	   same parent, CALLS_NONE if none */
+	uint32_t		child;
+	uint32_t		sibling;
+	uint64_t		calls;
+	uint64_t		cycles;
+	uint64_t		instructions;
+} call_node_t;
+
+/** Active call on the shadow call stack */
+typedef struct {
+	/* index of the node of the called function */
+	uint32_t		node;
+	/* word address where the call returns to */
+	uint32_t		ret;
+} call_frame_t;
+
+/**
+  * Shadow call stack and call tree of a simulation (see callsEnter()).
+  * The nodes and frames are kept in arrays which grow on demand, nodes 
+  * are only created after their parent.
+  */
+typedef struct {
+	call_node_t*		nodes;
+	uint32_t			num_nodes;
+	uint32_t			max_nodes;
+	call_frame_t*		frames;
+	uint32_t			depth;
+	uint32_t			max_depth;
+	/** Word address of the last executed instruction, CALLS_NONE if none */
+	uint32_t			last;
+	/** Counters when the current instructions were entered */
+	uint64_t			start_cycles;
+	uint64_t			start_instructions;
+	/** Names of the functions by word address, 0 if not named */
+	char**				names;
+	uint32_t			num_names;
+} call_stack_t;
+
+int callsReset(call_stack_t* calls, uint32_t root);
+
+int callsEnter(call_stack_t* calls, const sparc_instruction* instructions, uint32_t start,
+	uint32_t length);
+
+int callsSetName(call_stack_t* calls, uint32_t number_instructions, uint32_t function, 
+	const char* name);
+
+int callsPrintFunctions(const call_stack_t* calls, uint32_t number_instructions, FILE* outstream);
+
+int callsWriteFolded(const call_stack_t* calls, FILE* outstream);
+
+void callsFree(call_stack_t* calls);
+
+/**
+  * @brief Charges the cycles and instructions since the last call to the 
+  *        function on top of the shadow call stack.
+  * @param[in,out] calls The call stack.
+  * @param[in] cycles The current cycle counter.
+  * @param[in] instructions The current instruction counter.
+  * @param[in] charge 0 to discard the cycles and instructions, e.g. while
+  *                   fast-forwarding, 1 otherwise.
+  */
+static inline void callsCharge(call_stack_t* calls, uint64_t cycles, uint64_t instructions, 
+	int charge) {
+
+	call_node_t* node = &(calls->nodes[calls->frames[calls->depth - 1].node]);
+
+	if (charge) {
+		node->cycles += cycles - calls->start_cycles;
+		node->instructions += instructions - calls->start_instructions;
+	}
+	calls->start_cycles = cycles;
+	calls->start_instructions = instructions;
+}
+
+#endif /* __SIM_CALLS_H__ */
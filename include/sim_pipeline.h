@@ -0,0 +1,179 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/sim_pipeline.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __SIM_PIPELINE_H__
+#define __SIM_PIPELINE_H__
+
+#include <stdint.h>
+
+#include "sparc_target.h"
+#include "gen_simulator.h"
+
+/** Maximum number of entries of the store buffer */
+#define PIPELINE_MAX_STORE_BUFFER	8
+/** Previous instruction before the first one, which causes no interlock */
+#define PIPELINE_NONE				UINT32_MAX
+
+/** Condition flags which are checked by interlocks */
+#define PIPELINE_FLAG_ICC			0x1
+#define PIPELINE_FLAG_PREG			0x2
+
+/** Registers and flags of one instruction which cause interlocks */
+typedef struct {
+	/* destination register of a load, 0 if none or %g0 */
+	uint8_t			load_rd;
+	/* number of registers written by the load, 2 for ldd */
+	uint8_t			load_count;
+	/* PIPELINE_FLAG_* written by the instruction */
+	uint8_t			sets;
+	/* PIPELINE_FLAG_* evaluated by the instruction before execute */
+	uint8_t			reads_early;
+	/* source registers, 0 if unused */
+	uint8_t			reads[3];
+	/* whether the jump target is computed in execute (jmpl) */
+	uint8_t			jump;
+	/* whether the instruction writes through the store buffer */
+	uint8_t			store;
+} pipeline_info_t;
+
+/**
+  * Interlocks and store buffer of a LEON3-like integer pipeline, which 
+  * extend the cycles of the instruction classes by stalls between 
+  * consecutive instructions (see readTimingModel()). The per instruction
+  * information is built once by pipelineBuild().
+  */
+typedef struct {
+	/** Whether any interlock or the store buffer is modeled */
+	int					enabled;
+	/** Stall of an instruction which uses the result of the preceding load */
+	uint32_t			load_delay;
+	/** 
+	  * Stall of a conditional branch or predicated block after an 
+	  * instruction which sets its condition
+	  */
+	uint32_t			branch_interlock;
+	/** Additional cycles of a jump, whose target is known in execute */
+	uint32_t			jump_delay;
+	/** Entries of the store buffer, 0 if stores never stall */
+	uint32_t			store_entries;
+	/** Cycles in which the store buffer writes one entry to memory */
+	uint32_t			store_drain;
+	/** Interlock information of each instruction */
+	pipeline_info_t*	info;
+	/** Word address of the last issued instruction, PIPELINE_NONE if none */
+	uint32_t			last;
+	/** Completion times of the stores in the store buffer */
+	uint64_t			store_done[PIPELINE_MAX_STORE_BUFFER];
+	/** Entry of the next store */
+	uint32_t			store_next;
+	/** 
+	  * Cycles which have already been charged but not yet elapsed, e.g.
+	  * the rest of a block whose cycles are charged on entry
+	  */
+	uint32_t			ahead;
+	sim_pipeline_stats_t	stats;
+} pipeline_t;
+
+int pipelineBuild(pipeline_t* pipeline, const sparc_instruction* instructions, 
+	uint32_t number_instructions);
+
+void pipelineReset(pipeline_t* pipeline);
+
+void pipelineDrain(pipeline_t* pipeline);
+
+void pipelineFree(pipeline_t* pipeline);
+
+/**
+  * @brief Returns whether an instruction reads a register.
+  * @param[in] info Interlock information of the instruction.
+  * @param[in] reg The register, not %g0.
+  * @return 1 if the register is read, 0 otherwise.
+  */
+static inline int pipelineReads(const pipeline_info_t* info, uint8_t reg) {
+	return info->reads[0] == reg || info->reads[1] == reg || info->reads[2] == reg;
+}
+
+/**
+  * @brief Returns the stalls of an instruction which is issued after 
+  *        another one. Only consecutive instructions interlock, so the
+  *        stalls do not depend on the execution.
+  * @param[in] pipeline The pipeline, whose information has been built.
+  * @param[in] prev Word address of the previous instruction, or 
+  *                 PIPELINE_NONE.
+  * @param[in] cur Word address of the instruction.
+  * @param[out] load_use Stall cycles waiting for a loaded register.
+  * @param[out] control Stall cycles of condition flags and jumps.
+  */
+static inline void pipelineStalls(const pipeline_t* pipeline, uint32_t prev, uint32_t cur, 
+	uint32_t* load_use, uint32_t* control) {
+
+	const pipeline_info_t* info = &(pipeline->info[cur]);
+	const pipeline_info_t* prev_info;
+
+	*load_use = 0;
+	*control = info->jump ? pipeline->jump_delay : 0;
+	if (prev == PIPELINE_NONE) {
+		return;
+	}
+	prev_info = &(pipeline->info[prev]);
+	if (prev_info->load_rd && (pipelineReads(info, prev_info->load_rd) || 
+		(prev_info->load_count == 2 && pipelineReads(info, prev_info->load_rd + 1)))) {
+		*load_use = pipeline->load_delay;
+	}
+	if (prev_info->sets & info->reads_early) {
+		*control += pipeline->branch_interlock;
+	}
+}
+
+/**
+  * @brief Enters a store into the store buffer. The buffer writes its 
+  *        entries one after another, each in store_drain cycles. If all
+  *        entries are occupied, the pipeline stalls until the oldest one
+  *        has been written.
+  * @param[in,out] pipeline The pipeline with a store buffer.
+  * @param[in] now Cycle in which the store leaves the pipeline.
+  * @return The stall cycles.
+  */
+static inline uint32_t pipelineStore(pipeline_t* pipeline, uint64_t now) {
+
+	uint32_t entry = pipeline->store_next;
+	uint32_t last = (entry ? entry : pipeline->store_entries) - 1;
+	uint64_t stall = 0;
+
+	if (pipeline->store_done[entry] > now) {
+		stall = pipeline->store_done[entry] - now;
+		now = pipeline->store_done[entry];
+	}
+	pipeline->store_done[entry] = 
+		((pipeline->store_done[last] > now) ? pipeline->store_done[last] : now) + 
+		pipeline->store_drain;
+	pipeline->store_next = (entry + 1 == pipeline->store_entries) ? 0 : entry + 1;
+	pipeline->stats.store += stall;
+
+	return (uint32_t) stall;
+}
+
+#endif /* __SIM_PIPELINE_H__ */
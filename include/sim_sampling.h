@@ -0,0 +1,45 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: include/sim_sampling.h
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#ifndef __SIM_SAMPLING_H__
+#define __SIM_SAMPLING_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "gen_simulator.h"
+
+/** Default number of instructions of a sampling interval */
+#define SAMPLING_INTERVAL		1000000
+/** Default maximum number of clusters of similar intervals */
+#define SAMPLING_MAX_CLUSTERS	10
+/** Default number of intervals simulated with cycles per cluster */
+#define SAMPLING_SAMPLES		3
+
+int simulateSampled(gen_simulator_t* simulator, sim_context_t* context, FILE* outstream,
+	int jit_mode, uint32_t interval, uint32_t max_clusters, uint32_t samples);
+
+#endif /* __SIM_SAMPLING_H__ */
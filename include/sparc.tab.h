@@ -0,0 +1,333 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_SPARC_TAB_H_INCLUDED
+# define YY_YY_SPARC_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    LABEL = 258,                   /* LABEL  */
+    TYPE_ARG = 259,                /* TYPE_ARG  */
+    REGISTER = 260,                /* REGISTER  */
+    IMMEDIATE = 261,               /* IMMEDIATE  */
+    Y_REGISTER = 262,              /* Y_REGISTER  */
+    P_REGISTER = 263,              /* P_REGISTER  */
+    LOOPS_REGISTER = 264,          /* LOOPS_REGISTER  */
+    LOOPE_REGISTER = 265,          /* LOOPE_REGISTER  */
+    LOOPB_REGISTER = 266,          /* LOOPB_REGISTER  */
+    ICC = 267,                     /* ICC  */
+    PRED_REG_TF = 268,             /* PRED_REG_TF  */
+    FILE_INFO = 269,               /* FILE_INFO  */
+    TEXT_INFO = 270,               /* TEXT_INFO  */
+    GLOBL_INFO = 271,              /* GLOBL_INFO  */
+    ALIGN_INFO = 272,              /* ALIGN_INFO  */
+    TYPE_INFO = 273,               /* TYPE_INFO  */
+    SIZE_INFO = 274,               /* SIZE_INFO  */
+    SECTION_INFO = 275,            /* SECTION_INFO  */
+    DATA_INFO = 276,               /* DATA_INFO  */
+    RODATA_INFO = 277,             /* RODATA_INFO  */
+    BSS_INFO = 278,                /* BSS_INFO  */
+    ALLOC_INFO = 279,              /* ALLOC_INFO  */
+    DATA_REL_LOCAL_INFO = 280,     /* DATA_REL_LOCAL_INFO  */
+    WRITE_INFO = 281,              /* WRITE_INFO  */
+    WORD = 282,                    /* WORD  */
+    HALF = 283,                    /* HALF  */
+    BYTE = 284,                    /* BYTE  */
+    SKIP = 285,                    /* SKIP  */
+    HI = 286,                      /* HI  */
+    LOW = 287,                     /* LOW  */
+    CYCLE_PRINT = 288,             /* CYCLE_PRINT  */
+    CYCLE_CLEAR = 289,             /* CYCLE_CLEAR  */
+    LOAD = 290,                    /* LOAD  */
+    LOADA = 291,                   /* LOADA  */
+    STORE = 292,                   /* STORE  */
+    STOREA = 293,                  /* STOREA  */
+    LDSTA = 294,                   /* LDSTA  */
+    SWP = 295,                     /* SWP  */
+    LOGIC = 296,                   /* LOGIC  */
+    SHIFT = 297,                   /* SHIFT  */
+    ARITHM = 298,                  /* ARITHM  */
+    SVREST = 299,                  /* SVREST  */
+    BRANCH = 300,                  /* BRANCH  */
+    LDSB = 301,                    /* LDSB  */
+    LDSH = 302,                    /* LDSH  */
+    LDUB = 303,                    /* LDUB  */
+    LDUH = 304,                    /* LDUH  */
+    LD = 305,                      /* LD  */
+    LDD = 306,                     /* LDD  */
+    LDSBA = 307,                   /* LDSBA  */
+    LDSHA = 308,                   /* LDSHA  */
+    LDUBA = 309,                   /* LDUBA  */
+    LDUHA = 310,                   /* LDUHA  */
+    LDA = 311,                     /* LDA  */
+    LDDA = 312,                    /* LDDA  */
+    STB = 313,                     /* STB  */
+    STH = 314,                     /* STH  */
+    ST = 315,                      /* ST  */
+    STD = 316,                     /* STD  */
+    STBA = 317,                    /* STBA  */
+    STHA = 318,                    /* STHA  */
+    STA = 319,                     /* STA  */
+    STDA = 320,                    /* STDA  */
+    LDSTUB = 321,                  /* LDSTUB  */
+    LDSTUBA = 322,                 /* LDSTUBA  */
+    SWAP = 323,                    /* SWAP  */
+    SWAPA = 324,                   /* SWAPA  */
+    AND = 325,                     /* AND  */
+    ANDCC = 326,                   /* ANDCC  */
+    ANDN = 327,                    /* ANDN  */
+    ANDNCC = 328,                  /* ANDNCC  */
+    OR = 329,                      /* OR  */
+    ORCC = 330,                    /* ORCC  */
+    ORN = 331,                     /* ORN  */
+    ORNCC = 332,                   /* ORNCC  */
+    XOR = 333,                     /* XOR  */
+    XORCC = 334,                   /* XORCC  */
+    XNOR = 335,                    /* XNOR  */
+    XNORCC = 336,                  /* XNORCC  */
+    SLL = 337,                     /* SLL  */
+    SRL = 338,                     /* SRL  */
+    SRA = 339,                     /* SRA  */
+    ADD = 340,                     /* ADD  */
+    ADDCC = 341,                   /* ADDCC  */
+    ADDX = 342,                    /* ADDX  */
+    ADDXCC = 343,                  /* ADDXCC  */
+    TADDCC = 344,                  /* TADDCC  */
+    TADDCCTV = 345,                /* TADDCCTV  */
+    SUB = 346,                     /* SUB  */
+    SUBCC = 347,                   /* SUBCC  */
+    SUBX = 348,                    /* SUBX  */
+    SUBXCC = 349,                  /* SUBXCC  */
+    TSUBCC = 350,                  /* TSUBCC  */
+    TSUBCCTV = 351,                /* TSUBCCTV  */
+    MULSCC = 352,                  /* MULSCC  */
+    UMUL = 353,                    /* UMUL  */
+    SMUL = 354,                    /* SMUL  */
+    UMULCC = 355,                  /* UMULCC  */
+    SMULCC = 356,                  /* SMULCC  */
+    UDIV = 357,                    /* UDIV  */
+    SDIV = 358,                    /* SDIV  */
+    UDIVCC = 359,                  /* UDIVCC  */
+    SDIVCC = 360,                  /* SDIVCC  */
+    SAVE = 361,                    /* SAVE  */
+    RESTORE = 362,                 /* RESTORE  */
+    SETHI = 363,                   /* SETHI  */
+    NOP = 364,                     /* NOP  */
+    CALL = 365,                    /* CALL  */
+    JUMPL = 366,                   /* JUMPL  */
+    JMP = 367,                     /* JMP  */
+    RD = 368,                      /* RD  */
+    WR = 369,                      /* WR  */
+    MOV = 370,                     /* MOV  */
+    SEL = 371,                     /* SEL  */
+    HWLOOP_INIT = 372,             /* HWLOOP_INIT  */
+    HWLOOP_START = 373,            /* HWLOOP_START  */
+    PREDBEGIN = 374,               /* PREDBEGIN  */
+    PREDEND = 375,                 /* PREDEND  */
+    PREDSET = 376,                 /* PREDSET  */
+    PREDCLEAR = 377,               /* PREDCLEAR  */
+    UNKNOWN = 378                  /* UNKNOWN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define LABEL 258
+#define TYPE_ARG 259
+#define REGISTER 260
+#define IMMEDIATE 261
+#define Y_REGISTER 262
+#define P_REGISTER 263
+#define LOOPS_REGISTER 264
+#define LOOPE_REGISTER 265
+#define LOOPB_REGISTER 266
+#define ICC 267
+#define PRED_REG_TF 268
+#define FILE_INFO 269
+#define TEXT_INFO 270
+#define GLOBL_INFO 271
+#define ALIGN_INFO 272
+#define TYPE_INFO 273
+#define SIZE_INFO 274
+#define SECTION_INFO 275
+#define DATA_INFO 276
+#define RODATA_INFO 277
+#define BSS_INFO 278
+#define ALLOC_INFO 279
+#define DATA_REL_LOCAL_INFO 280
+#define WRITE_INFO 281
+#define WORD 282
+#define HALF 283
+#define BYTE 284
+#define SKIP 285
+#define HI 286
+#define LOW 287
+#define CYCLE_PRINT 288
+#define CYCLE_CLEAR 289
+#define LOAD 290
+#define LOADA 291
+#define STORE 292
+#define STOREA 293
+#define LDSTA 294
+#define SWP 295
+#define LOGIC 296
+#define SHIFT 297
+#define ARITHM 298
+#define SVREST 299
+#define BRANCH 300
+#define LDSB 301
+#define LDSH 302
+#define LDUB 303
+#define LDUH 304
+#define LD 305
+#define LDD 306
+#define LDSBA 307
+#define LDSHA 308
+#define LDUBA 309
+#define LDUHA 310
+#define LDA 311
+#define LDDA 312
+#define STB 313
+#define STH 314
+#define ST 315
+#define STD 316
+#define STBA 317
+#define STHA 318
+#define STA 319
+#define STDA 320
+#define LDSTUB 321
+#define LDSTUBA 322
+#define SWAP 323
+#define SWAPA 324
+#define AND 325
+#define ANDCC 326
+#define ANDN 327
+#define ANDNCC 328
+#define OR 329
+#define ORCC 330
+#define ORN 331
+#define ORNCC 332
+#define XOR 333
+#define XORCC 334
+#define XNOR 335
+#define XNORCC 336
+#define SLL 337
+#define SRL 338
+#define SRA 339
+#define ADD 340
+#define ADDCC 341
+#define ADDX 342
+#define ADDXCC 343
+#define TADDCC 344
+#define TADDCCTV 345
+#define SUB 346
+#define SUBCC 347
+#define SUBX 348
+#define SUBXCC 349
+#define TSUBCC 350
+#define TSUBCCTV 351
+#define MULSCC 352
+#define UMUL 353
+#define SMUL 354
+#define UMULCC 355
+#define SMULCC 356
+#define UDIV 357
+#define SDIV 358
+#define UDIVCC 359
+#define SDIVCC 360
+#define SAVE 361
+#define RESTORE 362
+#define SETHI 363
+#define NOP 364
+#define CALL 365
+#define JUMPL 366
+#define JMP 367
+#define RD 368
+#define WR 369
+#define MOV 370
+#define SEL 371
+#define HWLOOP_INIT 372
+#define HWLOOP_START 373
+#define PREDBEGIN 374
+#define PREDEND 375
+#define PREDSET 376
+#define PREDCLEAR 377
+#define UNKNOWN 378
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 77 "yy/sparc.y"
+
+	int value;
+	char* string;
+	sparc_address* address;
+
+#line 319 "sparc.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_SPARC_TAB_H_INCLUDED  */
@@ -43,6 +43,14 @@
 #define FP_REGISTER 30
 #define Y_REGISTER_NO 0
 
+/* instruction set extensions which a target may enable (TARGET_FEATURES) */
+#define TARGET_FEATURE_HWLOOP		(1<<0)
+#define TARGET_FEATURE_SELCC		(1<<1)
+#define TARGET_FEATURE_MOVCC		(1<<2)
+#define TARGET_FEATURE_PRED_ICC		(1<<3)
+#define TARGET_FEATURE_PRED_PREG	(1<<4)
+#define TARGET_FEATURES_ALL			((1<<5) - 1)
+
 /** define number of windows - maximum 32 */
 #define NWINDOWS 16
 /* define WIM_MASK depending on NWINDOWS */
@@ -134,6 +142,25 @@
 /* not defined in manual, but assumed */
 #define CYCLES_DIV					5
 
+/** 
+  * Instruction classes of the timing model, the defaults of their cycles
+  * are the CYCLES_* values above (see readTimingModel())
+  */
+typedef enum {
+	TIMING_INTEGER,
+	TIMING_LOAD_SINGLE,
+	TIMING_LOAD_DOUBLE,
+	TIMING_STORE_SINGLE,
+	TIMING_STORE_DOUBLE,
+	TIMING_MUL,
+	TIMING_DIV,
+	/* branches, calls and jumps */
+	TIMING_CONTROL,
+	/* save and restore */
+	TIMING_WINDOW,
+	TIMING_NUM_CLASSES
+} timing_class_t;
+
 /** standard return address of main function */
 #define END_OF_INS_MEM	0xffffffff
 
@@ -198,6 +225,9 @@ typedef struct {
 	sparc_operand	operand2;
 } sparc_address;
 
+/* maximum number of operands of an instruction */
+#define MAX_OPERANDS 4
+
 typedef struct {
 	int 			opcode;
 	unsigned		instr_no;
@@ -261,6 +291,24 @@ typedef struct {
 	predicate_condition_t	predicate_condition;
 } predicate_processor_state_t;
 
+typedef enum {
+	/* icc of the psr are valid */
+	ICC_OP_NONE = 0,
+	/* N and Z of result, V and C cleared */
+	ICC_OP_LOGIC,
+	/* icc of an addition src1 + src2 = result */
+	ICC_OP_ADD,
+	/* icc of a subtraction src1 - src2 = result */
+	ICC_OP_SUB
+} icc_op_t;
+
+typedef struct {
+	uint32_t				op;
+	uint32_t				src1;
+	uint32_t				src2;
+	uint32_t				result;
+} lazy_icc_state_t;
+
 /* check whether signed immediate only has 13 bits */
 #define IS_SIMM13(a) (((a) >= -4096) && ((a) < 4096))
 
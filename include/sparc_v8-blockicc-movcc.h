@@ -30,6 +30,9 @@
 /* target id for sparc v8 block icc is 1 */
 #define TARGET_ID	0x0001
 
+/* hardware loops, predicated blocks on icc and movcc */
+#define TARGET_FEATURES	(TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_ICC | TARGET_FEATURE_MOVCC)
+
 /*===============================*/
 /*        Set operations         */
 /*===============================*/
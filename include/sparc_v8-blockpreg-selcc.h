@@ -30,6 +30,10 @@
 /* target id for sparc v8 block preg is 2 */
 #define TARGET_ID	0x0002
 
+/* hardware loops, predicated blocks on predicate registers and selcc */
+#define TARGET_FEATURES	(TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_PREG | \
+	TARGET_FEATURE_SELCC)
+
 /*===============================*/
 /*        Set operations         */
 /*===============================*/
@@ -30,6 +30,9 @@
 /* target id for sparc v8 is 0 */
 #define TARGET_ID	0x0000
 
+/* sparc v8 does not enable any extension */
+#define TARGET_FEATURES	0
+
 /*===============================*/
 /*        Set operations         */
 /*===============================*/
@@ -34,10 +34,11 @@
 
 #include "sparc_v8-blockpreg-selcc.h"
 
-/** Pointer to the generic simulator object. */
+/** 
+  * Pointer to the generic simulator object, shared by all simulator 
+  * contexts of this target. 
+  */
 static gen_simulator_t* gen_simulator;
-/** Save the number of instructions for cleanUp function. */
-static uint32_t number_instructions;
 
 /** Pointer to error function of simulator. */
 static error_fct_t simerror;
@@ -45,10 +46,11 @@ static error_fct_t simerror;
 /**
   * @brief Converts the target specific opcode into the generic
   * opcode of the simulator.
+  * @param[in] context The simulator context.
   * @return The internal opcode for the generic simulator 
   * instruction.
   */
-static int getOpcode(uint32_t opcode) {
+static int getOpcode(sim_context_t* context, uint32_t opcode) {
 
 	int op;
 	int op2;
@@ -110,7 +112,7 @@ static int getOpcode(uint32_t opcode) {
 							return_opcode = PREDSET;
 						}
 					} else {
-						gen_simulator->cleanUp();
+						gen_simulator->cleanUp(context);
 						simerror("Unkown predication instruction!");
 					}
 					break;
@@ -334,12 +336,14 @@ static int getOpcode(uint32_t opcode) {
 
 /**
   * @brief Saves the correct opcode and all operands of the current instruction.
+  * @param[in] context The simulator context.
   * @param[in] opcode The binary target specific opcode.
   * @param[in,out] instruction The instruction which shall be saved.
   */
-static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
+static void saveInstruction(sim_context_t* context, uint32_t opcode, 
+		sparc_instruction* instruction) {
 
-	int sim_opcode = getOpcode(opcode);
+	int sim_opcode = getOpcode(context, opcode);
 	int dst_reg;
 	int src1_reg;
 	int src2_reg;
@@ -350,6 +354,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 	/* save opcode */
 	instruction->opcode = sim_opcode;
+	instruction->num_operands = 0;
 
 	/* save operands */
 	switch (sim_opcode) {
@@ -364,13 +369,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			}
 			/* save call displacement as operand */
 			instruction->num_operands = 1;
-			instruction->operands = malloc(sizeof(sparc_operand));
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 
 			instruction->operands[0].type = OPERAND_TYPE_LABEL_ADDRESS;
 			/* label address is (absolute) instruction number */
@@ -387,13 +385,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			icc = GET_CC(opcode);
 
 			instruction->num_operands = 2;
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 			
 			instruction->operands[0].type = OPERAND_TYPE_LABEL_ADDRESS;
 			/* label address is (absolute) instruction number */
@@ -420,14 +411,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 				instruction->num_operands = 2;
 
-				instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-				/* memory allocation OK? */
-				if (!(instruction->operands)) {
-					gen_simulator->cleanUp();
-					simerror("Could not allocate memory for instruction operands!");
-				}
-
 				instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 				instruction->operands[0].value.reg = dst_reg;
 
@@ -444,13 +427,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			/* hwloop init instructions */
 
 			instruction->num_operands = 2;
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 
 			if (GET_HWLOOP_TYPE(opcode) == HWLOOP_TYPE_SET_S) {
 
@@ -503,7 +479,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 				instruction->operands[1].type = OPERAND_TYPE_REGISTER;
 				instruction->operands[1].value.reg = src1_reg;
 			} else {
-				gen_simulator->cleanUp();
+				gen_simulator->cleanUp(context);
 				simerror("Unknown hwloop instruction!");
 			}
 			break;
@@ -511,13 +487,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			/* save all operands of selcc instruction */
 			instruction->num_operands = 4;
 
-			instruction->operands = malloc(sizeof(sparc_operand)*4);
-
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
-
 			dst_reg = GET_RD(opcode);
 			instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 			instruction->operands[0].value.reg = dst_reg;
@@ -567,7 +536,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 				instruction->operands[2].type = OPERAND_TYPE_SIMM8;
 				instruction->operands[2].value.simm8 = immediate;
 			} else {
-				gen_simulator->cleanUp();
+				gen_simulator->cleanUp(context);
 				simerror("Unknown type for selcc instruction");
 			}
 
@@ -580,13 +549,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			/* we need to save preg and t/f-bit for current block */
 			instruction->num_operands = 2;
 
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
-
 			src2_reg = GET_RS2(opcode);
 			immediate = PRED_BLOCK_GET_TF(opcode);
 
@@ -605,13 +567,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			/* we only need to save destination register */
 			instruction->num_operands = 1;
 
-			instruction->operands = malloc(sizeof(sparc_operand));
-
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
-
 			dst_reg = GET_RD(opcode);
 			instruction->operands[0].type = OPERAND_TYPE_PREG;
 			instruction->operands[0].value.preg = dst_reg;
@@ -624,24 +579,10 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			if (icc == CC_A) {
 				/* if condition is "always", just save one operand */
 				instruction->num_operands = 1;
-				
-				instruction->operands = malloc(sizeof(sparc_operand));
-
-				if (!(instruction->operands)) {
-					gen_simulator->cleanUp();
-					simerror("Could not allocate memory for instruction operands!");
-				}
 
 			} else {
 				/* if condition is anything else, save preg and icc */
 				instruction->num_operands = 2;
-				
-				instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-				if (!(instruction->operands)) {
-					gen_simulator->cleanUp();
-					simerror("Could not allocate memory for instruction operands!");
-				}
 
 				/* save icc */
 				instruction->operands[1].type = OPERAND_TYPE_ICC;
@@ -657,20 +598,12 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			dst_reg = GET_RD(opcode);
 			src1_reg = GET_RS1(opcode);
 			if (src1_reg != Y_REGISTER_NO) {
-				gen_simulator->cleanUp();
+				gen_simulator->cleanUp(context);
 				simerror("Unknown source register for rd instruction!");
 			}
 
 			instruction->num_operands = 2;
 
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
-
 			instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 			instruction->operands[0].value.reg = dst_reg;
 
@@ -686,7 +619,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 		/* terminate on unkown instruction */
 		case UNKNOWN:
-			gen_simulator->cleanUp();
+			gen_simulator->cleanUp(context);
 			snprintf(errormsg, 100, "Encountered unknown opcode at instruction no %d!", 
 				instruction->instr_no);
 			simerror(errormsg);
@@ -700,13 +633,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 			instruction->num_operands = 3;			
 			
-			instruction->operands = malloc(sizeof(sparc_operand)*3);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 
 			instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 			instruction->operands[0].value.reg = dst_reg;
@@ -737,10 +663,11 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 /**
   * @brief Checks, whether the current file is supported by the specific target.
+  * @param[in] context The simulator context.
   * @return 0 on success, 1 otherwise
   */
-int checkTargetID(void) {
-	if (gen_simulator->getFileHeader()->target_id != TARGET_ID) {
+int checkTargetID(sim_context_t* context) {
+	if (gen_simulator->getFileHeader(context)->target_id != TARGET_ID) {
 		return 1;
 	} else {
 		return 0;
@@ -751,72 +678,111 @@ int checkTargetID(void) {
 /**
   * @brief Reads in target specific instructions from the given file 
   * and generates generic instruction for the simulator.
+  * @param[in,out] context The simulator context.
   * @param[in] instream File containing the instructions in binary format.
   */
-void readInstructions(FILE* instream) {
+void readInstructions(sim_context_t* context, FILE* instream) {
 	
-	uint32_t instruction_size = gen_simulator->getFileHeader()->instruction_size;
+	uint32_t instruction_size = gen_simulator->getFileHeader(context)->instruction_size;
 
-	sparc_instruction** instructions = gen_simulator->getInstructions();
+	sparc_instruction** instructions = gen_simulator->getInstructions(context);
 	sparc_instruction* instructions_array;
+	sparc_operand* operands_array;
 
-	uint32_t opcode;
+	uint32_t* opcodes;
+	sparc_instruction decoded;
+	sparc_operand scratch[MAX_OPERANDS];
+	uint32_t num_operands = 0;
 
 	uint32_t i, j;
 	int value;
 
 	/* all binary instructions have 4 bytes */
 	if (instruction_size % 4) {
-		gen_simulator->cleanUp();
+		gen_simulator->cleanUp(context);
 		simerror("Invalid instruction size: has to be a multiple of 4!");
 	} else {
 		instruction_size = instruction_size / 4;
 	}
 
-	/* allocate memory for instructions */
-	*instructions = malloc(sizeof(sparc_instruction)*(instruction_size));
-	instructions_array = *instructions;
-
-	if (!instructions_array) {
-		gen_simulator->cleanUp();
+	/* read in all opcodes first, the number of operands of an instruction
+	   is only known after decoding it */
+	opcodes = malloc(sizeof(uint32_t)*(instruction_size + 1));
+	if (!opcodes) {
+		gen_simulator->cleanUp(context);
 		simerror("Could not allocate memory for instructions!");
 	}
 
-	/* set number of allocated instructions */
-	number_instructions = instruction_size;
-
-	/* read in instructions */
 	for (i = 0; i < instruction_size; i++) {
 
 		/* clear current opcode */
-		opcode = 0;
+		opcodes[i] = 0;
 
 		/* read in opcode from current filestream */
 		for (j = 0; j < 4; j++) {
 			if ((value = fgetc(instream)) == EOF) {
-				gen_simulator->cleanUp();
+				free(opcodes);
+				gen_simulator->cleanUp(context);
 				simerror("Could not read from file!");
 			}
-			opcode <<= 8;
-			opcode |= (uint32_t) ((value) & 0xff);
+			opcodes[i] <<= 8;
+			opcodes[i] |= (uint32_t) ((value) & 0xff);
 		}
 
-		/* save instruction number */
+		/* count the operands of the instruction */
+		decoded.instr_no = i;
+		decoded.operands = scratch;
+		saveInstruction(context, opcodes[i], &decoded);
+		num_operands += decoded.num_operands;
+
+	}
+
+	/* allocate memory for instructions and their operands at once, 
+	   the operands are stored behind the instructions without gaps */
+	*instructions = malloc(sizeof(sparc_instruction)*instruction_size + 
+		sizeof(sparc_operand)*num_operands);
+	instructions_array = *instructions;
+
+	if (!instructions_array) {
+		free(opcodes);
+		gen_simulator->cleanUp(context);
+		simerror("Could not allocate memory for instructions!");
+	}
+
+	operands_array = (sparc_operand*) &(instructions_array[instruction_size]);
+
+	/* convert opcodes to instruction data structures */
+	for (i = 0; i < instruction_size; i++) {
+
+		/* save instruction number and its operands */
 		instructions_array[i].instr_no = i;
+		instructions_array[i].operands = operands_array;
 
-		/* convert opcode to instruction data structure */
-		saveInstruction(opcode, &(instructions_array[i]));
+		saveInstruction(context, opcodes[i], &(instructions_array[i]));
+		operands_array += instructions_array[i].num_operands;
 
 	}
 
+	free(opcodes);
+
+}
+
+/**
+  * @brief Returns the number of instructions of the binary.
+  * @param[in] context The simulator context.
+  * @return Number of instructions.
+  */
+uint32_t getNumberOfInstructions(sim_context_t* context) {
+	return gen_simulator->getFileHeader(context)->instruction_size / 4;
 }
 
 /**
-  * @brief Returns the number of allocated instructions.
-  * @return Number of allocated instructions.
+  * @brief Returns the instruction set extensions of the target.
+  * @param[in] context The simulator context.
+  * @return Mask of TARGET_FEATURE_* bits.
   */
-uint32_t getNumberOfInstructions(void) {
-	return number_instructions;
+uint32_t getTargetFeatures(sim_context_t* context) {
+	return TARGET_FEATURES;
 }
 
 /**
@@ -831,6 +797,7 @@ int simulator_init(gen_simulator_t* simulator, error_fct_t error_fct) {
 	simulator->readInstructions = readInstructions;
 	simulator->checkTargetID = checkTargetID;
 	simulator->getNumberOfInstructions = getNumberOfInstructions;
+	simulator->getTargetFeatures = getTargetFeatures;
 
 	simerror = error_fct;
 	gen_simulator = simulator;
@@ -34,10 +34,11 @@
 
 #include "sparc_v8.h"
 
-/** Pointer to the generic simulator object. */
+/** 
+  * Pointer to the generic simulator object, shared by all simulator 
+  * contexts of this target. 
+  */
 static gen_simulator_t* gen_simulator;
-/** Save the number of instructions for cleanUp function. */
-static uint32_t number_instructions;
 
 /** Pointer to error function of simulator. */
 static error_fct_t simerror;
@@ -304,10 +305,12 @@ static int getOpcode(uint32_t opcode) {
 
 /**
   * @brief Saves the correct opcode and all operands of the current instruction.
+  * @param[in] context The simulator context.
   * @param[in] opcode The binary target specific opcode.
   * @param[in,out] instruction The instruction which shall be saved.
   */
-static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
+static void saveInstruction(sim_context_t* context, uint32_t opcode, 
+		sparc_instruction* instruction) {
 
 	int sim_opcode = getOpcode(opcode);
 	int dst_reg;
@@ -320,6 +323,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 	/* save opcode */
 	instruction->opcode = sim_opcode;
+	instruction->num_operands = 0;
 
 	/* save operands */
 	switch (sim_opcode) {
@@ -334,13 +338,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			}
 			/* save call displacement as operand */
 			instruction->num_operands = 1;
-			instruction->operands = malloc(sizeof(sparc_operand));
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 
 			instruction->operands[0].type = OPERAND_TYPE_LABEL_ADDRESS;
 			/* label address is (absolute) instruction number */
@@ -357,13 +354,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			icc = GET_CC(opcode);
 
 			instruction->num_operands = 2;
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 			
 			instruction->operands[0].type = OPERAND_TYPE_LABEL_ADDRESS;
 			/* label address is (absolute) instruction number */
@@ -390,14 +380,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 				instruction->num_operands = 2;
 
-				instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-				/* memory allocation OK? */
-				if (!(instruction->operands)) {
-					gen_simulator->cleanUp();
-					simerror("Could not allocate memory for instruction operands!");
-				}
-
 				instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 				instruction->operands[0].value.reg = dst_reg;
 
@@ -411,20 +393,12 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 			dst_reg = GET_RD(opcode);
 			src1_reg = GET_RS1(opcode);
 			if (src1_reg != Y_REGISTER_NO) {
-				gen_simulator->cleanUp();
+				gen_simulator->cleanUp(context);
 				simerror("Unknown source register for rd instruction!");
 			}
 
 			instruction->num_operands = 2;
 
-			instruction->operands = malloc(sizeof(sparc_operand)*2);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
-
 			instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 			instruction->operands[0].value.reg = dst_reg;
 
@@ -440,7 +414,7 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 		/* terminate on unkown instruction */
 		case UNKNOWN:
-			gen_simulator->cleanUp();
+			gen_simulator->cleanUp(context);
 			snprintf(errormsg, 100, "Encountered unknown opcode at instruction no %d!", 
 				instruction->instr_no);
 			simerror(errormsg);
@@ -454,13 +428,6 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 			instruction->num_operands = 3;			
 			
-			instruction->operands = malloc(sizeof(sparc_operand)*3);
-
-			/* memory allocation OK? */
-			if (!(instruction->operands)) {
-				gen_simulator->cleanUp();
-				simerror("Could not allocate memory for instruction operands!");
-			}
 
 			instruction->operands[0].type = OPERAND_TYPE_REGISTER;
 			instruction->operands[0].value.reg = dst_reg;
@@ -491,10 +458,11 @@ static void saveInstruction(uint32_t opcode, sparc_instruction* instruction) {
 
 /**
   * @brief Checks, whether the current file is supported by the specific target.
+  * @param[in] context The simulator context.
   * @return 0 on success, 1 otherwise
   */
-int checkTargetID(void) {
-	if (gen_simulator->getFileHeader()->target_id != TARGET_ID) {
+int checkTargetID(sim_context_t* context) {
+	if (gen_simulator->getFileHeader(context)->target_id != TARGET_ID) {
 		return 1;
 	} else {
 		return 0;
@@ -505,72 +473,111 @@ int checkTargetID(void) {
 /**
   * @brief Reads in target specific instructions from the given file 
   * and generates generic instruction for the simulator.
+  * @param[in,out] context The simulator context.
   * @param[in] instream File containing the instructions in binary format.
   */
-void readInstructions(FILE* instream) {
+void readInstructions(sim_context_t* context, FILE* instream) {
 	
-	uint32_t instruction_size = gen_simulator->getFileHeader()->instruction_size;
+	uint32_t instruction_size = gen_simulator->getFileHeader(context)->instruction_size;
 
-	sparc_instruction** instructions = gen_simulator->getInstructions();
+	sparc_instruction** instructions = gen_simulator->getInstructions(context);
 	sparc_instruction* instructions_array;
+	sparc_operand* operands_array;
 
-	uint32_t opcode;
+	uint32_t* opcodes;
+	sparc_instruction decoded;
+	sparc_operand scratch[MAX_OPERANDS];
+	uint32_t num_operands = 0;
 
 	uint32_t i, j;
 	int value;
 
 	/* all binary instructions have 4 bytes */
 	if (instruction_size % 4) {
-		gen_simulator->cleanUp();
+		gen_simulator->cleanUp(context);
 		simerror("Invalid instruction size: has to be a multiple of 4!");
 	} else {
 		instruction_size = instruction_size / 4;
 	}
 
-	/* allocate memory for instructions */
-	*instructions = malloc(sizeof(sparc_instruction)*(instruction_size));
-	instructions_array = *instructions;
-
-	if (!instructions_array) {
-		gen_simulator->cleanUp();
+	/* read in all opcodes first, the number of operands of an instruction
+	   is only known after decoding it */
+	opcodes = malloc(sizeof(uint32_t)*(instruction_size + 1));
+	if (!opcodes) {
+		gen_simulator->cleanUp(context);
 		simerror("Could not allocate memory for instructions!");
 	}
 
-	/* set number of allocated instructions */
-	number_instructions = instruction_size;
-
-	/* read in instructions */
 	for (i = 0; i < instruction_size; i++) {
 
 		/* clear current opcode */
-		opcode = 0;
+		opcodes[i] = 0;
 
 		/* read in opcode from current filestream */
 		for (j = 0; j < 4; j++) {
 			if ((value = fgetc(instream)) == EOF) {
-				gen_simulator->cleanUp();
+				free(opcodes);
+				gen_simulator->cleanUp(context);
 				simerror("Could not read from file!");
 			}
-			opcode <<= 8;
-			opcode |= (uint32_t) ((value) & 0xff);
+			opcodes[i] <<= 8;
+			opcodes[i] |= (uint32_t) ((value) & 0xff);
 		}
 
-		/* save instruction number */
+		/* count the operands of the instruction */
+		decoded.instr_no = i;
+		decoded.operands = scratch;
+		saveInstruction(context, opcodes[i], &decoded);
+		num_operands += decoded.num_operands;
+
+	}
+
+	/* allocate memory for instructions and their operands at once, 
+	   the operands are stored behind the instructions without gaps */
+	*instructions = malloc(sizeof(sparc_instruction)*instruction_size + 
+		sizeof(sparc_operand)*num_operands);
+	instructions_array = *instructions;
+
+	if (!instructions_array) {
+		free(opcodes);
+		gen_simulator->cleanUp(context);
+		simerror("Could not allocate memory for instructions!");
+	}
+
+	operands_array = (sparc_operand*) &(instructions_array[instruction_size]);
+
+	/* convert opcodes to instruction data structures */
+	for (i = 0; i < instruction_size; i++) {
+
+		/* save instruction number and its operands */
 		instructions_array[i].instr_no = i;
+		instructions_array[i].operands = operands_array;
 
-		/* convert opcode to instruction data structure */
-		saveInstruction(opcode, &(instructions_array[i]));
+		saveInstruction(context, opcodes[i], &(instructions_array[i]));
+		operands_array += instructions_array[i].num_operands;
 
 	}
 
+	free(opcodes);
+
+}
+
+/**
+  * @brief Returns the number of instructions of the binary.
+  * @param[in] context The simulator context.
+  * @return Number of instructions.
+  */
+uint32_t getNumberOfInstructions(sim_context_t* context) {
+	return gen_simulator->getFileHeader(context)->instruction_size / 4;
 }
 
 /**
-  * @brief Returns the number of allocated instructions.
-  * @return Number of allocated instructions.
+  * @brief Returns the instruction set extensions of the target.
+  * @param[in] context The simulator context.
+  * @return Mask of TARGET_FEATURE_* bits.
   */
-uint32_t getNumberOfInstructions(void) {
-	return number_instructions;
+uint32_t getTargetFeatures(sim_context_t* context) {
+	return TARGET_FEATURES;
 }
 
 /**
@@ -585,6 +592,7 @@ int simulator_init(gen_simulator_t* simulator, error_fct_t error_fct) {
 	simulator->readInstructions = readInstructions;
 	simulator->checkTargetID = checkTargetID;
 	simulator->getNumberOfInstructions = getNumberOfInstructions;
+	simulator->getTargetFeatures = getTargetFeatures;
 
 	simerror = error_fct;
 	gen_simulator = simulator;
@@ -0,0 +1,794 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/batch_main.c
+ *
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <setjmp.h>
+#include <pthread.h>
+
+#include "gen_simulator.h"
+
+/** Maximum length of a line of the manifest */
+#define MAX_LINE_LENGTH 1024
+/** Maximum length of the error message of a job */
+#define MAX_ERROR_LENGTH 256
+/** Number of supported targets */
+#define NUM_TARGETS 4
+
+/** Formats of the result file */
+typedef enum {
+	FORMAT_CSV = 0,
+	FORMAT_JSON
+} batch_format_t;
+
+/** Target plugin, loaded once for all jobs */
+typedef struct {
+	void*					lib_handle;
+	gen_simulator_t			simulator;
+} batch_target_t;
+
+/**
+  * Binary read for one target. Its context is never simulated, the
+  * contexts of all jobs share its decoded instructions and copy its
+  * data memory (see shareProgram()).
+  */
+typedef struct {
+	char*					binfile;
+	int						target;
+	sim_context_t*			context;
+} batch_program_t;
+
+/** Simulation of one line of the manifest and its results */
+typedef struct {
+	/* line of the manifest */
+	uint32_t				line;
+	batch_program_t*		program;
+	/* options as given in the manifest */
+	char*					options;
+	int						reference;
+	int						jit_mode;
+	char*					logfile;
+	char*					timingfile;
+
+	/* error message, if the job failed */
+	int						failed;
+	char					error[MAX_ERROR_LENGTH];
+	sim_results_t			results;
+	/* cycles of every region closed by a cycle print instruction */
+	uint64_t*				region_cycles;
+	uint32_t				num_regions;
+	uint32_t				max_regions;
+} batch_job_t;
+
+/**
+  * Jobs of a worker thread. The owner takes jobs from the tail, idle
+  * workers steal jobs from the head.
+  */
+typedef struct {
+	pthread_mutex_t			lock;
+	uint32_t*				jobs;
+	uint32_t				head;
+	uint32_t				tail;
+} batch_queue_t;
+
+/** Worker thread of the pool */
+typedef struct {
+	pthread_t				thread;
+	uint32_t				index;
+	batch_queue_t			queue;
+} batch_worker_t;
+
+/** Name of the current program. */
+static char* progname;
+/** Needed string for optarg() call. */
+char* optarg;
+
+/** Names of all supported targets */
+static const char* target_names[NUM_TARGETS] = {
+	"v8",
+	"v8-blockicc-movcc",
+	"v8-blockpreg-selcc",
+	"v8-blockicc-selcc"
+};
+
+/** Paths to all supported targets */
+static const char* sim_libraries[NUM_TARGETS] = {
+	"shared/libsim_sparc_v8.so",
+	"shared/libsim_sparc_v8-blockicc-movcc.so",
+	"shared/libsim_sparc_v8-blockpreg-selcc.so",
+	"shared/libsim_sparc_v8-blockicc-selcc.so"
+};
+
+/** Target plugins, loaded at their first use */
+static batch_target_t targets[NUM_TARGETS];
+
+/** Binaries of all jobs, each read once per target (at most one per job) */
+static batch_program_t* programs;
+static uint32_t num_programs;
+
+/** Jobs of the manifest */
+static batch_job_t* jobs;
+static uint32_t num_jobs;
+
+/** Worker threads */
+static batch_worker_t* workers;
+static uint32_t num_workers;
+
+/** Job of the current thread, whose errors do not terminate the program */
+static __thread batch_job_t* current_job;
+/** Return point for errors of the current job */
+static __thread sigjmp_buf job_error;
+
+/**
+  * @brief Prints out a usage message on the given file stream.
+  * @param[in] out The file stream where to write the message.
+  */
+void usage(FILE* out) {
+	fprintf(out, "Usage: %s [-i <manifest>] [-o <resultfile>] [-f csv|json] [-n <threads>]\n"
+		"\t-i\tRead the jobs from the manifest instead of stdin.\n"
+		"\t-o\tWrite the results to a file instead of stdout.\n"
+		"\t-f\tFormat of the results, default csv.\n"
+		"\t-n\tNumber of worker threads, default one per online processor.\n\n"
+		"Every line of the manifest is a job\n"
+		"\"<binfile> <target> [-r] [-j] [-d] [-o <logfile>] [-M <timingfile>]\",\n"
+		"the options are those of the simulator. Empty lines and lines starting with '#'\n"
+		"are ignored.\n\n", progname);
+}
+
+/**
+  * @brief Prints out an error message and terminates the program.
+  *        Errors of a job only terminate the job.
+  * @param[in] e Error message to be printed.
+  */
+void simerror(char* e) {
+
+	if (current_job) {
+		current_job->failed = 1;
+		snprintf(current_job->error, MAX_ERROR_LENGTH, "%s", e);
+		siglongjmp(job_error, 1);
+	}
+
+	fprintf(stderr, "%s: %s\n", progname, e);
+	exit(EXIT_FAILURE);
+}
+
+/**
+  * @brief Loads the plugin of the given target, if it is not yet loaded.
+  * @param[in] target Index of the target.
+  * @return The generic simulator of the target.
+  */
+static gen_simulator_t* loadTarget(int target) {
+
+	/* declare error string for dynamic opening of shared libraries */
+	char* dl_error;
+	/* function pointer to simulator init function */
+	simulator_init_fct_t init_fct;
+
+	if (targets[target].lib_handle) {
+		return &(targets[target].simulator);
+	}
+
+	/* open shared library */
+	targets[target].lib_handle = dlopen(sim_libraries[target], RTLD_LAZY);
+	if (!targets[target].lib_handle) {
+		fprintf(stderr, "%s\n", dlerror());
+		exit(EXIT_FAILURE);
+	}
+
+	/* get simulator init function */
+	*(void **) (&init_fct) = dlsym(targets[target].lib_handle, "simulator_init");
+	if ((dl_error = dlerror()) != NULL) {
+		fprintf(stderr, "%s: %s\n", progname, dl_error);
+		fprintf(stderr, "%s: Error when opening shared library %s!\n", progname, sim_libraries[target]);
+		exit(EXIT_FAILURE);
+	}
+
+	/* let simulator register its target specific and generic functions */
+	if (init_fct(&(targets[target].simulator), simerror)) {
+		simerror("Could not initialize target specific simulator correctly!");
+	}
+	if (gen_simulator_init(&(targets[target].simulator), simerror)) {
+		simerror("Could not initialize generic simulator correctly!");
+	}
+
+	return &(targets[target].simulator);
+}
+
+/**
+  * @brief Returns the program of the given binary and target, which is
+  *        read at its first use.
+  * @param[in] binfile Path of the binary file.
+  * @param[in] target Index of the target.
+  * @return The program.
+  */
+static batch_program_t* loadProgram(const char* binfile, int target) {
+
+	gen_simulator_t* simulator;
+	batch_program_t* program;
+	FILE* instream;
+	uint32_t i;
+
+	for (i = 0; i < num_programs; i++) {
+		if (programs[i].target == target && !strcmp(programs[i].binfile, binfile)) {
+			return &(programs[i]);
+		}
+	}
+
+	simulator = loadTarget(target);
+
+	program = &(programs[num_programs]);
+	program->binfile = strdup(binfile);
+	program->target = target;
+	program->context = gen_simulator_create_context(simulator);
+	if (!program->binfile || !program->context) {
+		simerror("Could not allocate memory for simulator context!");
+	}
+
+	instream = fopen(binfile, "r");
+	if (instream == NULL) {
+		fprintf(stderr, "%s: Could not open file \"%s\" for reading!\n", progname, binfile);
+		exit(EXIT_FAILURE);
+	}
+
+	simulator->readFileHeader(program->context, instream);
+	if ((simulator->checkTargetID(program->context))) {
+		fprintf(stderr, "%s: Target ID of \"%s\" not supported by target %s!\n",
+			progname, binfile, target_names[target]);
+		exit(EXIT_FAILURE);
+	}
+	simulator->readMemory(program->context, instream);
+	simulator->readInstructions(program->context, instream);
+
+	fclose(instream);
+
+	num_programs++;
+	return program;
+}
+
+/**
+  * @brief Reads all jobs of the manifest and their programs.
+  * @param[in] manifest The manifest.
+  */
+static void readManifest(FILE* manifest) {
+
+	char line[MAX_LINE_LENGTH];
+	char options[MAX_LINE_LENGTH];
+	char* saveptr;
+	char* token;
+	char* binfile;
+	batch_job_t* job;
+	uint32_t line_number = 0;
+	/* binaries are stored with their target, resolved after reading */
+	char** binfiles = 0;
+	int* job_targets = 0;
+	int target;
+	uint32_t i;
+
+	while (fgets(line, MAX_LINE_LENGTH, manifest)) {
+
+		line_number++;
+
+		binfile = strtok_r(line, " \t\r\n", &saveptr);
+		if (!binfile || binfile[0] == '#') {
+			continue;
+		}
+
+		jobs = realloc(jobs, (num_jobs + 1)*sizeof(batch_job_t));
+		binfiles = realloc(binfiles, (num_jobs + 1)*sizeof(char*));
+		job_targets = realloc(job_targets, (num_jobs + 1)*sizeof(int));
+		if (!jobs || !binfiles || !job_targets) {
+			simerror("Could not allocate memory for jobs!");
+		}
+		job = &(jobs[num_jobs]);
+		memset(job, 0, sizeof(batch_job_t));
+		job->line = line_number;
+		job->jit_mode = JIT_MODE_OFF;
+
+		/* check, whether valid target has been specified */
+		token = strtok_r(0, " \t\r\n", &saveptr);
+		target = -1;
+		for (i = 0; token && i < NUM_TARGETS; i++) {
+			if (!strcmp(token, target_names[i])) {
+				target = i;
+			}
+		}
+		if (target == -1) {
+			fprintf(stderr, "%s: No valid target has been specified in line %u of the manifest!\n",
+				progname, line_number);
+			exit(EXIT_FAILURE);
+		}
+
+		/* parse the options of the job */
+		options[0] = '\0';
+		while ((token = strtok_r(0, " \t\r\n", &saveptr))) {
+			if (!strcmp(token, "-r")) {
+				job->reference = 1;
+			} else if (!strcmp(token, "-j")) {
+				job->jit_mode = JIT_MODE_ON;
+			} else if (!strcmp(token, "-d")) {
+				job->jit_mode = JIT_MODE_CHECK;
+			} else if (!strcmp(token, "-o") && (job->logfile = strtok_r(0, " \t\r\n", &saveptr))) {
+				job->logfile = strdup(job->logfile);
+				strcat(options, options[0] ? " -o " : "-o ");
+				strcat(options, job->logfile);
+				continue;
+			} else if (!strcmp(token, "-M") && (job->timingfile = strtok_r(0, " \t\r\n", &saveptr))) {
+				job->timingfile = strdup(job->timingfile);
+				strcat(options, options[0] ? " -M " : "-M ");
+				strcat(options, job->timingfile);
+				continue;
+			} else {
+				fprintf(stderr, "%s: Unknown option \"%s\" in line %u of the manifest.\n",
+					progname, token, line_number);
+				exit(EXIT_FAILURE);
+			}
+			if (options[0]) {
+				strcat(options, " ");
+			}
+			strcat(options, token);
+		}
+		job->options = strdup(options);
+		binfiles[num_jobs] = strdup(binfile);
+		job_targets[num_jobs] = target;
+
+		num_jobs++;
+	}
+
+	/* read every binary once per target, there are at most as many 
+	   programs as jobs */
+	programs = malloc((num_jobs + 1)*sizeof(batch_program_t));
+	if (!programs) {
+		simerror("Could not allocate memory for programs!");
+	}
+	for (i = 0; i < num_jobs; i++) {
+		jobs[i].program = loadProgram(binfiles[i], job_targets[i]);
+		free(binfiles[i]);
+	}
+	free(binfiles);
+	free(job_targets);
+}
+
+/**
+  * @brief Saves the cycles of the regions which have been closed since
+  *        the last call.
+  * @param[in,out] job The job.
+  * @param[in] results The current results of the simulation.
+  */
+static void recordRegions(batch_job_t* job, const sim_results_t* results) {
+
+	/* only the last closed region is known, but the simulation stops
+	   after each cycle print */
+	if (results->regions == job->num_regions) {
+		return;
+	}
+
+	if (job->num_regions == job->max_regions) {
+		job->max_regions = job->max_regions ? 2*job->max_regions : 64;
+		job->region_cycles = realloc(job->region_cycles, job->max_regions*sizeof(uint64_t));
+		if (!job->region_cycles) {
+			simerror("Could not allocate memory for region cycles!");
+		}
+	}
+	job->region_cycles[(job->num_regions)++] = results->region_cycles;
+}
+
+/**
+  * @brief Simulates one job in a new context. Errors of the simulation
+  *        are saved in the job.
+  * @param[in,out] job The job.
+  * @param[in] nullstream Stream for the output of jobs without logfile.
+  */
+static void runJob(batch_job_t* job, FILE* nullstream) {
+
+	gen_simulator_t* simulator = &(targets[job->program->target].simulator);
+	sim_context_t* volatile context = 0;
+	FILE* volatile outstream = nullstream;
+	FILE* volatile timingstream = 0;
+	sim_results_t results;
+
+	current_job = job;
+
+	if (!sigsetjmp(job_error, 1)) {
+
+		context = gen_simulator_create_context(simulator);
+		if (!context) {
+			simerror("Could not allocate memory for simulator context!");
+		}
+
+		if (job->logfile) {
+			outstream = fopen(job->logfile, "w");
+			if (outstream == NULL) {
+				outstream = nullstream;
+				simerror("Could not open log file for writing!");
+			}
+		}
+
+		simulator->shareProgram(context, job->program->context);
+		simulator->resetSimulator(context);
+
+		if (job->timingfile) {
+			timingstream = fopen(job->timingfile, "r");
+			if (!timingstream) {
+				simerror("Could not open timing model file for reading!");
+			}
+			simulator->readTimingModel(context, timingstream);
+			fclose(timingstream);
+			timingstream = 0;
+		}
+
+		/* simulate until the end, stopping after each cycle print */
+		if (job->reference) {
+			while (simulator->simulateStep(context, outstream)) {
+				simulator->getResults(context, &results);
+				recordRegions(job, &results);
+			}
+		} else {
+			simulator->setJITMode(context, job->jit_mode);
+			while (simulator->run(context, outstream, 0, RUN_CYCLE_PRINT) != RUN_EXIT) {
+				simulator->getResults(context, &results);
+				recordRegions(job, &results);
+			}
+		}
+
+		simulator->getResults(context, &(job->results));
+		recordRegions(job, &(job->results));
+
+		if (job->logfile) {
+			fprintf(outstream, "\nFinished simulation...\n");
+			simulator->printResults(context, outstream);
+		}
+	}
+
+	current_job = 0;
+
+	if (context) {
+		gen_simulator_destroy_context(context);
+	}
+	if (outstream != nullstream) {
+		fclose(outstream);
+	}
+	if (timingstream) {
+		fclose(timingstream);
+	}
+}
+
+/**
+  * @brief Takes the next job of a worker, from the tail of its own
+  *        queue or from the head of another queue.
+  * @param[in,out] worker The worker.
+  * @param[out] job Index of the job.
+  * @return 1 if a job has been taken, 0 if all queues are empty.
+  */
+static int takeJob(batch_worker_t* worker, uint32_t* job) {
+
+	batch_queue_t* queue = &(worker->queue);
+	uint32_t i;
+	int found = 0;
+
+	pthread_mutex_lock(&(queue->lock));
+	if (queue->head != queue->tail) {
+		*job = queue->jobs[--(queue->tail)];
+		found = 1;
+	}
+	pthread_mutex_unlock(&(queue->lock));
+
+	/* jobs are never added, so all queues are empty after one
+	   unsuccessful round */
+	for (i = 1; !found && i < num_workers; i++) {
+		queue = &(workers[(worker->index + i) % num_workers].queue);
+		pthread_mutex_lock(&(queue->lock));
+		if (queue->head != queue->tail) {
+			*job = queue->jobs[(queue->head)++];
+			found = 1;
+		}
+		pthread_mutex_unlock(&(queue->lock));
+	}
+
+	return found;
+}
+
+/**
+  * @brief Main function of a worker thread, which simulates jobs as long
+  *        as there are any left.
+  * @param[in,out] arg The worker.
+  * @return Always 0.
+  */
+static void* workerMain(void* arg) {
+
+	batch_worker_t* worker = arg;
+	FILE* nullstream;
+	uint32_t job;
+
+	nullstream = fopen("/dev/null", "w");
+	if (nullstream == NULL) {
+		simerror("Could not open /dev/null for writing!");
+	}
+
+	while (takeJob(worker, &job)) {
+		runJob(&(jobs[job]), nullstream);
+	}
+
+	fclose(nullstream);
+	return 0;
+}
+
+/**
+  * @brief Distributes all jobs round robin among the workers and waits
+  *        until they are done.
+  */
+static void runWorkers(void) {
+
+	uint32_t i;
+
+	workers = calloc(num_workers, sizeof(batch_worker_t));
+	if (!workers) {
+		simerror("Could not allocate memory for worker threads!");
+	}
+
+	for (i = 0; i < num_workers; i++) {
+		workers[i].index = i;
+		pthread_mutex_init(&(workers[i].queue.lock), 0);
+		workers[i].queue.jobs = malloc((num_jobs / num_workers + 1)*sizeof(uint32_t));
+		if (!workers[i].queue.jobs) {
+			simerror("Could not allocate memory for worker threads!");
+		}
+	}
+
+	/* the manifest order is kept at the head of each queue, such
+	   that the first jobs start first */
+	for (i = num_jobs; i > 0; i--) {
+		workers[(i - 1) % num_workers].queue.jobs[(workers[(i - 1) % num_workers].queue.tail)++] = i - 1;
+	}
+
+	for (i = 0; i < num_workers; i++) {
+		if (pthread_create(&(workers[i].thread), 0, workerMain, &(workers[i]))) {
+			simerror("Could not create worker thread!");
+		}
+	}
+	for (i = 0; i < num_workers; i++) {
+		pthread_join(workers[i].thread, 0);
+	}
+
+	for (i = 0; i < num_workers; i++) {
+		pthread_mutex_destroy(&(workers[i].queue.lock));
+		free(workers[i].queue.jobs);
+	}
+	free(workers);
+}
+
+/**
+  * @brief Returns all stall cycles of the pipeline model.
+  * @param[in] results The results of a job.
+  * @return The load-use, control and store buffer stalls.
+  */
+static uint64_t stallCycles(const sim_results_t* results) {
+	return results->pipeline.load_use + results->pipeline.control + results->pipeline.store;
+}
+
+/**
+  * @brief Prints a string with the quoting of the given format.
+  * @param[in] out The file stream where to write the string.
+  * @param[in] s The string.
+  * @param[in] format The format of the result file.
+  */
+static void printQuoted(FILE* out, const char* s, batch_format_t format) {
+
+	fputc('"', out);
+	for (; *s; s++) {
+		if (*s == '"') {
+			fputs(format == FORMAT_CSV ? "\"\"" : "\\\"", out);
+		} else if (*s == '\\' && format == FORMAT_JSON) {
+			fputs("\\\\", out);
+		} else {
+			fputc(*s, out);
+		}
+	}
+	fputc('"', out);
+}
+
+/**
+  * @brief Prints the results of all jobs in manifest order.
+  * @param[in] out The file stream where to write the results.
+  * @param[in] format The format of the result file.
+  */
+static void printResults(FILE* out, batch_format_t format) {
+
+	batch_job_t* job;
+	uint32_t i, j;
+
+	if (format == FORMAT_CSV) {
+		fprintf(out, "binary,target,options,status,return_value,instructions,cycles,"
+			"icache_misses,dcache_misses,mispredictions,stall_cycles,region_cycles\n");
+	} else {
+		fprintf(out, "[\n");
+	}
+
+	for (i = 0; i < num_jobs; i++) {
+		job = &(jobs[i]);
+		if (format == FORMAT_CSV) {
+			printQuoted(out, job->program->binfile, format);
+			fprintf(out, ",%s,", target_names[job->program->target]);
+			printQuoted(out, job->options, format);
+			fputc(',', out);
+			printQuoted(out, job->failed ? job->error : "ok", format);
+			if (job->failed) {
+				fprintf(out, ",,,,,,,,\n");
+				continue;
+			}
+			fprintf(out, ",0x%08x,%llu,%llu,%llu,%llu,%llu,%llu,", job->results.return_value, 
+				(unsigned long long) job->results.instructions, 
+				(unsigned long long) job->results.cycles,
+				(unsigned long long) job->results.icache.misses,
+				(unsigned long long) job->results.dcache.misses,
+				(unsigned long long) job->results.branches.mispredictions,
+				(unsigned long long) stallCycles(&(job->results)));
+			for (j = 0; j < job->num_regions; j++) {
+				fprintf(out, j ? " %llu" : "%llu", (unsigned long long) job->region_cycles[j]);
+			}
+			fputc('\n', out);
+		} else {
+			fprintf(out, "  {\"binary\": ");
+			printQuoted(out, job->program->binfile, format);
+			fprintf(out, ", \"target\": \"%s\", \"options\": ", target_names[job->program->target]);
+			printQuoted(out, job->options, format);
+			fprintf(out, ", \"status\": ");
+			printQuoted(out, job->failed ? job->error : "ok", format);
+			if (!job->failed) {
+				fprintf(out, ", \"return_value\": %u, \"instructions\": %llu, \"cycles\": %llu, "
+					"\"icache_misses\": %llu, \"dcache_misses\": %llu, \"mispredictions\": %llu, "
+					"\"stall_cycles\": %llu, \"region_cycles\": [", job->results.return_value, 
+					(unsigned long long) job->results.instructions, 
+					(unsigned long long) job->results.cycles,
+					(unsigned long long) job->results.icache.misses,
+					(unsigned long long) job->results.dcache.misses,
+					(unsigned long long) job->results.branches.mispredictions,
+					(unsigned long long) stallCycles(&(job->results)));
+				for (j = 0; j < job->num_regions; j++) {
+					fprintf(out, j ? ", %llu" : "%llu", (unsigned long long) job->region_cycles[j]);
+				}
+				fputc(']', out);
+			}
+			fprintf(out, "}%s\n", (i + 1 < num_jobs) ? "," : "");
+		}
+	}
+
+	if (format == FORMAT_JSON) {
+		fprintf(out, "]\n");
+	}
+}
+
+int main(int argc, char** argv) {
+
+	FILE* manifest = stdin;
+	FILE* outstream = stdout;
+	batch_format_t format = FORMAT_CSV;
+	long threads = 0;
+	int failed = 0;
+	int opt;
+	uint32_t i;
+
+	/* make program name globally available */
+	progname = argv[0];
+
+	/* parse input options */
+	while ((opt = getopt(argc, argv, "hi:o:f:n:")) != -1) {
+		switch (opt) {
+			case 'i':
+				manifest = fopen(optarg, "r");
+				if (manifest == NULL) {
+					fprintf(stderr, "%s: Could not open file \"%s\" for reading!\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'o':
+				outstream = fopen(optarg, "w");
+				if (outstream == NULL) {
+					fprintf(stderr, "%s: Could not open file \"%s\" for writing!\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'f':
+				if (!strcmp(optarg, "csv")) {
+					format = FORMAT_CSV;
+				} else if (!strcmp(optarg, "json")) {
+					format = FORMAT_JSON;
+				} else {
+					fprintf(stderr, "%s: Unknown format \"%s\".\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'n':
+				threads = strtol(optarg, 0, 0);
+				if (threads <= 0) {
+					fprintf(stderr, "%s: Invalid number of threads \"%s\".\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'h':
+				usage(stdout);
+				exit(EXIT_SUCCESS);
+			default:
+				usage(stderr);
+				exit(EXIT_FAILURE);
+		}
+	}
+
+	readManifest(manifest);
+	if (manifest != stdin) {
+		fclose(manifest);
+	}
+
+	/* one worker per online processor, but not more than jobs */
+	if (!threads) {
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	num_workers = (threads > 0) ? (uint32_t) threads : 1;
+	if (num_workers > num_jobs) {
+		num_workers = num_jobs;
+	}
+
+	if (num_jobs) {
+		runWorkers();
+	}
+
+	printResults(outstream, format);
+	if (outstream != stdout) {
+		fclose(outstream);
+	}
+
+	/* clean up memory */
+	for (i = 0; i < num_jobs; i++) {
+		if (jobs[i].failed) {
+			fprintf(stderr, "%s: Job in line %u failed: %s\n", progname, jobs[i].line, jobs[i].error);
+			failed = 1;
+		}
+		free(jobs[i].options);
+		free(jobs[i].logfile);
+		free(jobs[i].timingfile);
+		free(jobs[i].region_cycles);
+	}
+	free(jobs);
+	for (i = 0; i < num_programs; i++) {
+		gen_simulator_destroy_context(programs[i].context);
+		free(programs[i].binfile);
+	}
+	free(programs);
+
+	/* close library handles */
+	for (i = 0; i < NUM_TARGETS; i++) {
+		if (targets[i].lib_handle && dlclose(targets[i].lib_handle)) {
+			fprintf(stderr, "%s: Could not close shared library!", progname);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	exit(failed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -24,111 +24,617 @@
  * THE SOFTWARE.
  */
 
+/* needed for anonymous memory mappings and siginfo */
+#define _DEFAULT_SOURCE
+
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include "sparc_target.h"
 #include "sparc_v8.h"
 #include "sparc.tab.h"
 #include "gen_simulator.h"
+#include "jit_x86_64.h"
+#include "sim_cache.h"
+#include "sim_branch.h"
+#include "sim_pipeline.h"
+#include "sim_calls.h"
+
+/** Size of the guard area, covers all 32 bit addresses */
+#if UINTPTR_MAX > 0xffffffffu
+#define DATA_MEMORY_GUARD_SIZE (((size_t) 1) << 32)
+#else
+#define DATA_MEMORY_GUARD_SIZE (((size_t) 1) << 24)
+#endif
+
+/*==========================*/
+/* Data memory accessors    */
+/*==========================*/
+
+/* The data memory holds the big endian byte image of the target,
+   words and halfwords are accessed as host-native values with a
+   single byte swap (the allocation is word aligned, callers check
+   the alignment of the address). */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define MEMORY_SWAP16(value) (value)
+#define MEMORY_SWAP32(value) (value)
+#else
+#define MEMORY_SWAP16(value) __builtin_bswap16(value)
+#define MEMORY_SWAP32(value) __builtin_bswap32(value)
+#endif
+
+#define MEMORY_HALF(address) (*((uint16_t*) &context->data_memory[(address)]))
+#define MEMORY_WORD(address) (*((uint32_t*) &context->data_memory[(address)]))
+
+#define LOAD_BYTE(address) ((uint32_t) context->data_memory[(address)])
+#define LOAD_SBYTE(address) ((uint32_t) (int8_t) context->data_memory[(address)])
+#define LOAD_HALF(address) ((uint32_t) MEMORY_SWAP16(MEMORY_HALF(address)))
+#define LOAD_SHALF(address) ((uint32_t) (int16_t) MEMORY_SWAP16(MEMORY_HALF(address)))
+#define LOAD_WORD(address) MEMORY_SWAP32(MEMORY_WORD(address))
+
+#define STORE_BYTE(address, value) \
+	(context->data_memory[(address)] = (uint8_t) (value))
+#define STORE_HALF(address, value) \
+	(MEMORY_HALF(address) = MEMORY_SWAP16((uint16_t) (value)))
+#define STORE_WORD(address, value) \
+	(MEMORY_WORD(address) = MEMORY_SWAP32((uint32_t) (value)))
+
+/** Terminates the simulation if the address is not aligned to mask+1. */
+#define CHECK_ALIGNMENT(address, mask, message) \
+	if ((address) & (mask)) { \
+		context->simulator->cleanUp(context); \
+		simerror(message); \
+	}
+/*=============================*/
+/* Regions                     */
+/*=============================*/
+
+/** Cycle histograms count values below CYCLE_HISTOGRAM_SUB exactly */
+#define CYCLE_HISTOGRAM_BITS 5
+/** Buckets per power of two of the cycle histograms */
+#define CYCLE_HISTOGRAM_SUB (1 << CYCLE_HISTOGRAM_BITS)
+/** Buckets of a cycle histogram, covering all 64 bit values */
+#define CYCLE_HISTOGRAM_SIZE ((64 - CYCLE_HISTOGRAM_BITS + 1)*CYCLE_HISTOGRAM_SUB)
+
+/*=============================*/
+/* Profile                     */
+/*=============================*/
+
+/** No block has been profiled yet */
+#define PROFILE_NONE UINT32_MAX
+/** Number of blocks in the hotspot report */
+#define PROFILE_HOTSPOTS 20
 
-/*==========================*/ 
-/* Internally used pointers */
-/*==========================*/ 
+/*=============================*/
+/* Snapshots                   */
+/*=============================*/
+
+/** Identifies snapshot files ("SNAP") */
+#define SNAPSHOT_MAGIC 0x534e4150
+/** Version of the snapshot file format, see writeSnapshot() */
+#define SNAPSHOT_VERSION 1
 
-/** Pointer to data memory of simulated processor. */
-static uint8_t* data_memory = 0;
-/** Size of data memory in bytes. */ 
-static uint32_t data_memory_size = 0;
 /** 
-  * Pointer to abstract instruction type of 
-  * simulated processor. 
+  * Processor state and data memory of a simulation. Snapshot files 
+  * contain the fields in this order in big endian format, preceded by 
+  * SNAPSHOT_MAGIC and SNAPSHOT_VERSION.
+  */
+struct sim_snapshot {
+	/* header of the simulated binary */
+	simulator_header_t			header;
+	/* hash of the instructions of the simulated binary */
+	uint32_t					program_hash;
+	uint32_t					glob_regs[8];
+	uint32_t					window_regs[NWINDOWS*16 + 8];
+	/* offset of the current window in window_regs */
+	uint32_t					window;
+	uint32_t					psr;
+	lazy_icc_state_t			lazy_icc;
+	uint32_t					y;
+	uint32_t					pc;
+	uint32_t					npc;
+	hwloop_processor_state_t	hwloop_state;
+	uint32_t					preg;
+	predicate_processor_state_t	pred_state;
+	uint64_t					cycle_counter;
+	uint64_t					cycle_counter_local;
+	uint64_t					cycle_counter_region;
+	uint32_t					cycle_regions;
+	uint64_t					instruction_counter;
+	uint32_t					region_start;
+	uint64_t					region_start_instructions;
+	uint32_t					memory_size;
+	uint8_t						memory[];
+};
+
+/*=====================================*/
+/* Threaded code engine declarations   */
+/*=====================================*/
+
+/**
+  * List of all handlers of the threaded code engine. Every handler 
+  * executes one opcode in one specific operand form, e.g. ADD_R for
+  * register and ADD_I for immediate source operand 2. All instructions
+  * without a specialized handler are executed by the reference
+  * interpreter via the FALLBACK handler.
+  */
+#define THREADED_FORMS(H, op) H(op##_R) H(op##_I)
+#define THREADED_HANDLERS(H) \
+	H(FALLBACK) H(NOP) H(SETHI) H(CALL) H(BA) H(BN) H(BICC) \
+	H(CYCLE_PRINT) H(CYCLE_CLEAR) H(RD_Y) H(MOV) \
+	H(SEL_RR) H(SEL_RI) H(SEL_II) \
+	H(HWLOOP_S) H(HWLOOP_E) H(HWLOOP_B_R) H(HWLOOP_B_I) H(HWLOOP_START) \
+	H(PREDBEGIN_ICC) H(PREDBEGIN_PREG) H(PREDEND) \
+	H(PREDSET) H(PREDSET_ICC) H(PREDCLEAR) H(BLOCK_END) \
+	THREADED_FORMS(H, AND) THREADED_FORMS(H, ANDCC) \
+	THREADED_FORMS(H, ANDN) THREADED_FORMS(H, ANDNCC) \
+	THREADED_FORMS(H, OR) THREADED_FORMS(H, ORCC) \
+	THREADED_FORMS(H, ORN) THREADED_FORMS(H, ORNCC) \
+	THREADED_FORMS(H, XOR) THREADED_FORMS(H, XORCC) \
+	THREADED_FORMS(H, XNOR) THREADED_FORMS(H, XNORCC) \
+	THREADED_FORMS(H, SLL) THREADED_FORMS(H, SRL) THREADED_FORMS(H, SRA) \
+	THREADED_FORMS(H, ADD) THREADED_FORMS(H, ADDCC) \
+	THREADED_FORMS(H, ADDX) THREADED_FORMS(H, ADDXCC) \
+	THREADED_FORMS(H, SUB) THREADED_FORMS(H, SUBCC) \
+	THREADED_FORMS(H, SUBX) THREADED_FORMS(H, SUBXCC) \
+	THREADED_FORMS(H, UMUL) THREADED_FORMS(H, UMULCC) \
+	THREADED_FORMS(H, SMUL) THREADED_FORMS(H, SMULCC) \
+	THREADED_FORMS(H, UDIV) THREADED_FORMS(H, UDIVCC) \
+	THREADED_FORMS(H, SDIV) THREADED_FORMS(H, SDIVCC) \
+	THREADED_FORMS(H, SAVE) THREADED_FORMS(H, RESTORE) \
+	THREADED_FORMS(H, JUMPL) THREADED_FORMS(H, WR) \
+	THREADED_FORMS(H, LDSB) THREADED_FORMS(H, LDSH) \
+	THREADED_FORMS(H, LDUB) THREADED_FORMS(H, LDUH) THREADED_FORMS(H, LD) \
+	THREADED_FORMS(H, STB) THREADED_FORMS(H, STH) THREADED_FORMS(H, ST) \
+	H(SETHI_OR_I) H(SLL_I_ADD_R) H(SUBCC_R_BICC) H(SUBCC_I_BICC) \
+	H(JUMPL_I_RESTORE_R) H(JUMPL_I_RESTORE_I)
+
+#define THREADED_ENUM(name) THREADED_##name,
+/** Identifiers of all handlers of the threaded code engine. */
+typedef enum {
+	THREADED_HANDLERS(THREADED_ENUM)
+	THREADED_NUM_HANDLERS
+} threaded_handler_t;
+#undef THREADED_ENUM
+
+/**
+  * Pre-decoded instruction of the threaded code engine. All operand
+  * types are resolved at load time, such that a handler only has to
+  * fetch its register values.
+  */
+typedef struct {
+	/** Address of the handler executing this instruction */
+	void*			handler;
+	/** Destination register (source register for stores) */
+	uint8_t			rd;
+	/** Source 1 register (or predicate register) */
+	uint8_t			rs1;
+	/** Source 2 register (or true/false bit, or second immediate) */
+	uint8_t			rs2;
+	/** Integer condition code of conditional instructions */
+	uint8_t			icc;
+	/** Sign extended immediate or target word address */
+	uint32_t		imm;
+} threaded_instruction_t;
+
+/**
+  * Basic block of the threaded code engine. The handler sequence of a
+  * block is executed without any lookup and is terminated by a 
+  * BLOCK_END handler which follows the chained successor blocks.
   */
-static sparc_instruction* instructions = 0;
+typedef struct threaded_block {
+	/** Word address of the first instruction */
+	uint32_t				start;
+	/** Number of instructions of the block */
+	uint32_t				length;
+	/** Summed cycles of all instructions, charged once per block */
+	uint32_t				cycles;
+	/** Number of instructions counted once per block */
+	uint32_t				instructions;
+	/** Stall cycles between the instructions of the block, included in cycles */
+	uint32_t				load_use_stalls;
+	uint32_t				control_stalls;
+	/** 
+	  * Cycles from the block entry to the end of each instruction, 
+	  * without fallback instructions, 0 if there is no store buffer
+	  */
+	uint32_t*				offsets;
+	/** Handler sequence of the block, terminated by BLOCK_END */
+	threaded_instruction_t*	code;
+	/** Chained successor for the taken branch/jump target */
+	struct threaded_block*	taken;
+	/** Chained successor for the fall-through path */
+	struct threaded_block*	fallthrough;
+	/** Number of executions until the block is compiled */
+	uint32_t				executions;
+	/** Compiled host code of the block, 0 if not compiled */
+	jit_block_fct_t			native;
+} threaded_block_t;
 
 /** 
-  * Header of the binary file. Contains target-id,
-  * memory size and instruction size.
+  * Pre-decoded instructions and blocks of a core which is not the 
+  * current core of a context, see fastForward()
   */
-static simulator_header_t header;
+typedef struct {
+	threaded_instruction_t*	code;
+	uint8_t*				leaders;
+	threaded_block_t**		blocks;
+	threaded_block_t**		steps;
+	run_fct_t				core;
+} threaded_engine_t;
 
-/** Pointer to generic simulator object. */
-static gen_simulator_t* gen_simulator = 0;
 
-/** Pointer to simulator error function. */
-static error_fct_t simerror = 0;
+/** Processor state saved for the differential check of compiled blocks */
+typedef struct {
+	uint32_t		glob_regs[8];
+	uint32_t		window_regs[NWINDOWS*16 + 8];
+	uint32_t*		window;
+	uint32_t		psr;
+	lazy_icc_state_t	lazy_icc;
+	uint32_t		y;
+	uint8_t*		memory;
+} jit_check_state_t;
 
 /*=============================*/
-/* Sparc register declarations */
+/* Simulator context           */
 /*=============================*/
-/** Sparc processor state register */
-static uint32_t sparc_psr = PSR_INIT_MASK;
+
+/**
+  * Complete state of one simulation. Every function of the generic 
+  * simulator works on the context it is given, so independent contexts
+  * may be simulated concurrently by different host threads.
+  */
+struct sim_context {
+	/** Generic simulator object with the functions of the target */
+	gen_simulator_t*		simulator;
+
+	/** Header of the binary file: target-id, memory and instruction size */
+	simulator_header_t		header;
+	/** Abstract instructions of the simulated processor */
+	sparc_instruction*		instructions;
+	/** Instructions are owned by another context (see shareProgram()) */
+	int						instructions_shared;
+
+	/** Data memory of the simulated processor */
+	uint8_t*				data_memory;
+	/** Size of data memory in bytes */
+	uint32_t				data_memory_size;
+	/** 
+	  * Mapping which contains the data memory at the end of its 
+	  * accessible pages, followed by inaccessible guard pages. Every 32 
+	  * bit address beyond the data memory hits a guard page (see 
+	  * memoryFault()).
+	  */
+	uint8_t*				data_memory_mapping;
+	/** Size of the data memory mapping in bytes */
+	size_t					data_memory_mapping_size;
+	/** 
+	  * First instruction and number of instructions which are currently
+	  * executed (block or single step), to locate a faulting memory access
+	  */
+	uint32_t				fault_start;
+	uint32_t				fault_length;
+	/** Data memory address of the last memory fault */
+	uint32_t				fault_address;
+	/** Where memoryFault() continues after a fault, see run() */
+	sigjmp_buf				fault_jump;
+
+	/** Sparc processor state register */
+	uint32_t				psr;
+	/** 
+	  * Last icc setting operation, the icc of the psr are only 
+	  * calculated when they are read (see materializeICC()) 
+	  */
+	lazy_icc_state_t		lazy_icc;
+	/** Sparc Y register for multiply/divide operations */
+	uint32_t				y;
+	/** Sparc program counter */
+	uint32_t				pc;
+	/** Sparc next program counter */
+	uint32_t				npc;
+	/** Sparc global general purpose registers */
+	uint32_t				glob_regs[8];
+	/** 
+	  * Sparc windowed registers: out and local registers of each window
+	  * (16 words per window), followed by a copy of the out registers of
+	  * window 0 which are the in registers of the last window 
+	  */
+	uint32_t				window_regs[NWINDOWS*16 + 8];
+	/** Out, local and in registers of the current window (CWP*16 offset) */
+	uint32_t*				window;
+	/** Sparc hardware loop state register */
+	hwloop_processor_state_t	hwloop_state;
+	/** Sparc predicate register for predicated blocks/instructions */
+	uint32_t				preg;
+	/** Sparc processor predication state register */
+	predicate_processor_state_t	pred_state;
+	/** Cycles of each instruction class (see readTimingModel()) */
+	uint32_t				timing[TIMING_NUM_CLASSES];
+	/** Sparc cycle counter for simulation */
+	uint64_t				cycle_counter;
+	/** local cycle counter which may be printed out */
+	uint64_t				cycle_counter_local;
+	/** Cycles of the region closed by the last cycle print */
+	uint64_t				cycle_counter_region;
+	/** Number of regions closed by cycle prints */
+	uint32_t				cycle_regions;
+	/** Number of executed instructions */
+	uint64_t				instruction_counter;
+	/** 
+	  * Word address of the cycle clear/print instruction which opened 
+	  * the current region, REGION_START_PROGRAM before the first one 
+	  */
+	uint32_t				region_start;
+	/** Instruction counter at the start of the current region */
+	uint64_t				region_start_instructions;
+	/** Cache statistics at the start of the current region */
+	sim_cache_stats_t		region_start_icache;
+	sim_cache_stats_t		region_start_dcache;
+	/** Accumulated executions of all regions, in order of their first execution */
+	sim_region_t*			regions;
+	uint32_t				num_regions;
+	uint32_t				max_regions;
+	/** 
+	  * Cycle histograms of all regions, CYCLE_HISTOGRAM_SIZE buckets per
+	  * region, 0 if not collected (see setCycleStatistics())
+	  */
+	uint64_t*				region_histograms;
+	/** Regions are not accounted while fast-forwarding */
+	int						functional;
+	/** 
+	  * Instruction and data cache models, disabled if their tags are 0
+	  * (see readTimingModel())
+	  */
+	cache_t					icache;
+	cache_t					dcache;
+	/** Predictor of conditional branches (see readTimingModel()) */
+	predictor_t				predictor;
+	/** Interlocks and store buffer of the pipeline (see readTimingModel()) */
+	pipeline_t				pipeline;
+	/** 
+	  * Miss penalties of the instruction cache, which are charged when a
+	  * block is entered and are therefore not part of the time of stores
+	  */
+	uint64_t				fetch_cycles;
+	/** 
+	  * Statistics of each conditional branch, indexed by its word address,
+	  * allocated at the first predicted branch
+	  */
+	sim_branch_stats_t*		branch_stats;
+
+	/** Pre-decoded instruction stream, built at first simulation */
+	threaded_instruction_t*	threaded_code;
+	/** Block leaders: targets of branches/calls and hardware loop labels */
+	uint8_t*				threaded_leaders;
+	/** Block cache, keyed by the start word address of a block */
+	threaded_block_t**		threaded_blocks;
+	/** 
+	  * Single instruction blocks for an entry with npc != pc + 1, 
+	  * e.g. the target of a control transfer in a delay slot 
+	  */
+	threaded_block_t**		threaded_steps;
+	/** Core of the target, selected at the first run */
+	run_fct_t				run_core;
+	/** 
+	  * Core without cache, predictor and pipeline models and its threaded
+	  * code, exchanged with the current core while fast-forwarding
+	  */
+	threaded_engine_t		functional_engine;
+
+	/** Events of the current run() call (RUN_CYCLE_PRINT, RUN_CYCLE_CLEAR) */
+	uint32_t				run_events;
+	/** 
+	  * Executed instructions of each block, indexed by the word address
+	  * of its first instruction, 0 if not counted (see setBlockCounts()) 
+	  */
+	uint32_t*				block_counts;
+	/** 
+	  * Profile indexed by word address, 0 if not profiled (see 
+	  * setProfiling()): entries of blocks starting at an address, exits
+	  * of blocks ending at an address and cycles of the blocks starting
+	  * at an address. All three share one allocation.
+	  */
+	uint64_t*				profile_entries;
+	uint64_t*				profile_exits;
+	uint64_t*				profile_cycles;
+	/** Start of the block which the current cycles are attributed to */
+	uint32_t				profile_pc;
+	/** Cycle counter when the current block was entered */
+	uint64_t				profile_start;
+	/** Shadow call stack, no nodes if calls are not traced (see setCallTracing()) */
+	call_stack_t			calls;
+	/** Breakpoint flags, one per instruction, allocated at first breakpoint */
+	uint8_t*				run_breakpoints;
+	/** Number of set breakpoints */
+	uint32_t				run_num_breakpoints;
+
+	/** Mode of the just-in-time compiler for hot blocks */
+	int						jit_mode;
+	/** Processor state accessed by compiled blocks and their arena */
+	jit_environment_t		jit_env;
+	/** State before and after the compiled block under check */
+	jit_check_state_t		jit_check_before;
+	jit_check_state_t		jit_check_after;
+	/** Block which is currently executed a second time by the handlers */
+	threaded_block_t*		jit_check_block;
+	/** Next program counter returned by the compiled block under check */
+	uint32_t				jit_check_pc;
+};
+
+/** Pointer to simulator error function, shared by all contexts. */
+static error_fct_t simerror = 0;
+
+/** Previous SIGSEGV action, for faults outside of any data memory */
+static struct sigaction data_memory_fault_action;
+/** Whether memoryFault() is installed as SIGSEGV handler */
+static int fault_handler_installed = 0;
+/** Context simulated by the current host thread, see memoryFault() */
+static __thread sim_context_t* fault_context = 0;
+
 /** Sparc window invalid mask register */
 static const uint32_t sparc_wim = WIM_MASK;
-/** Sparc Y register for multiply/divide operations */
-static uint32_t sparc_y = 0;
-/** Sparc program counter */
-static uint32_t sparc_pc = 0;
-/** Sparc next program counter */
-static uint32_t sparc_npc = 1;
-
-/** Sparc global general purpose registers */
-static uint32_t sparc_glob_regs[8];
-/** Sparc local general purpose registers */
-static uint32_t sparc_local_regs[NWINDOWS][8];
-/** Sparc input/output global registers */
-static uint32_t sparc_inout_regs[NWINDOWS][8];
-/** Representing the registers of current window */
-static uint32_t* sparc_window_registers[32];
-
-/** Sparc hardware loop state register */
-static hwloop_processor_state_t sparc_hwloop_state;
-
-/** Sparc predicate register for predicated blocks/instructions */
-static uint32_t	sparc_preg;
-/** Sparc processor predication state register */
-static predicate_processor_state_t sparc_pred_state;
-
-/** Sparc cycle counter for simulation */
-static uint32_t sparc_cycle_counter = 0;
-/** local cycle counter which may be printed out */
-static uint32_t sparc_cycle_counter_local = 0;
+
+/** Sparc register r of the current window of the context */
+#define SPARC_REGISTER(r) \
+	(*((r) < 8 ? &(context->glob_regs[(r)]) : &(context->window[(r) - 8])))
 
 /**
-  * @brief Frees all allocated memory for instructions and data memory.
+  * @brief Frees a block of the threaded code engine.
+  * @param[in] block The block to be freed, may be 0.
+  */
+static void freeBlock(threaded_block_t* block) {
+	if (block) {
+		free(block->code);
+		free(block->offsets);
+		free(block);
+	}
+}
+
+/**
+  * @brief Frees the pre-decoded instructions and the block cache of the
+  *        current core of the threaded code engine.
+  * @param[in,out] context The simulator context.
   */
-void cleanUp() {
+static void freeThreadedCode(sim_context_t* context) {
 
 	uint32_t i;
 
+	if (context->threaded_blocks) {
+		for (i = 0; i < context->simulator->getNumberOfInstructions(context); i++) {
+			freeBlock(context->threaded_blocks[i]);
+			freeBlock(context->threaded_steps[i]);
+		}
+		free(context->threaded_blocks);
+		free(context->threaded_steps);
+		context->threaded_blocks = 0;
+		context->threaded_steps = 0;
+	}
+	if (context->threaded_code) {
+		free(context->threaded_code);
+		context->threaded_code = 0;
+	}
+	if (context->threaded_leaders) {
+		free(context->threaded_leaders);
+		context->threaded_leaders = 0;
+	}
+}
+
+/**
+  * @brief Exchanges the current core and its threaded code with the 
+  *        core of the functional engine.
+  * @param[in,out] context The simulator context.
+  */
+static void swapEngine(sim_context_t* context) {
+
+	threaded_engine_t engine = context->functional_engine;
+
+	context->functional_engine.code = context->threaded_code;
+	context->functional_engine.leaders = context->threaded_leaders;
+	context->functional_engine.blocks = context->threaded_blocks;
+	context->functional_engine.steps = context->threaded_steps;
+	context->functional_engine.core = context->run_core;
+
+	context->threaded_code = engine.code;
+	context->threaded_leaders = engine.leaders;
+	context->threaded_blocks = engine.blocks;
+	context->threaded_steps = engine.steps;
+	context->run_core = engine.core;
+}
+
+/**
+  * @brief Frees all allocated memory for instructions and data memory.
+  * @param[in,out] context The simulator context.
+  */
+void cleanUp(sim_context_t* context) {
+
+	/* an error may have left the simulation of the context, faults of 
+	   this thread must not refer to it anymore */
+	if (fault_context == context) {
+		fault_context = 0;
+	}
+
 	/* frees all data memory */
-	if (data_memory) {
-		free(data_memory);
-		data_memory = 0;
+	if (context->data_memory_mapping) {
+		munmap(context->data_memory_mapping, context->data_memory_mapping_size);
+		context->data_memory_mapping = 0;
+		context->data_memory = 0;
 	}
 
-	/* free instruction operands */
-	for (i = 0; i < gen_simulator->getNumberOfInstructions(); i++) {
-		if (instructions[i].operands) {
-			free(instructions[i].operands);
-		}
+	/* free threaded code of the current core and of the fast-forwarding core */
+	freeThreadedCode(context);
+	swapEngine(context);
+	freeThreadedCode(context);
+
+	/* free compiled blocks and check states */
+	jitCleanUp(&(context->jit_env));
+	if (context->jit_check_before.memory) {
+		free(context->jit_check_before.memory);
+		context->jit_check_before.memory = 0;
+	}
+	if (context->jit_check_after.memory) {
+		free(context->jit_check_after.memory);
+		context->jit_check_after.memory = 0;
+	}
+
+	/* free breakpoints */
+	if (context->run_breakpoints) {
+		free(context->run_breakpoints);
+		context->run_breakpoints = 0;
+		context->run_num_breakpoints = 0;
+	}
+
+	/* free region table */
+	if (context->regions) {
+		free(context->regions);
+		context->regions = 0;
+		context->num_regions = 0;
+		context->max_regions = 0;
+	}
+	if (context->region_histograms) {
+		free(context->region_histograms);
+		context->region_histograms = 0;
+	}
+	if (context->profile_entries) {
+		free(context->profile_entries);
+		context->profile_entries = 0;
+	}
+	callsFree(&(context->calls));
+
+	/* free cache models and branch predictor */
+	cacheFree(&(context->icache));
+	cacheFree(&(context->dcache));
+	predictorFree(&(context->predictor));
+	pipelineFree(&(context->pipeline));
+	if (context->branch_stats) {
+		free(context->branch_stats);
+		context->branch_stats = 0;
 	}
 
-	/* free instructions */
-	if (instructions) {
-		free(instructions);
-		instructions = 0;
+	/* free instructions (including their operands), unless they belong
+	   to another context */
+	if (context->instructions) {
+		if (!context->instructions_shared) {
+			free(context->instructions);
+		}
+		context->instructions = 0;
+		context->instructions_shared = 0;
 	}
 }
 
 /**
   * @brief Reads the file first 10 bytes of the given binary file 
   *        and saves them in the corresponding header fields.
+  * @param[in,out] context The simulator context.
   * @input[in] instream The binary file which will be simulated.
   * @note The binary data of the file is saved in big endian format.
   */
-void readFileHeader(FILE* instream) {
+void readFileHeader(sim_context_t* context, FILE* instream) {
 
 	uint16_t target_id = 0;
 	uint32_t memory_size = 0;
@@ -139,213 +645,1109 @@ void readFileHeader(FILE* instream) {
 	/* first two bytes determine target id */
 	for (i = 0; i < 2; i++) {
 		if ((value = fgetc(instream)) == EOF) {
-			cleanUp();
+			cleanUp(context);
 			simerror("Could not read from file!");
 		}
 		target_id <<= 8;
 		target_id |= (uint16_t) ((value) & 0xff);
 	}
 
-	header.target_id = target_id;
+	context->header.target_id = target_id;
 
 	/* next four bytes determine memory size in bytes */
 	for (i = 0; i < 4; i++) {
 		if ((value = fgetc(instream)) == EOF) {
-			cleanUp();
+			cleanUp(context);
 			simerror("Could not read from file!");
 		}
 		memory_size <<= 8;
 		memory_size |= (uint32_t) ((value) & 0xff);
 	}
 
-	header.memory_size = memory_size;
+	context->header.memory_size = memory_size;
 
 	/* last four bytes determine size of instruction memory
 	   in bytes */
 	for (i = 0; i < 4; i++) {
 		if ((value = fgetc(instream)) == EOF) {
-			cleanUp();
+			cleanUp(context);
 			simerror("Could not read from file!");
 		}
 		instruction_size <<= 8;
 		instruction_size |= (uint32_t) ((value) & 0xff);
 	}
 
-	header.instruction_size = instruction_size;
+	context->header.instruction_size = instruction_size;
+}
+
+/**
+  * @brief Returns the mnemonic of a load or store instruction.
+  * @param[in] opcode Opcode of the instruction.
+  * @return The mnemonic, or 0 if the instruction does not access memory.
+  */
+static const char* memoryOpcodeName(int opcode) {
+	switch (opcode) {
+		case LDSB:	return "ldsb";
+		case LDSH:	return "ldsh";
+		case LDUB:	return "ldub";
+		case LDUH:	return "lduh";
+		case LD:	return "ld";
+		case LDSBA:	return "ldsba";
+		case LDSHA:	return "ldsha";
+		case LDUBA:	return "lduba";
+		case LDUHA:	return "lduha";
+		case LDA:	return "lda";
+		case STB:	return "stb";
+		case STH:	return "sth";
+		case ST:	return "st";
+		case STBA:	return "stba";
+		case STHA:	return "stha";
+		case STA:	return "sta";
+		default:	return 0;
+	}
+}
+
+/**
+  * @brief Returns whether an instruction writes a register of the 
+  *        current window, as seen before the instruction.
+  * @param[in] instruction The instruction.
+  * @param[in] reg Sparc register number.
+  * @return 1 if the register may be written, 0 otherwise.
+  */
+static int writesRegister(sparc_instruction* instruction, int reg) {
+	switch (instruction->opcode) {
+		/* all but the global registers change with the window */
+		case SAVE:
+		case RESTORE:
+			return reg >= 8;
+		case CALL:
+			return reg == CALL_ADDR_REGISTER;
+		case STB: case STH: case ST: case STD:
+		case STBA: case STHA: case STA: case STDA:
+			return 0;
+		default:
+			return instruction->num_operands > 0 && 
+				instruction->operands[0].type == OPERAND_TYPE_REGISTER &&
+				instruction->operands[0].value.reg == reg;
+	}
+}
+
+/**
+  * @brief Returns whether a load or store instruction accesses the 
+  *        address of the last memory fault with the current registers.
+  * @param[in] context The simulator context.
+  * @param[in] instruction The instruction.
+  * @return 1 if the instruction may have faulted, 0 otherwise.
+  */
+static int accessesFaultAddress(sim_context_t* context, sparc_instruction* instruction) {
+
+	sparc_operand* operands = instruction->operands;
+	uint32_t address;
+
+	if (!memoryOpcodeName(instruction->opcode)) {
+		return 0;
+	}
+	address = SPARC_REGISTER(operands[1].value.reg);
+	if (operands[2].type == OPERAND_TYPE_REGISTER) {
+		address += SPARC_REGISTER(operands[2].value.reg);
+	} else {
+		address += operands[2].value.simm13;
+	}
+	/* the host may report any byte of a word access */
+	return context->fault_address - address < 4;
+}
+
+/**
+  * @brief Handler for host memory faults. Accesses beyond the data memory
+  *        hit the guard pages of the mapping. The handler only records 
+  *        the address and leaves the simulation by the jump buffer of
+  *        the context, where the fault is reported outside of the 
+  *        signal context (see reportMemoryFault()).
+  * @param[in] signal The signal number (SIGSEGV).
+  * @param[in] info Information about the fault.
+  * @param[in] host_context Host context (unused).
+  */
+static void memoryFault(int signal, siginfo_t* info, void* host_context) {
+
+	sim_context_t* context = fault_context;
+	uint8_t* host_address = (uint8_t*) info->si_addr;
+
+	/* faults outside of the data memory are no simulation errors, the
+	   instruction faults again with the previous action */
+	if (!context || !context->data_memory_mapping || host_address < context->data_memory || 
+		host_address >= context->data_memory_mapping + context->data_memory_mapping_size) {
+		sigaction(SIGSEGV, &data_memory_fault_action, 0);
+		return;
+	}
+
+	context->fault_address = (uint32_t) (host_address - context->data_memory);
+	siglongjmp(context->fault_jump, 1);
+}
+
+/**
+  * @brief Terminates the simulation after a memory fault with the 
+  *        faulting instruction and address. The registers still contain
+  *        the operands of the faulting access, so it is located by 
+  *        recomputing the addresses of the memory instructions which 
+  *        are currently executed. An earlier access only computes the 
+  *        same address if its registers have been written before the 
+  *        faulting one, so the first access whose registers are not 
+  *        written up to the last matching access is reported.
+  * @param[in,out] context The simulator context.
+  */
+static void reportMemoryFault(sim_context_t* context) {
+
+	char message[128];
+	sparc_instruction* instructions = context->instructions;
+	sparc_operand* operands;
+	uint32_t start = context->fault_start;
+	uint32_t end = context->fault_start + context->fault_length;
+	uint32_t last = end;
+	uint32_t i;
+	uint32_t j;
+	sigset_t signals;
+
+	fault_context = 0;
+
+	/* the jump buffer does not save the signal mask, the fault 
+	   handler left SIGSEGV blocked */
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGSEGV);
+	sigprocmask(SIG_UNBLOCK, &signals, 0);
+
+	for (i = start; i < end; i++) {
+		if (accessesFaultAddress(context, &instructions[i])) {
+			last = i;
+		}
+	}
+	for (i = start; i <= last && last < end; i++) {
+		if (!accessesFaultAddress(context, &instructions[i])) {
+			continue;
+		}
+		operands = instructions[i].operands;
+		for (j = i; j < last; j++) {
+			if (writesRegister(&instructions[j], operands[1].value.reg) ||
+				(operands[2].type == OPERAND_TYPE_REGISTER && 
+				writesRegister(&instructions[j], operands[2].value.reg))) {
+				break;
+			}
+		}
+		if (j == last) {
+			snprintf(message, sizeof(message), "Memory fault: %s at pc 0x%08x "
+				"accesses address 0x%08x!", memoryOpcodeName(instructions[i].opcode), 
+				i << 2, context->fault_address);
+			context->simulator->cleanUp(context);
+			simerror(message);
+		}
+	}
+
+	snprintf(message, sizeof(message), "Memory fault: access to address "
+		"0x%08x in block at pc 0x%08x!", context->fault_address, start << 2);
+	context->simulator->cleanUp(context);
+	simerror(message);
+}
+
+/**
+  * @brief Allocates the data memory for the memory size of the header,
+  *        followed by its guard pages.
+  * @param[in,out] context The simulator context.
+  */
+static void allocateMemory(sim_context_t* context) {
+
+	size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+	size_t accessible_size;
+
+	context->data_memory_size = context->header.memory_size + FREE_MEMORY_SIZE;
+	/* clear last two bits such that memory is always multiple 
+	   of 4 bytes */
+	context->data_memory_size &= 0xfffffffc;
+
+	/* reserve the memory and the guard pages, and place the data 
+	   memory at the end of the accessible pages (it stays word 
+	   aligned), such that the first byte beyond it faults */
+	accessible_size = (context->data_memory_size + page_size - 1) & ~(page_size - 1);
+	context->data_memory_mapping_size = accessible_size + DATA_MEMORY_GUARD_SIZE;
+	context->data_memory_mapping = mmap(0, context->data_memory_mapping_size, PROT_NONE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+	if (context->data_memory_mapping == MAP_FAILED) {
+		context->data_memory_mapping = 0;
+		cleanUp(context);
+		simerror("Could not allocate data memory!");
+	}
+
+	if (mprotect(context->data_memory_mapping, accessible_size, PROT_READ | PROT_WRITE)) {
+		cleanUp(context);
+		simerror("Could not allocate data memory!");
+	}
+	context->data_memory = context->data_memory_mapping + (accessible_size - context->data_memory_size);
 }
 
 /**
   * @brief Reads the contents of the data memory from the 
   *        given binary file. The memory size must be equal 
   *        to the corresponding field of the file header.
+  * @param[in,out] context The simulator context.
   * @param[in] instream The binary file which will be simulated.
   * @note The binary data of the file is saved in big endian format.
   */
-void readMemory(FILE* instream) {
+void readMemory(sim_context_t* context, FILE* instream) {
 	
-	uint32_t memory_size = header.memory_size;
+	uint32_t memory_size = context->header.memory_size;
 	uint32_t i;
 
 	int value;
 
-	data_memory_size = memory_size + FREE_MEMORY_SIZE;
-	/* clear last two bits such that memory is always multiple 
-	   of 4 bytes */
-	data_memory_size &= 0xfffffffc;
-
-	data_memory = malloc(sizeof(uint8_t)*data_memory_size);
-
-	if (!data_memory) {
-		cleanUp();
-		simerror("Could not allocate data memory!");
-	}
+	allocateMemory(context);
 
 	for (i = 0; i < memory_size; i++) {
 		if ((value = fgetc(instream)) == EOF) {
-			cleanUp();
+			cleanUp(context);
 			simerror("Could not read from file!\n");
 		}
-		data_memory[i] = (uint8_t) (value & 0xff);
+		context->data_memory[i] = (uint8_t) (value & 0xff);
 	}
 
 
 }
 
 /**
-  * @brief Resets all internal registers to their initial
-  *        states, but does not change (!) the data memory.
+  * @brief Loads the program of another context without reading the 
+  *        binary file again: the decoded instructions are shared and 
+  *        the data memory is copied.
+  * @param[in,out] context The simulator context.
+  * @param[in] source Context of the same target, into which the binary
+  *                   has been read. Its data memory has to be in its 
+  *                   initial state and its instructions have to stay 
+  *                   valid as long as they are shared.
   */
-void resetSimulator(void) {
+void shareProgram(sim_context_t* context, sim_context_t* source) {
 
-	int i;
-	int j;
+	if (context->simulator != source->simulator) {
+		cleanUp(context);
+		simerror("Program of a different target cannot be shared!");
+	}
 
-	sparc_psr = PSR_INIT_MASK;
-	sparc_y = 0;
-	sparc_pc = 0;
-	sparc_npc = 1;
+	context->header = source->header;
+	context->instructions = source->instructions;
+	context->instructions_shared = 1;
+	memcpy(context->timing, source->timing, sizeof(context->timing));
 
-	/* initialize global registers */
-	for (i = 0; i < 8; i++) {
-		sparc_glob_regs[i] = 0;
+	/* the cache models start empty */
+	if ((source->icache.tags && cacheInitFrom(&(context->icache), &(source->icache))) ||
+		(source->dcache.tags && cacheInitFrom(&(context->dcache), &(source->dcache)))) {
+		cleanUp(context);
+		simerror("Could not allocate memory for cache model!");
+	}
+	if (source->predictor.model != PREDICTOR_NONE && 
+		predictorInitFrom(&(context->predictor), &(source->predictor))) {
+		cleanUp(context);
+		simerror("Could not allocate memory for branch predictor!");
+	}
+	pipelineFree(&(context->pipeline));
+	context->pipeline = source->pipeline;
+	context->pipeline.info = 0;
+	pipelineReset(&(context->pipeline));
+
+	allocateMemory(context);
+	memcpy(context->data_memory, source->data_memory, context->data_memory_size);
+}
+
+/**
+  * @brief Reads the cycles of instruction classes and the cache, branch
+  *        predictor and pipeline models from a timing model file, see 
+  *        the README for its lines. Classes which are not given keep 
+  *        their cycles. The cycles are summed per block when a block is
+  *        built, so the model has to be read before the first simulation.
+  * @param[in,out] context The simulator context.
+  * @param[in] instream File stream of the timing model.
+  */
+void readTimingModel(sim_context_t* context, FILE* instream) {
+
+	static const char* class_names[TIMING_NUM_CLASSES] = {
+		"integer", "load", "load-double", "store", "store-double",
+		"mul", "div", "control", "window"
+	};
+	static const char* policy_names[CACHE_NUM_POLICIES] = {"lru", "fifo", "random"};
+	static const char* model_names[PREDICTOR_NUM_MODELS] = {
+		"none", "btfn", "1bit", "2bit", "gshare"
+	};
+	char line[256];
+	char name[32];
+	char policy[16];
+	char message[128];
+	unsigned int cycles;
+	unsigned int size, ways, line_size, penalty, bits, entries;
+	char rest;
+	uint32_t line_number = 0;
+	cache_t* cache;
+	int i, fields, result;
+
+	if (context->threaded_blocks) {
+		context->simulator->cleanUp(context);
+		simerror("Timing model has to be read before the simulation!");
 	}
 
-	/* initialize local and in/out registers */
-	for (i = 0; i < NWINDOWS; i++) {
-		for (j = 0; j < 8; j++) {
-			sparc_inout_regs[i][j] = 0;
-			sparc_local_regs[i][j] = 0;
+	while (fgets(line, sizeof(line), instream)) {
+		line_number++;
+		fields = sscanf(line, " %31s %u %c", name, &cycles, &rest);
+		if (fields == EOF || name[0] == '#') {
+			continue;
+		}
+		if (!strcmp(name, "predictor")) {
+			bits = PREDICTOR_DEFAULT_BITS;
+			fields = sscanf(line, " %31s %15s %u %u %c", name, policy, &penalty, &bits, &rest);
+			result = 1;
+			for (i = 0; (fields == 3 || fields == 4) && i < PREDICTOR_NUM_MODELS; i++) {
+				if (!strcmp(policy, model_names[i])) {
+					predictorFree(&(context->predictor));
+					result = predictorInit(&(context->predictor), (predictor_model_t) i, bits, penalty);
+					break;
+				}
+			}
+			if (result == 2) {
+				context->simulator->cleanUp(context);
+				simerror("Could not allocate memory for branch predictor!");
+			}
+			if (result) {
+				snprintf(message, sizeof(message), "Invalid timing model in line %u!", line_number);
+				context->simulator->cleanUp(context);
+				simerror(message);
+			}
+			continue;
+		}
+		if (!strcmp(name, "store-buffer")) {
+			fields = sscanf(line, " %31s %u %u %c", name, &entries, &cycles, &rest);
+			if (fields != 3 || entries < 1 || entries > PIPELINE_MAX_STORE_BUFFER) {
+				snprintf(message, sizeof(message), "Invalid timing model in line %u!", line_number);
+				context->simulator->cleanUp(context);
+				simerror(message);
+			}
+			context->pipeline.store_entries = entries;
+			context->pipeline.store_drain = cycles;
+			context->pipeline.enabled = 1;
+			pipelineReset(&(context->pipeline));
+			continue;
+		}
+		if (!strcmp(name, "load-delay") || !strcmp(name, "branch-interlock") || 
+			!strcmp(name, "jump-delay")) {
+			if (fields != 2) {
+				snprintf(message, sizeof(message), "Invalid timing model in line %u!", line_number);
+				context->simulator->cleanUp(context);
+				simerror(message);
+			}
+			if (name[0] == 'l') {
+				context->pipeline.load_delay = cycles;
+			} else if (name[0] == 'b') {
+				context->pipeline.branch_interlock = cycles;
+			} else {
+				context->pipeline.jump_delay = cycles;
+			}
+			context->pipeline.enabled = 1;
+			pipelineReset(&(context->pipeline));
+			continue;
+		}
+		if (!strcmp(name, "icache") || !strcmp(name, "dcache")) {
+			cache = (name[0] == 'i') ? &(context->icache) : &(context->dcache);
+			fields = sscanf(line, " %31s %u %u %u %15s %u %c", name, &size, &ways, 
+				&line_size, policy, &penalty, &rest);
+			result = 1;
+			for (i = 0; fields == 6 && i < CACHE_NUM_POLICIES; i++) {
+				if (!strcmp(policy, policy_names[i])) {
+					cacheFree(cache);
+					result = cacheInit(cache, size, ways, line_size, (cache_policy_t) i, penalty);
+					break;
+				}
+			}
+			if (result == 2) {
+				context->simulator->cleanUp(context);
+				simerror("Could not allocate memory for cache model!");
+			}
+			if (result) {
+				snprintf(message, sizeof(message), "Invalid timing model in line %u!", line_number);
+				context->simulator->cleanUp(context);
+				simerror(message);
+			}
+			continue;
+		}
+		for (i = 0; i < TIMING_NUM_CLASSES; i++) {
+			if (!strcmp(name, class_names[i])) {
+				break;
+			}
 		}
+		if (fields != 2 || i == TIMING_NUM_CLASSES) {
+			snprintf(message, sizeof(message), "Invalid timing model in line %u!", line_number);
+			context->simulator->cleanUp(context);
+			simerror(message);
+		}
+		context->timing[i] = cycles;
 	}
-	
-	/* assign correct pointers for start window */
-	for (i = 0; i < 8; i++) {
-		sparc_window_registers[i] = &(sparc_glob_regs[i]);
+}
+
+/**
+  * @brief Resets the statistics and models of a run: the region table, 
+  *        the cache models, the branch predictor and statistics, the 
+  *        pipeline, the profile and the call stack. The cycle and 
+  *        instruction counters of the context are the start of the run.
+  * @param[in,out] context The simulator context.
+  */
+static void resetStatistics(sim_context_t* context) {
+
+	context->num_regions = 0;
+
+	/* start with empty caches */
+	if (context->icache.tags) {
+		cacheReset(&(context->icache));
+	}
+	if (context->dcache.tags) {
+		cacheReset(&(context->dcache));
+	}
+	context->region_start_icache = context->icache.stats;
+	context->region_start_dcache = context->dcache.stats;
+
+	/* start without branch history */
+	if (context->predictor.model != PREDICTOR_NONE) {
+		predictorReset(&(context->predictor));
+	}
+	if (context->branch_stats) {
+		memset(context->branch_stats, 0, 
+			context->simulator->getNumberOfInstructions(context)*sizeof(sim_branch_stats_t));
+	}
+
+	/* start with an empty pipeline */
+	pipelineReset(&(context->pipeline));
+	context->fetch_cycles = 0;
+
+	/* start with an empty profile */
+	if (context->profile_entries) {
+		memset(context->profile_entries, 0, 
+			3*(context->simulator->getNumberOfInstructions(context) + 1)*sizeof(uint64_t));
 	}
+	context->profile_pc = PROFILE_NONE;
+	context->profile_start = context->cycle_counter;
 
-	for (i = 8; i < 16; i++) {
-		sparc_window_registers[i] = &(sparc_inout_regs[NWINDOWS - 1][i - 8]);
+	/* start with main on the call stack */
+	if (context->calls.nodes) {
+		if (callsReset(&(context->calls), 0)) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for call stack!");
+		}
+		context->calls.start_cycles = context->cycle_counter;
+		context->calls.start_instructions = context->instruction_counter;
 	}
+}
+
+/**
+  * @brief Resets all internal registers to their initial
+  *        states, but does not change (!) the data memory.
+  * @param[in,out] context The simulator context.
+  */
+void resetSimulator(sim_context_t* context) {
+
+	int i;
+
+	context->psr = PSR_INIT_MASK;
+	context->lazy_icc.op = ICC_OP_NONE;
+	context->y = 0;
+	context->pc = 0;
+	context->npc = 1;
 
-	for (i = 16; i < 24; i++) {
-		sparc_window_registers[i] = &(sparc_local_regs[NWINDOWS - 1][i - 16]);
+	/* initialize global and windowed registers */
+	for (i = 0; i < 8; i++) {
+		context->glob_regs[i] = 0;
 	}
 
-	for (i = 24; i < 32; i++) {
-		sparc_window_registers[i] = &(sparc_inout_regs[0][i - 24]);
+	for (i = 0; i < NWINDOWS*16 + 8; i++) {
+		context->window_regs[i] = 0;
 	}
 
+	/* start window */
+	context->window = &(context->window_regs[(NWINDOWS - 1)*16]);
+
 	/* initialize stack pointer */
-	*(sparc_window_registers[SP_REGISTER]) = data_memory_size - 4;
+	SPARC_REGISTER(SP_REGISTER) = context->data_memory_size - 4;
 
 	/* initialize return address for main function
 	   => check next PC to be equal (END_OF_INS_MEM>>2) */
-	*(sparc_window_registers[CALL_ADDR_REGISTER]) = END_OF_INS_MEM - 8;
+	SPARC_REGISTER(CALL_ADDR_REGISTER) = END_OF_INS_MEM - 8;
 
 	/* set correct hardware loop state */
-	sparc_hwloop_state.hwloop_state = HWLOOP_STATE_IDLE;
-	sparc_hwloop_state.start_address = 0;
-	sparc_hwloop_state.end_address = 0;
-	sparc_hwloop_state.loop_counter = 0;
+	context->hwloop_state.hwloop_state = HWLOOP_STATE_IDLE;
+	context->hwloop_state.start_address = 0;
+	context->hwloop_state.end_address = 0;
+	context->hwloop_state.loop_counter = 0;
 
 	/* set correct predicate processor state */
-	sparc_pred_state.predicate_state = PREDICATE_STATE_NONE;
-	sparc_pred_state.predicate_condition.icc = 0;
+	context->pred_state.predicate_state = PREDICATE_STATE_NONE;
+	context->pred_state.predicate_condition.icc = 0;
 
 	/* all predicate registers are initially cleared */
-	sparc_preg = 0;
+	context->preg = 0;
 
 	/* clear cycle counters */
-	sparc_cycle_counter = 0;
-	sparc_cycle_counter_local = 0;
+	context->cycle_counter = 0;
+	context->cycle_counter_local = 0;
+	context->cycle_counter_region = 0;
+	context->cycle_regions = 0;
+	context->instruction_counter = 0;
+	context->region_start = REGION_START_PROGRAM;
+	context->region_start_instructions = 0;
 
+	resetStatistics(context);
 }
 
 
 /**
-  * @brief Changes the current window pointer of the sparc psr and
-  *        rearranges all registers.
-  * @param[in] inc Determines whether the window pointer shall be
-  *                incremented (inc != 0) or decremented (inc = 0).
-  * @note This mechanism is described in the Sparc V8 manual, 
-  *       chapter 4, p. 23-30.
+  * @brief Returns a hash (FNV-1a) of the opcodes and operands of the 
+  *        instructions, which identifies the program of a snapshot.
+  * @param[in] context The simulator context.
+  * @return The hash.
   */
-static void changeCWP(int inc) {
-	uint32_t cwp = PSR_GET_CWP(sparc_psr);
-	uint32_t new_cwp; 
-	uint32_t new_in_cwp; 
-	uint32_t i;
+static uint32_t programHash(sim_context_t* context) {
 
-	if (inc) {
-		new_cwp = (cwp + 1)%NWINDOWS;
-	} else {
-		new_cwp = (cwp - 1)%NWINDOWS;
-	}
-	new_in_cwp = (new_cwp + 1)%NWINDOWS;
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	uint32_t hash = 2166136261u;
+	uint32_t values[2];
+	sparc_instruction* instruction;
+	uint32_t i, j, k;
 
-	/* rearrange out registers */
-	for (i = 8; i < 16; i++) {
-		sparc_window_registers[i] = &(sparc_inout_regs[new_cwp][i - 8]);
+	for (i = 0; i < number_instructions; i++) {
+		instruction = &(context->instructions[i]);
+		for (j = 0; j <= instruction->num_operands; j++) {
+			if (j == 0) {
+				values[0] = (uint32_t) instruction->opcode;
+				values[1] = instruction->num_operands;
+			} else {
+				values[0] = (uint32_t) instruction->operands[j - 1].type;
+				values[1] = instruction->operands[j - 1].value.labeladdress;
+			}
+			for (k = 0; k < 8; k++) {
+				hash ^= (values[k/4] >> (8*(k%4))) & 0xff;
+				hash *= 16777619u;
+			}
+		}
 	}
+	return hash;
+}
 
-	/* rearrange local registers */
-	for (i = 16; i < 24; i++) {
-		sparc_window_registers[i] = &(sparc_local_regs[new_cwp][i - 16]);
-	}
+/**
+  * @brief Returns whether a program counter of a snapshot is within the
+  *        instruction memory or marks the return from the main function.
+  * @param[in] context The simulator context.
+  * @param[in] pc The program counter (word address).
+  * @return 1 if the program counter is valid, 0 otherwise.
+  */
+static int validProgramCounter(sim_context_t* context, uint32_t pc) {
+	return pc < context->simulator->getNumberOfInstructions(context) || 
+		pc == (END_OF_INS_MEM>>2);
+}
+
+/**
+  * @brief Saves the complete processor state and the data memory, e.g.
+  *        the state after loading a program, which may be restored for 
+  *        every further run of the same program.
+  * @param[in,out] context The simulator context.
+  * @return The snapshot, which has to be released by freeSnapshot().
+  */
+sim_snapshot_t* saveSnapshot(sim_context_t* context) {
+
+	sim_snapshot_t* snapshot = malloc(sizeof(sim_snapshot_t) + context->data_memory_size);
 
-	/* rearrange in registers */
-	for (i = 24; i < 32; i++) {
-		sparc_window_registers[i] = &(sparc_inout_regs[new_in_cwp][i - 24]);
+	if (!snapshot) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for snapshot!");
 	}
 
-	PSR_SET_CWP(sparc_psr, new_cwp);
+	snapshot->header = context->header;
+	snapshot->program_hash = programHash(context);
+	memcpy(snapshot->glob_regs, context->glob_regs, sizeof(context->glob_regs));
+	memcpy(snapshot->window_regs, context->window_regs, sizeof(context->window_regs));
+	snapshot->window = (uint32_t) (context->window - context->window_regs);
+	snapshot->psr = context->psr;
+	snapshot->lazy_icc = context->lazy_icc;
+	snapshot->y = context->y;
+	snapshot->pc = context->pc;
+	snapshot->npc = context->npc;
+	snapshot->hwloop_state = context->hwloop_state;
+	snapshot->preg = context->preg;
+	snapshot->pred_state = context->pred_state;
+	snapshot->cycle_counter = context->cycle_counter;
+	snapshot->cycle_counter_local = context->cycle_counter_local;
+	snapshot->cycle_counter_region = context->cycle_counter_region;
+	snapshot->cycle_regions = context->cycle_regions;
+	snapshot->instruction_counter = context->instruction_counter;
+	snapshot->region_start = context->region_start;
+	snapshot->region_start_instructions = context->region_start_instructions;
+	snapshot->memory_size = context->data_memory_size;
+	memcpy(snapshot->memory, context->data_memory, context->data_memory_size);
+
+	return snapshot;
 }
 
 /**
-  * @brief Evaluates whether the given bit in the predicate
-  * register is set, depending on register number and true/false
-  * value. 
-  * @param[in] preg Predicate register number to check.
-  * @param[in] tf Whether to check true or false bit of the
-  * current predicate register. May only be 0 or 1!
-  * @return 1 if the current predicate register is set,
-  * 0 otherwise.
+  * @brief Restores a snapshot of the currently simulated program. The
+  *        pre-decoded and compiled blocks stay valid, as the instructions
+  *        do not change. The statistics and models start empty, such 
+  *        that every run from the snapshot is simulated alike.
+  * @param[in,out] context The simulator context.
+  * @param[in] snapshot Snapshot taken by saveSnapshot() or read by 
+  *                     readSnapshot().
   */
-static int evaluatePred(int preg, int tf) {
-	return ((sparc_preg >> (preg*2 + tf)) & 0x1);
-}
+void restoreSnapshot(sim_context_t* context, const sim_snapshot_t* snapshot) {
+
+	if (snapshot->header.target_id != context->header.target_id ||
+		snapshot->header.memory_size != context->header.memory_size ||
+		snapshot->header.instruction_size != context->header.instruction_size ||
+		snapshot->memory_size != context->data_memory_size ||
+		snapshot->program_hash != programHash(context)) {
+		context->simulator->cleanUp(context);
+		simerror("Snapshot does not belong to the simulated program!");
+	}
+
+	/* the window offset indexes the register file and the program 
+	   counters the instructions */
+	if (snapshot->window >= NWINDOWS*16 || snapshot->window % 16 ||
+		snapshot->window/16 != PSR_GET_CWP(snapshot->psr) ||
+		!validProgramCounter(context, snapshot->pc) || 
+		!validProgramCounter(context, snapshot->npc) ||
+		snapshot->hwloop_state.start_address > context->simulator->getNumberOfInstructions(context) ||
+		snapshot->hwloop_state.end_address > context->simulator->getNumberOfInstructions(context)) {
+		context->simulator->cleanUp(context);
+		simerror("Snapshot contains an invalid processor state!");
+	}
+
+	memcpy(context->glob_regs, snapshot->glob_regs, sizeof(context->glob_regs));
+	memcpy(context->window_regs, snapshot->window_regs, sizeof(context->window_regs));
+	context->window = &(context->window_regs[snapshot->window]);
+	context->psr = snapshot->psr;
+	context->lazy_icc = snapshot->lazy_icc;
+	context->y = snapshot->y;
+	context->pc = snapshot->pc;
+	context->npc = snapshot->npc;
+	context->hwloop_state = snapshot->hwloop_state;
+	context->preg = snapshot->preg;
+	context->pred_state = snapshot->pred_state;
+	context->cycle_counter = snapshot->cycle_counter;
+	context->cycle_counter_local = snapshot->cycle_counter_local;
+	context->cycle_counter_region = snapshot->cycle_counter_region;
+	context->cycle_regions = snapshot->cycle_regions;
+	context->instruction_counter = snapshot->instruction_counter;
+	context->region_start = snapshot->region_start;
+	context->region_start_instructions = snapshot->region_start_instructions;
+	memcpy(context->data_memory, snapshot->memory, context->data_memory_size);
+
+	/* the cycle counter continues with empty statistics and models */
+	resetStatistics(context);
+}
+
+/**
+  * @brief Writes a value in big endian format.
+  * @param[in] outstream File stream where to write the value.
+  * @param[in] value The value.
+  * @param[in] bytes Number of bytes of the value.
+  * @return 0 on success, 1 otherwise.
+  */
+static int writeSnapshotValue(FILE* outstream, uint64_t value, int bytes) {
+	while (bytes--) {
+		if (fputc((int) ((value >> (8*bytes)) & 0xff), outstream) == EOF) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Reads a value in big endian format.
+  * @param[in] instream File stream where to read the value from.
+  * @param[in] bytes Number of bytes of the value.
+  * @param[in,out] error Set to 1 if the file ends before the value.
+  * @return The value.
+  */
+static uint64_t readSnapshotValue(FILE* instream, int bytes, int* error) {
+	uint64_t value = 0;
+	int byte;
+
+	while (bytes--) {
+		if ((byte = fgetc(instream)) == EOF) {
+			*error = 1;
+			return 0;
+		}
+		value = (value << 8) | (uint64_t) byte;
+	}
+	return value;
+}
+
+/**
+  * @brief Writes a snapshot to the given file stream, independent of the 
+  *        byte order and structure layout of the host.
+  * @param[in] snapshot The snapshot.
+  * @param[in] outstream File stream where to write the snapshot.
+  * @return 0 on success, 1 otherwise.
+  */
+int writeSnapshot(const sim_snapshot_t* snapshot, FILE* outstream) {
+
+	int error = 0;
+	uint32_t i;
+
+	error |= writeSnapshotValue(outstream, SNAPSHOT_MAGIC, 4);
+	error |= writeSnapshotValue(outstream, SNAPSHOT_VERSION, 4);
+	error |= writeSnapshotValue(outstream, snapshot->header.target_id, 2);
+	error |= writeSnapshotValue(outstream, snapshot->header.memory_size, 4);
+	error |= writeSnapshotValue(outstream, snapshot->header.instruction_size, 4);
+	error |= writeSnapshotValue(outstream, snapshot->program_hash, 4);
+	for (i = 0; i < 8; i++) {
+		error |= writeSnapshotValue(outstream, snapshot->glob_regs[i], 4);
+	}
+	for (i = 0; i < NWINDOWS*16 + 8; i++) {
+		error |= writeSnapshotValue(outstream, snapshot->window_regs[i], 4);
+	}
+	error |= writeSnapshotValue(outstream, snapshot->window, 4);
+	error |= writeSnapshotValue(outstream, snapshot->psr, 4);
+	error |= writeSnapshotValue(outstream, snapshot->lazy_icc.op, 4);
+	error |= writeSnapshotValue(outstream, snapshot->lazy_icc.src1, 4);
+	error |= writeSnapshotValue(outstream, snapshot->lazy_icc.src2, 4);
+	error |= writeSnapshotValue(outstream, snapshot->lazy_icc.result, 4);
+	error |= writeSnapshotValue(outstream, snapshot->y, 4);
+	error |= writeSnapshotValue(outstream, snapshot->pc, 4);
+	error |= writeSnapshotValue(outstream, snapshot->npc, 4);
+	error |= writeSnapshotValue(outstream, snapshot->hwloop_state.hwloop_state, 4);
+	error |= writeSnapshotValue(outstream, snapshot->hwloop_state.start_address, 4);
+	error |= writeSnapshotValue(outstream, snapshot->hwloop_state.end_address, 4);
+	error |= writeSnapshotValue(outstream, snapshot->hwloop_state.loop_counter, 4);
+	error |= writeSnapshotValue(outstream, snapshot->preg, 4);
+	/* the icc condition shares its storage with the predicate register */
+	error |= writeSnapshotValue(outstream, snapshot->pred_state.predicate_state, 4);
+	error |= writeSnapshotValue(outstream, 
+		(uint32_t) snapshot->pred_state.predicate_condition.preg_condition.preg, 4);
+	error |= writeSnapshotValue(outstream, 
+		(uint32_t) snapshot->pred_state.predicate_condition.preg_condition.tf, 4);
+	error |= writeSnapshotValue(outstream, snapshot->cycle_counter, 8);
+	error |= writeSnapshotValue(outstream, snapshot->cycle_counter_local, 8);
+	error |= writeSnapshotValue(outstream, snapshot->cycle_counter_region, 8);
+	error |= writeSnapshotValue(outstream, snapshot->cycle_regions, 4);
+	error |= writeSnapshotValue(outstream, snapshot->instruction_counter, 8);
+	error |= writeSnapshotValue(outstream, snapshot->region_start, 4);
+	error |= writeSnapshotValue(outstream, snapshot->region_start_instructions, 8);
+	error |= writeSnapshotValue(outstream, snapshot->memory_size, 4);
+
+	return error || fwrite(snapshot->memory, 1, snapshot->memory_size, outstream) != 
+		snapshot->memory_size;
+}
+
+/**
+  * @brief Reads a snapshot written by writeSnapshot() for the currently
+  *        simulated binary.
+  * @param[in,out] context The simulator context.
+  * @param[in] instream File stream where to read the snapshot from.
+  * @return The snapshot, which has to be released by freeSnapshot(), or
+  *         0 if the file does not contain a snapshot of this version or 
+  *         its data memory does not match the simulated binary.
+  */
+sim_snapshot_t* readSnapshot(sim_context_t* context, FILE* instream) {
+
+	sim_snapshot_t fixed;
+	sim_snapshot_t* snapshot;
+	int error = 0;
+	uint32_t i;
+
+	if (readSnapshotValue(instream, 4, &error) != SNAPSHOT_MAGIC ||
+		readSnapshotValue(instream, 4, &error) != SNAPSHOT_VERSION || error) {
+		return 0;
+	}
+
+	fixed.header.target_id = (uint16_t) readSnapshotValue(instream, 2, &error);
+	fixed.header.memory_size = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.header.instruction_size = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.program_hash = (uint32_t) readSnapshotValue(instream, 4, &error);
+	for (i = 0; i < 8; i++) {
+		fixed.glob_regs[i] = (uint32_t) readSnapshotValue(instream, 4, &error);
+	}
+	for (i = 0; i < NWINDOWS*16 + 8; i++) {
+		fixed.window_regs[i] = (uint32_t) readSnapshotValue(instream, 4, &error);
+	}
+	fixed.window = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.psr = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.lazy_icc.op = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.lazy_icc.src1 = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.lazy_icc.src2 = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.lazy_icc.result = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.y = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.pc = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.npc = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.hwloop_state.hwloop_state = (hwloop_state_t) readSnapshotValue(instream, 4, &error);
+	fixed.hwloop_state.start_address = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.hwloop_state.end_address = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.hwloop_state.loop_counter = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.preg = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.pred_state.predicate_state = (predicate_state_t) readSnapshotValue(instream, 4, &error);
+	fixed.pred_state.predicate_condition.preg_condition.preg = 
+		(int) readSnapshotValue(instream, 4, &error);
+	fixed.pred_state.predicate_condition.preg_condition.tf = 
+		(int) readSnapshotValue(instream, 4, &error);
+	fixed.cycle_counter = readSnapshotValue(instream, 8, &error);
+	fixed.cycle_counter_local = readSnapshotValue(instream, 8, &error);
+	fixed.cycle_counter_region = readSnapshotValue(instream, 8, &error);
+	fixed.cycle_regions = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.instruction_counter = readSnapshotValue(instream, 8, &error);
+	fixed.region_start = (uint32_t) readSnapshotValue(instream, 4, &error);
+	fixed.region_start_instructions = readSnapshotValue(instream, 8, &error);
+	fixed.memory_size = (uint32_t) readSnapshotValue(instream, 4, &error);
+
+	/* the data memory has the size of the simulated binary, which 
+	   bounds the allocation */
+	if (error || fixed.header.memory_size != context->header.memory_size ||
+		fixed.memory_size != context->data_memory_size) {
+		return 0;
+	}
+
+	snapshot = malloc(sizeof(sim_snapshot_t) + fixed.memory_size);
+	if (!snapshot) {
+		return 0;
+	}
+
+	*snapshot = fixed;
+	if (fread(snapshot->memory, 1, fixed.memory_size, instream) != fixed.memory_size) {
+		free(snapshot);
+		return 0;
+	}
+
+	return snapshot;
+}
+
+/**
+  * @brief Releases a snapshot.
+  * @param[in] snapshot The snapshot.
+  */
+void freeSnapshot(sim_snapshot_t* snapshot) {
+	free(snapshot);
+}
+
+/**
+  * @brief Changes the current window pointer of the sparc psr and
+  *        moves the current window within the register file.
+  * @param[in,out] context The simulator context.
+  * @param[in] inc Determines whether the window pointer shall be
+  *                incremented (inc != 0) or decremented (inc = 0).
+  * @note This mechanism is described in the Sparc V8 manual, 
+  *       chapter 4, p. 23-30.
+  */
+static void changeCWP(sim_context_t* context, int inc) {
+	uint32_t cwp = PSR_GET_CWP(context->psr);
+	uint32_t new_cwp; 
+
+	if (inc) {
+		new_cwp = (cwp + 1)%NWINDOWS;
+	} else {
+		new_cwp = (cwp - 1)%NWINDOWS;
+	}
+
+	/* the in registers of the last window are a copy of the out 
+	   registers of window 0 => synchronize when entering/leaving it */
+	if (cwp == NWINDOWS - 1) {
+		memcpy(context->window_regs, &(context->window_regs[NWINDOWS*16]), 
+			8*sizeof(uint32_t));
+	}
+	if (new_cwp == NWINDOWS - 1) {
+		memcpy(&(context->window_regs[NWINDOWS*16]), context->window_regs, 
+			8*sizeof(uint32_t));
+	}
+
+	context->window = &(context->window_regs[new_cwp*16]);
+	PSR_SET_CWP(context->psr, new_cwp);
+}
+
+/**
+  * @brief Evaluates whether the given bit in the predicate
+  * register is set, depending on register number and true/false
+  * value. 
+  * @param[in,out] context The simulator context.
+  * @param[in] preg Predicate register number to check.
+  * @param[in] tf Whether to check true or false bit of the
+  * current predicate register. May only be 0 or 1!
+  * @return 1 if the current predicate register is set,
+  * 0 otherwise.
+  */
+static int evaluatePred(sim_context_t* context, int preg, int tf) {
+	return ((context->preg >> (preg*2 + tf)) & 0x1);
+}
+
+/**
+  * @brief Calculates the icc bits of logic, multiply and divide 
+  *        instructions which only check for zero and negative.
+  * @param[in] result The result of the instruction.
+  * @return The icc bits at their position within the psr.
+  */
+static uint32_t iccLogic(uint32_t result) {
+	uint32_t icc = 0;
+
+	if (result & (1<<31)) {
+		PSR_SET_N(icc);
+	}
+	if (result == 0) {
+		PSR_SET_Z(icc);
+	}
+	return icc;
+}
+
+/**
+  * @brief Calculates the icc bits of an addcc instruction.
+  * @param[in] src1 Source operand 1 of the addition.
+  * @param[in] src2 Source operand 2 of the addition.
+  * @param[in] result The result of the addition.
+  * @return The icc bits at their position within the psr.
+  */
+static uint32_t iccAdd(uint32_t src1, uint32_t src2, uint32_t result) {
+	uint32_t icc = iccLogic(result);
+
+	if ( ( (src1 & (1<<31)) && (src2 & (1<<31)) && (!(result & (1<<31))) ) ||
+		 ( (!(src1 & (1<<31))) && (!(src2 & (1<<31))) && (result & (1<<31)) ) ) {
+		PSR_SET_V(icc);
+	}
+	if ( ( (src1 & (1<<31)) && (src2 & (1<<31)) ) ||
+		 ( (!(result & (1<<31))) && ((src1 & (1<<31)) || (src2 & (1<<31))) ) ) {
+		PSR_SET_C(icc);
+	}
+	return icc;
+}
+
+/**
+  * @brief Calculates the icc bits of a subcc instruction.
+  * @param[in] src1 Source operand 1 of the subtraction.
+  * @param[in] src2 Source operand 2 of the subtraction.
+  * @param[in] result The result of the subtraction.
+  * @return The icc bits at their position within the psr.
+  */
+static uint32_t iccSub(uint32_t src1, uint32_t src2, uint32_t result) {
+	uint32_t icc = iccLogic(result);
+
+	if ( ( (src1 & (1<<31)) && (!(src2 & (1<<31))) && (!(result & (1<<31))) ) ||
+		 ( (!(src1 & (1<<31))) && (src2 & (1<<31)) && (result & (1<<31)) ) ) {
+		PSR_SET_V(icc);
+	}
+	if ( ( (!(src1 & (1<<31))) && (src2 & (1<<31)) ) ||
+		 ( (result & (1<<31)) && ((!(src1 & (1<<31))) || (src2 & (1<<31))) ) ) {
+		PSR_SET_C(icc);
+	}
+	return icc;
+}
+
+/**
+  * @brief Returns the contents of the psr including the icc of the
+  *        given last icc setting operation.
+  * @param[in] psr Contents of the psr register.
+  * @param[in] lazy_icc Last icc setting operation.
+  * @return The psr with valid icc.
+  */
+static uint32_t psrValue(uint32_t psr, const lazy_icc_state_t* lazy_icc) {
+	uint32_t icc;
+
+	switch (lazy_icc->op) {
+		case ICC_OP_LOGIC:
+			icc = iccLogic(lazy_icc->result);
+			break;
+		case ICC_OP_ADD:
+			icc = iccAdd(lazy_icc->src1, lazy_icc->src2, lazy_icc->result);
+			break;
+		case ICC_OP_SUB:
+			icc = iccSub(lazy_icc->src1, lazy_icc->src2, lazy_icc->result);
+			break;
+		default:
+			return psr;
+	}
+	PSR_CLR_ICCS(psr);
+	return psr | icc;
+}
+
+/**
+  * @brief Calculates the icc of the last icc setting operation and 
+  *        writes them to the psr.
+  * @param[in,out] context The simulator context.
+  */
+static void materializeICC(sim_context_t* context) {
+	if (context->lazy_icc.op != ICC_OP_NONE) {
+		context->psr = psrValue(context->psr, &context->lazy_icc);
+		context->lazy_icc.op = ICC_OP_NONE;
+	}
+}
+
+/**
+  * @brief Records an icc setting operation, the icc are calculated 
+  *        when they are read for the first time.
+  * @param[in,out] context The simulator context.
+  * @param[in] op Kind of the operation.
+  * @param[in] src1 Source operand 1 of the operation.
+  * @param[in] src2 Source operand 2 of the operation.
+  * @param[in] result Result of the operation.
+  */
+static void setLazyICC(sim_context_t* context, uint32_t op, uint32_t src1, 
+		uint32_t src2, uint32_t result) {
+	context->lazy_icc.op = op;
+	context->lazy_icc.src1 = src1;
+	context->lazy_icc.src2 = src2;
+	context->lazy_icc.result = result;
+}
 
 /**
   * @brief Evaluates whether the icc bits of the psr are set
   *        such that the given icc is fulfilled. 
+  * @param[in,out] context The simulator context.
   * @param[in] icc The integer condition code to check. 
   * @return 1 if the current condition is fulfilled,
   * 0 otherwise.
   */
-static int evaluateICC(int icc) {
+static int evaluateICC(sim_context_t* context, int icc) {
 	/* handle all condition codes as described in the sparc v8 manual, p. 178 */
 	int icc_matched = 0;
 
+	uint32_t src1 = context->lazy_icc.src1;
+	uint32_t src2 = context->lazy_icc.src2;
+	uint32_t result = context->lazy_icc.result;
+
+	/* most conditions can be evaluated directly from the operands
+	   of the last icc setting operation */
+	if (context->lazy_icc.op == ICC_OP_SUB) {
+		switch (icc) {
+			case CC_A:		return 1;
+			case CC_N:		return 0;
+			case CC_NE:		return result != 0;
+			case CC_E:		return result == 0;
+			case CC_G:		return (int32_t) src1 > (int32_t) src2;
+			case CC_LE:		return (int32_t) src1 <= (int32_t) src2;
+			case CC_GE:		return (int32_t) src1 >= (int32_t) src2;
+			case CC_L:		return (int32_t) src1 < (int32_t) src2;
+			case CC_GU:		return src1 > src2;
+			case CC_LEU:	return src1 <= src2;
+			case CC_CC:		return src1 >= src2;
+			case CC_CS:		return src1 < src2;
+			case CC_POS:	return (int32_t) result >= 0;
+			case CC_NEG:	return (int32_t) result < 0;
+			default:		break;
+		}
+	} else if (context->lazy_icc.op == ICC_OP_LOGIC) {
+		/* V and C are always cleared */
+		switch (icc) {
+			case CC_A:		return 1;
+			case CC_N:		return 0;
+			case CC_NE:		return result != 0;
+			case CC_E:		return result == 0;
+			case CC_G:		return (int32_t) result > 0;
+			case CC_LE:		return (int32_t) result <= 0;
+			case CC_GE:		return (int32_t) result >= 0;
+			case CC_L:		return (int32_t) result < 0;
+			case CC_GU:		return result != 0;
+			case CC_LEU:	return result == 0;
+			case CC_CC:		return 1;
+			case CC_CS:		return 0;
+			case CC_POS:	return (int32_t) result >= 0;
+			case CC_NEG:	return (int32_t) result < 0;
+			case CC_VC:		return 1;
+			case CC_VS:		return 0;
+			default:		break;
+		}
+	}
+
+	materializeICC(context);
+
 	switch(icc) {
 		case CC_A:
 			icc_matched = 1;
@@ -353,79 +1755,79 @@ static int evaluateICC(int icc) {
 		case CC_N:
 			break;
 		case CC_NE:
-			if (!PSR_GET_Z(sparc_psr)) {
+			if (!PSR_GET_Z(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_E:
-			if (PSR_GET_Z(sparc_psr)) {
+			if (PSR_GET_Z(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_G:
-			if (! (PSR_GET_Z(sparc_psr) | 
-				  (PSR_GET_N(sparc_psr) ^ PSR_GET_V(sparc_psr))) ) {
+			if (! (PSR_GET_Z(context->psr) | 
+				  (PSR_GET_N(context->psr) ^ PSR_GET_V(context->psr))) ) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_LE:
-			if ( PSR_GET_Z(sparc_psr) | 
-				(PSR_GET_N(sparc_psr) ^ PSR_GET_V(sparc_psr)) ) {
+			if ( PSR_GET_Z(context->psr) | 
+				(PSR_GET_N(context->psr) ^ PSR_GET_V(context->psr)) ) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_GE:
-			if (! (PSR_GET_N(sparc_psr) ^ PSR_GET_V(sparc_psr)) ) {
+			if (! (PSR_GET_N(context->psr) ^ PSR_GET_V(context->psr)) ) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_L:
-			if (PSR_GET_N(sparc_psr) ^ PSR_GET_V(sparc_psr)) {
+			if (PSR_GET_N(context->psr) ^ PSR_GET_V(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_GU:
-			if ((!PSR_GET_C(sparc_psr)) & (!PSR_GET_Z(sparc_psr))) {
+			if ((!PSR_GET_C(context->psr)) & (!PSR_GET_Z(context->psr))) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_LEU:
-			if (PSR_GET_C(sparc_psr) | PSR_GET_Z(sparc_psr)) {
+			if (PSR_GET_C(context->psr) | PSR_GET_Z(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_CC:
-			if (!PSR_GET_C(sparc_psr)) {
+			if (!PSR_GET_C(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_CS:
-			if (PSR_GET_C(sparc_psr)) {
+			if (PSR_GET_C(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_POS:
-			if (!PSR_GET_N(sparc_psr)) {
+			if (!PSR_GET_N(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_NEG:
-			if (PSR_GET_N(sparc_psr)) {
+			if (PSR_GET_N(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_VC:
-			if (!PSR_GET_V(sparc_psr)) {
+			if (!PSR_GET_V(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		case CC_VS:
-			if (PSR_GET_V(sparc_psr)) {
+			if (PSR_GET_V(context->psr)) {
 				icc_matched = 1;
 			}
 			break;
 		default:
-			gen_simulator->cleanUp();
+			context->simulator->cleanUp(context);
 			simerror("Encountered unkown icc!");
 			break;
 	}
@@ -433,139 +1835,542 @@ static int evaluateICC(int icc) {
 }
 
 /**
-  * @brief Simulates one step and returns 0 if a return from the main
-  *        function has been detected.
-  * @param[in] outstream The output file stream where to write additional
-  *                      information. Currently only used for debugging.
-  * @return 1 if there are unhandled instructions, 0 if there is a return
-  *         from the main function.
+  * @brief Returns the bucket of the cycle histograms for the given cycles.
+  *        Small values have a bucket each, larger values share 
+  *        CYCLE_HISTOGRAM_SUB buckets per power of two, so that each 
+  *        bucket is accurate to 1/CYCLE_HISTOGRAM_SUB of its values.
+  * @param[in] cycles The cycles.
+  * @return The bucket, less than CYCLE_HISTOGRAM_SIZE.
   */
-int simulateStep(FILE* outstream) {
+static uint32_t histogramBucket(uint64_t cycles) {
 
-	/* get current instruction */
-	sparc_instruction* cur_instruction = &(instructions[sparc_pc]);
+	uint32_t msb;
 
-	/* get current opcode */
-	uint32_t opcode = cur_instruction->opcode;
-	/* save the number of unhandled operands of the current instruction */
-	uint32_t unhandled_operands = cur_instruction->num_operands;
-	/* save the address of the first unhandled operand of the current instruction */
-	uint32_t operand_iter = 0;
-	/* save operands array of the current instruction */
-	sparc_operand* operands = cur_instruction->operands;
+	if (cycles < CYCLE_HISTOGRAM_SUB) {
+		return (uint32_t) cycles;
+	}
+	msb = 63 - __builtin_clzll(cycles);
+	return (msb - CYCLE_HISTOGRAM_BITS + 1)*CYCLE_HISTOGRAM_SUB + 
+		(uint32_t) ((cycles >> (msb - CYCLE_HISTOGRAM_BITS)) & (CYCLE_HISTOGRAM_SUB - 1));
+}
 
-	/* for all conditional instructions, we need the icc of the instruction */
-	uint32_t icc;
-	/* destination register number */
-	uint32_t dst_reg;
-	/* source 1 register number */ 
-	uint32_t src1_reg;
-	/* source 2 register number */
-	uint32_t src2_reg;
-	/* source 1 value */
-	uint32_t src1_op;
-	/* source 2 value */
-	uint32_t src2_op;
+/**
+  * @brief Returns the smallest cycles of a bucket of the cycle histograms.
+  * @param[in] bucket The bucket.
+  * @return The smallest cycles counted by the bucket.
+  */
+static uint64_t histogramCycles(uint32_t bucket) {
 
-	/* address of the destination register of current instruction */
-	uint32_t* dst_address = 0;
-	/* result of the current instruction */
-	uint32_t dst_value = 0;
+	uint32_t msb;
 
-	/* new value for preg for predset/predclear instructions */
-	uint32_t next_preg = sparc_preg;
+	if (bucket < CYCLE_HISTOGRAM_SUB) {
+		return bucket;
+	}
+	msb = bucket/CYCLE_HISTOGRAM_SUB + CYCLE_HISTOGRAM_BITS - 1;
+	return ((uint64_t) (CYCLE_HISTOGRAM_SUB + bucket % CYCLE_HISTOGRAM_SUB)) << (msb - CYCLE_HISTOGRAM_BITS);
+}
 
-	/* temporary memory address for load/store instructions */
-	uint32_t memory_address = 0;
-	/* loop variable for load/store instructions */
-	int32_t i;
+/**
+  * @brief Opens a new region at a cycle clear or cycle print instruction
+  *        by resetting the local cycle counter.
+  * @param[in,out] context The simulator context.
+  * @param[in] pc Word address of the cycle clear/print instruction.
+  */
+static void openRegion(sim_context_t* context, uint32_t pc) {
+	context->cycle_counter_local = 0;
+	context->region_start = pc;
+	context->region_start_instructions = context->instruction_counter;
+	context->region_start_icache = context->icache.stats;
+	context->region_start_dcache = context->dcache.stats;
+}
 
-	/* for multiplication and division */
-	uint32_t tmp_y_value = 0;
-	uint64_t tmp_udivmul_result = 0;
-	int64_t tmp_sdivmul_result = 0;
+/**
+  * @brief Closes the current region at a cycle print instruction: prints
+  *        its cycles, accumulates them in the region table and opens the
+  *        next region.
+  * @param[in,out] context The simulator context.
+  * @param[in] pc Word address of the cycle print instruction.
+  * @param[in] outstream The output file stream where to print the cycles,
+  *                      0 for no output.
+  */
+static void closeRegion(sim_context_t* context, uint32_t pc, FILE* outstream) {
 
-	/* values for instructions influencing the integer condition codes 
-	   of the psr */
-	uint32_t changes_icc = 0;
-	uint32_t next_icc = 0;
+	uint64_t cycles = context->cycle_counter_local;
+	sim_region_t* region = 0;
+	uint32_t i;
 
-	/* save current program counter for call instruction */
-	uint32_t cur_pc = sparc_pc;
+	if (outstream) {
+		fprintf(outstream, "Current simulated cycles: %llu.\n", (unsigned long long) cycles);
+	}
 
-	/* boolean which saves if the current instruction will be executed */
-	uint32_t executed = 0;
+	context->run_events |= RUN_CYCLE_PRINT;
 
-	/* calculate next program counter */
-	sparc_pc = sparc_npc;
-	/* increment npc per default */
-	sparc_npc++;
+	/* the cycles of fast-forwarded regions are meaningless */
+	if (context->functional) {
+		openRegion(context, pc);
+		return;
+	}
 
-/* 	fprintf(outstream, "PC: %d, nPC: %d\n", cur_pc, sparc_pc); */
-/* 	fprintf(outstream, "Opcode: %d\n", opcode); */
+	context->cycle_counter_region = cycles;
+	(context->cycle_regions)++;
 
-	/* if we are in a hardware loop, we have to check
-	   whether we have to branch */
-	if (sparc_hwloop_state.hwloop_state == HWLOOP_STATE_ACTIVE) {
-		/* the next calculated address is the end of the current loop */
-		if (sparc_npc == sparc_hwloop_state.end_address) {
-			/* decrement loop counter */
-			(sparc_hwloop_state.loop_counter)--; 
-			if (sparc_hwloop_state.loop_counter > 0) {
-				/* if the loop counter is greater than zero, we can branch */
-				sparc_npc = sparc_hwloop_state.start_address;
-			} else {
-				/* otherwise, we exit loop and leave the active state */
-				sparc_hwloop_state.hwloop_state = HWLOOP_STATE_IDLE;
+	/* there are only few distinct regions in a program */
+	for (i = 0; i < context->num_regions; i++) {
+		if (context->regions[i].start == context->region_start && context->regions[i].end == pc) {
+			region = &(context->regions[i]);
+			break;
+		}
+	}
+
+	if (!region) {
+		if (context->num_regions == context->max_regions) {
+			context->max_regions = context->max_regions ? 2*context->max_regions : 16;
+			context->regions = realloc(context->regions, context->max_regions*sizeof(sim_region_t));
+			if (!context->regions) {
+				context->simulator->cleanUp(context);
+				simerror("Could not allocate memory for region table!");
+			}
+			if (context->region_histograms) {
+				context->region_histograms = realloc(context->region_histograms, 
+					context->max_regions*CYCLE_HISTOGRAM_SIZE*sizeof(uint64_t));
+				if (!context->region_histograms) {
+					context->simulator->cleanUp(context);
+					simerror("Could not allocate memory for cycle histograms!");
+				}
 			}
 		}
+		i = (context->num_regions)++;
+		region = &(context->regions[i]);
+		if (context->region_histograms) {
+			memset(&(context->region_histograms[i*CYCLE_HISTOGRAM_SIZE]), 0, 
+				CYCLE_HISTOGRAM_SIZE*sizeof(uint64_t));
+		}
+		region->start = context->region_start;
+		region->end = pc;
+		region->count = 0;
+		region->min_cycles = cycles;
+		region->max_cycles = cycles;
+		region->sum_cycles = 0;
+		region->sum_instructions = 0;
+		memset(&(region->icache), 0, sizeof(region->icache));
+		memset(&(region->dcache), 0, sizeof(region->dcache));
 	}
-		
-	switch(opcode) {
-		/* reset local cycle counter and print out number of simulated cycles so far */
+
+	(region->count)++;
+	if (cycles < region->min_cycles) {
+		region->min_cycles = cycles;
+	}
+	if (cycles > region->max_cycles) {
+		region->max_cycles = cycles;
+	}
+	region->sum_cycles += cycles;
+	region->sum_instructions += context->instruction_counter - context->region_start_instructions;
+	region->icache.accesses += context->icache.stats.accesses - context->region_start_icache.accesses;
+	region->icache.misses += context->icache.stats.misses - context->region_start_icache.misses;
+	region->dcache.accesses += context->dcache.stats.accesses - context->region_start_dcache.accesses;
+	region->dcache.misses += context->dcache.stats.misses - context->region_start_dcache.misses;
+	if (context->region_histograms) {
+		(context->region_histograms[i*CYCLE_HISTOGRAM_SIZE + histogramBucket(cycles)])++;
+	}
+
+	openRegion(context, pc);
+}
+
+/**
+  * @brief Returns the number of cycles of an instruction from the timing
+  *        model. The threaded code engine sums them per block when the 
+  *        block is built, the reference interpreter looks them up for 
+  *        each instruction.
+  * @param[in] context The simulator context.
+  * @param[in] opcode Opcode of the instruction.
+  * @return The number of cycles.
+  */
+static uint32_t instructionCycles(sim_context_t* context, int opcode) {
+	switch (opcode) {
+		/* meta instructions do not need any cycles */
 		case CYCLE_PRINT:
-			fprintf(outstream, "Current simulated cycles: %d.\n", sparc_cycle_counter_local);
-			/* we do not need a break because cycle counter will be reset anyway... */
-		/* reset local cycle counter */
 		case CYCLE_CLEAR:
-			sparc_cycle_counter_local = 0;
-			break;
-		case CALL:
-			operand_iter = 1;
-			unhandled_operands -= 1;
-			/* save next program counter value */
-			sparc_npc = operands[0].value.labeladdress;	
-			/* save current program counter value (byte address!) in o7 */
-			*(sparc_window_registers[CALL_ADDR_REGISTER]) = (cur_pc << 2);
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
-			break;
-		case SETHI:
-			dst_reg = operands[0].value.reg;
-			if (dst_reg != (G_REGISTER + 0)) {
-				dst_address = sparc_window_registers[dst_reg];
-			}
-			dst_value = (operands[1].value.imm22 << 10);
-			operand_iter = 2;
-			unhandled_operands -= 2;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
-			break;
-		case NOP:
-			/* do nothing */
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
-			break;
-		case BRANCH:
-			icc = operands[1].value.icc;
-			/* evaluate whether condition codes are matched */
-			if (evaluateICC(icc)) {	
-				sparc_npc = operands[0].value.labeladdress;
-			}
-			operand_iter = 2;
-			unhandled_operands -= 2;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;			
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
+		/* not implemented instructions */
+		case LDSTUB:
+		case LDSTUBA:
+		case SWAP:
+		case SWAPA:
+			return 0;
+		case LDSB:
+		case LDSH:
+		case LDUB:
+		case LDUH:
+		case LD:
+		case LDD:
+		case LDSBA:
+		case LDSHA:
+		case LDUBA:
+		case LDUHA:
+			return context->timing[TIMING_LOAD_SINGLE];
+		case LDA:
+		case LDDA:
+			return context->timing[TIMING_LOAD_DOUBLE];
+		case STB:
+		case STH:
+		case ST:
+		case STBA:
+		case STHA:
+		case STA:
+			return context->timing[TIMING_STORE_SINGLE];
+		case STD:
+		case STDA:
+			return context->timing[TIMING_STORE_DOUBLE];
+		case UMUL:
+		case UMULCC:
+		case SMUL:
+		case SMULCC:
+			return context->timing[TIMING_MUL];
+		case UDIV:
+		case UDIVCC:
+		case SDIV:
+		case SDIVCC:
+			return context->timing[TIMING_DIV];
+		case BRANCH:
+		case CALL:
+		case JUMPL:
+			return context->timing[TIMING_CONTROL];
+		case SAVE:
+		case RESTORE:
+			return context->timing[TIMING_WINDOW];
+		default:
+			return context->timing[TIMING_INTEGER];
+	}
+}
+
+/**
+  * @brief Fetches consecutive instructions through the instruction cache
+  *        and charges the miss penalties. Each line is looked up once, 
+  *        the further instructions of a line are hits.
+  * @param[in,out] context The simulator context.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] length Number of instructions.
+  */
+static void fetchInstructions(sim_context_t* context, uint32_t start, uint32_t length) {
+
+	cache_t* cache = &(context->icache);
+	uint32_t address = start << 2;
+	uint32_t end = (start + length) << 2;
+	uint32_t next;
+	uint32_t penalty = 0;
+
+	while (address < end) {
+		penalty += cacheAccess(cache, address);
+		next = ((address >> cache->line_bits) + 1) << cache->line_bits;
+		if (next > end || next == 0) {
+			next = end;
+		}
+		cache->stats.accesses += ((next - address) >> 2) - 1;
+		address = next;
+	}
+	context->cycle_counter += penalty;
+	context->cycle_counter_local += penalty;
+	context->fetch_cycles += penalty;
+}
+
+/**
+  * @brief Accesses the data cache, if enabled and not fast-forwarding,
+  *        for a load or store and charges the miss penalty.
+  * @param[in,out] context The simulator context.
+  * @param[in] address Byte address of the access.
+  */
+static inline void accessDataCache(sim_context_t* context, uint32_t address) {
+
+	uint32_t penalty;
+
+	if (context->dcache.tags && !(context->functional)) {
+		penalty = cacheAccess(&(context->dcache), address);
+		context->cycle_counter += penalty;
+		context->cycle_counter_local += penalty;
+	}
+}
+
+/**
+  * @brief Attributes the cycles since the current block was entered to
+  *        that block.
+  * @param[in,out] context The simulator context, which is profiled.
+  */
+static void flushProfile(sim_context_t* context) {
+	if (context->profile_pc != PROFILE_NONE) {
+		context->profile_cycles[context->profile_pc] += 
+			context->cycle_counter - context->profile_start;
+	}
+	context->profile_start = context->cycle_counter;
+}
+
+/**
+  * @brief Counts the entry of a block, which is executed completely, and
+  *        attributes the following cycles to it. Called before the cycles
+  *        of the block are charged. Fast-forwarding is not profiled.
+  * @param[in,out] context The simulator context, which is profiled.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] length Number of instructions.
+  */
+static inline void profileBlock(sim_context_t* context, uint32_t start, uint32_t length) {
+	if (context->functional) {
+		return;
+	}
+	flushProfile(context);
+	context->profile_pc = start;
+	(context->profile_entries[start])++;
+	(context->profile_exits[start + length - 1])++;
+}
+
+/**
+  * @brief Charges the cycles and instructions since the last entry to the
+  *        current function and updates the shadow call stack on the entry
+  *        of consecutive instructions. Called before the cycles of the
+  *        instructions are charged. Fast-forwarding is traced, but its 
+  *        cycles are discarded.
+  * @param[in,out] context The simulator context, whose calls are traced.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] length Number of instructions.
+  */
+static inline void traceCalls(sim_context_t* context, uint32_t start, uint32_t length) {
+	callsCharge(&(context->calls), context->cycle_counter, context->instruction_counter, 
+		!(context->functional));
+	if (callsEnter(&(context->calls), context->instructions, start, length)) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for call stack!");
+	}
+}
+
+/**
+  * @brief Predicts a conditional branch, if a predictor is enabled and
+  *        not fast-forwarding, and charges the penalty of a misprediction.
+  * @param[in,out] context The simulator context.
+  * @param[in] pc Word address of the branch.
+  * @param[in] target Word address of the branch target.
+  * @param[in] taken Whether the branch is taken.
+  */
+static inline void predictBranch(sim_context_t* context, uint32_t pc, uint32_t target, int taken) {
+
+	sim_branch_stats_t* stats;
+	int mispredicted;
+
+	if (context->predictor.model == PREDICTOR_NONE || context->functional) {
+		return;
+	}
+	if (!context->branch_stats) {
+		context->branch_stats = calloc(context->simulator->getNumberOfInstructions(context),
+			sizeof(sim_branch_stats_t));
+		if (!context->branch_stats) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for branch statistics!");
+		}
+	}
+
+	mispredicted = predictorUpdate(&(context->predictor), pc, target, taken);
+	stats = &(context->branch_stats[pc]);
+	(stats->branches)++;
+	stats->taken += taken;
+	stats->mispredictions += mispredicted;
+	if (mispredicted) {
+		context->cycle_counter += context->predictor.penalty;
+		context->cycle_counter_local += context->predictor.penalty;
+	}
+}
+
+/**
+  * @brief Builds the interlock information of the pipeline model, unless
+  *        it has already been built.
+  * @param[in,out] context The simulator context.
+  */
+static void buildPipeline(sim_context_t* context) {
+	if (pipelineBuild(&(context->pipeline), context->instructions, 
+		context->simulator->getNumberOfInstructions(context))) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for pipeline model!");
+	}
+}
+
+/**
+  * @brief Charges the interlock stalls of an instruction which is issued
+  *        after another one.
+  * @param[in,out] context The simulator context.
+  * @param[in] prev Word address of the previous instruction, or 
+  *                 PIPELINE_NONE.
+  * @param[in] cur Word address of the instruction.
+  */
+static void chargeStalls(sim_context_t* context, uint32_t prev, uint32_t cur) {
+
+	uint32_t load_use, control;
+
+	buildPipeline(context);
+	pipelineStalls(&(context->pipeline), prev, cur, &load_use, &control);
+	context->pipeline.stats.load_use += load_use;
+	context->pipeline.stats.control += control;
+	context->cycle_counter += load_use + control;
+	context->cycle_counter_local += load_use + control;
+}
+
+/**
+  * @brief Enters an executed store into the store buffer and charges the
+  *        stall, if the buffer is full. The time of the store excludes 
+  *        the instruction cache penalties, which the threaded code engine
+  *        charges on block entry, and the cycles charged ahead.
+  * @param[in,out] context The simulator context.
+  * @param[in] ahead Cycles which have been charged but not yet elapsed.
+  */
+static inline void chargeStore(sim_context_t* context, uint32_t ahead) {
+
+	uint32_t stall = pipelineStore(&(context->pipeline), 
+		context->cycle_counter - context->fetch_cycles - ahead);
+
+	context->cycle_counter += stall;
+	context->cycle_counter_local += stall;
+}
+
+/**
+  * @brief Executes the instruction at the program counter, which has 
+  *        already been fetched (see simulateStep()).
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream The output file stream where to write additional
+  *                      information. Currently only used for debugging.
+  * @return 1 if there are unhandled instructions, 0 if there is a return
+  *         from the main function.
+  */
+static int executeInstruction(sim_context_t* context, FILE* outstream) {
+
+	/* get current instruction */
+	sparc_instruction* cur_instruction = &(context->instructions[context->pc]);
+
+	/* get current opcode */
+	uint32_t opcode = cur_instruction->opcode;
+	/* save the number of unhandled operands of the current instruction */
+	uint32_t unhandled_operands = cur_instruction->num_operands;
+	/* save the address of the first unhandled operand of the current instruction */
+	uint32_t operand_iter = 0;
+	/* save operands array of the current instruction */
+	sparc_operand* operands = cur_instruction->operands;
+
+	/* for all conditional instructions, we need the icc of the instruction */
+	uint32_t icc;
+	/* whether a branch is taken */
+	int taken;
+	/* destination register number */
+	uint32_t dst_reg;
+	/* source 1 register number */ 
+	uint32_t src1_reg;
+	/* source 2 register number */
+	uint32_t src2_reg;
+	/* source 1 value */
+	uint32_t src1_op;
+	/* source 2 value */
+	uint32_t src2_op;
+
+	/* address of the destination register of current instruction */
+	uint32_t* dst_address = 0;
+	/* result of the current instruction */
+	uint32_t dst_value = 0;
+
+	/* new value for preg for predset/predclear instructions */
+	uint32_t next_preg = context->preg;
+
+	/* temporary memory address for load/store instructions */
+	uint32_t memory_address = 0;
+	/* loop variable for load/store instructions */
+	int32_t i;
+
+	/* for multiplication and division */
+	uint32_t tmp_y_value = 0;
+	uint64_t tmp_udivmul_result = 0;
+	int64_t tmp_sdivmul_result = 0;
+
+	/* values for instructions influencing the integer condition codes 
+	   of the psr */
+	uint32_t changes_icc = 0;
+	uint32_t next_icc_op = ICC_OP_NONE;
+	uint32_t next_icc = 0;
+
+	/* save current program counter for call instruction */
+	uint32_t cur_pc = context->pc;
+
+	/* boolean which saves if the current instruction will be executed */
+	uint32_t executed = 0;
+
+	/* cycles of the current instruction */
+	uint32_t cycles;
+
+	/* counts the instruction and its cycles, also for the fallback
+	   instructions of the threaded code engine */
+	(context->instruction_counter)++;
+	cycles = instructionCycles(context, opcode);
+	context->cycle_counter += cycles;
+	context->cycle_counter_local += cycles;
+
+	/* calculate next program counter */
+	context->pc = context->npc;
+	/* increment npc per default */
+	context->npc++;
+
+/* 	fprintf(outstream, "PC: %d, nPC: %d\n", cur_pc, context->pc); */
+/* 	fprintf(outstream, "Opcode: %d\n", opcode); */
+
+	/* if we are in a hardware loop, we have to check
+	   whether we have to branch */
+	if (context->hwloop_state.hwloop_state == HWLOOP_STATE_ACTIVE) {
+		/* the next calculated address is the end of the current loop */
+		if (context->npc == context->hwloop_state.end_address) {
+			/* decrement loop counter */
+			(context->hwloop_state.loop_counter)--; 
+			if (context->hwloop_state.loop_counter > 0) {
+				/* if the loop counter is greater than zero, we can branch */
+				context->npc = context->hwloop_state.start_address;
+			} else {
+				/* otherwise, we exit loop and leave the active state */
+				context->hwloop_state.hwloop_state = HWLOOP_STATE_IDLE;
+			}
+		}
+	}
+		
+	switch(opcode) {
+		/* reset local cycle counter and print out number of simulated cycles so far */
+		case CYCLE_PRINT:
+			closeRegion(context, cur_pc, outstream);
+			break;
+		/* reset local cycle counter */
+		case CYCLE_CLEAR:
+			openRegion(context, cur_pc);
+			context->run_events |= RUN_CYCLE_CLEAR;
+			break;
+		case CALL:
+			operand_iter = 1;
+			unhandled_operands -= 1;
+			/* save next program counter value */
+			context->npc = operands[0].value.labeladdress;	
+			/* save current program counter value (byte address!) in o7 */
+			SPARC_REGISTER(CALL_ADDR_REGISTER) = (cur_pc << 2);
+			break;
+		case SETHI:
+			dst_reg = operands[0].value.reg;
+			if (dst_reg != (G_REGISTER + 0)) {
+				dst_address = &SPARC_REGISTER(dst_reg);
+			}
+			dst_value = (operands[1].value.imm22 << 10);
+			operand_iter = 2;
+			unhandled_operands -= 2;
+			break;
+		case NOP:
+			/* do nothing */
+			break;
+		case BRANCH:
+			icc = operands[1].value.icc;
+			/* evaluate whether condition codes are matched */
+			taken = evaluateICC(context, icc);
+			if (taken) {	
+				context->npc = operands[0].value.labeladdress;
+			}
+			/* only conditional branches are predicted */
+			if (icc != CC_A && icc != CC_N) {
+				predictBranch(context, cur_pc, operands[0].value.labeladdress, taken);
+			}
+			operand_iter = 2;
+			unhandled_operands -= 2;
 			break;
 		/* all load instructions need the same address calculation */
 		case LDSB:
@@ -581,34 +2386,23 @@ int simulateStep(FILE* outstream) {
 			/* save destination register */
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != (G_REGISTER + 0)) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			/* calculate memory address */
 			src1_reg = operands[1].value.reg;
-			memory_address = *(sparc_window_registers[src1_reg]);
+			memory_address = SPARC_REGISTER(src1_reg);
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
 			memory_address = memory_address + src2_op;
-			/* always load 4 bytes */
-			dst_value = 0;
-			for (i = 0; i < 4; i++) {
-				dst_value <<= 8;
-				dst_value |= (uint32_t) (data_memory[(memory_address & 0xfffffffc) + i]);
-			}
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			/* set cycle counter corresponding to load operation */
-			sparc_cycle_counter += CYCLES_LOAD_SINGLE;
-			sparc_cycle_counter_local += CYCLES_LOAD_SINGLE;
 			break;
 		case LDA:
 		case LDDA:
-			sparc_cycle_counter += CYCLES_LOAD_DOUBLE;
-			sparc_cycle_counter_local += CYCLES_LOAD_DOUBLE;
 			break;
 		/* all store instructions have the same address calculation */
 		case STB:
@@ -619,27 +2413,22 @@ int simulateStep(FILE* outstream) {
 		case STA:
 			/* save value which will be saved to destination */
 			dst_reg = operands[0].value.reg;
-			dst_value = *(sparc_window_registers[dst_reg]);
+			dst_value = SPARC_REGISTER(dst_reg);
 			/* calculate memory address */
 			src1_reg = operands[1].value.reg;
-			memory_address = *(sparc_window_registers[src1_reg]);
+			memory_address = SPARC_REGISTER(src1_reg);
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
 			memory_address = memory_address + src2_op;
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			/* set cycle counter corresponding to store operation */
-			sparc_cycle_counter += CYCLES_STORE_SINGLE;
-			sparc_cycle_counter_local += CYCLES_STORE_SINGLE;
 			break;
 		case STDA:
 		case STD:
-			sparc_cycle_counter += CYCLES_STORE_DOUBLE;
-			sparc_cycle_counter_local += CYCLES_STORE_DOUBLE;
 			break;
 		case LDSTUB:
 			break;
@@ -653,40 +2442,38 @@ int simulateStep(FILE* outstream) {
 		case RESTORE:
 			/* first get source operands from old window */
 			src1_reg = operands[1].value.reg;
-			src1_op = *(sparc_window_registers[src1_reg]);
+			src1_op = SPARC_REGISTER(src1_reg);
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
 			dst_value = src1_op + src2_op;
 			/* change current window */
 			if (opcode == SAVE) {
-				changeCWP(0);
+				changeCWP(context, 0);
 			} else {
-				changeCWP(1);
+				changeCWP(context, 1);
 			}
 			/* get destination address for new window */
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != (G_REGISTER + 0)) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case JUMPL:
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != (G_REGISTER + 0)) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			src1_reg = operands[1].value.reg;
-			memory_address = *(sparc_window_registers[src1_reg]);
+			memory_address = SPARC_REGISTER(src1_reg);
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
@@ -695,78 +2482,70 @@ int simulateStep(FILE* outstream) {
 			memory_address >>= 2;
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case RD:
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != (G_REGISTER) + 0) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			src1_reg = operands[1].value.reg;
 			if (src1_reg != Y_REGISTER_NO) {
-				gen_simulator->cleanUp();
+				context->simulator->cleanUp(context);
 				simerror("Unknown destination register for rd instruction!");
 			}
-			dst_value = sparc_y;
+			dst_value = context->y;
 			operand_iter = 2;
 			unhandled_operands -= 2;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case WR:
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != Y_REGISTER_NO) {
-				gen_simulator->cleanUp();
+				context->simulator->cleanUp(context);
 				simerror("Unknown destination register for wr instruction!");
 			}
-			dst_address = &sparc_y;
+			dst_address = &context->y;
 			src1_reg = operands[1].value.reg;
-			src1_op = *(sparc_window_registers[src1_reg]); 
+			src1_op = SPARC_REGISTER(src1_reg); 
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
 			dst_value = src1_op ^ src2_op;
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case MOV:
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != G_REGISTER + 0) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			src1_reg = operands[1].value.reg;
-			src1_op = *(sparc_window_registers[src1_reg]);
+			src1_op = SPARC_REGISTER(src1_reg);
 			/* src2 = dst! */
 			src2_reg = dst_reg;
-			src2_op = *(sparc_window_registers[src2_reg]);
+			src2_op = SPARC_REGISTER(src2_reg);
 			icc = operands[2].value.icc;
 			/* if condition is true, take src1 value, src2 otherwise */
-			if (evaluateICC(icc)) {
+			if (evaluateICC(context, icc)) {
 				dst_value = src1_op;
 			} else {
 				dst_value = src2_op;
 			}
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case SEL:
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != G_REGISTER + 0) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 
 			/* get source operand 1 */
 			if (operands[1].type == OPERAND_TYPE_REGISTER) {
 				src1_reg = operands[1].value.reg;
-				src1_op = *(sparc_window_registers[src1_reg]);
+				src1_op = SPARC_REGISTER(src1_reg);
 			} else {
 				src1_op = operands[1].value.simm8;
 			}
@@ -774,7 +2553,7 @@ int simulateStep(FILE* outstream) {
 			/* get source operand 2 */
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else if (operands[2].type == OPERAND_TYPE_SIMM11) {
 				src2_op = operands[2].value.simm11;
 			} else if (operands[2].type == OPERAND_TYPE_SIMM8) {
@@ -784,7 +2563,7 @@ int simulateStep(FILE* outstream) {
 			icc = operands[3].value.icc;
 			
 			/* selection process */
-			if (evaluateICC(icc)) {
+			if (evaluateICC(context, icc)) {
 				dst_value = src1_op;
 			} else {
 				dst_value = src2_op;
@@ -792,76 +2571,66 @@ int simulateStep(FILE* outstream) {
 
 			operand_iter = 4;
 			unhandled_operands -= 4;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 
 			break;
 		case HWLOOP_INIT:
 			dst_reg = operands[0].value.loopreg;
 			switch (dst_reg) {
 				case LOOPS_REGISTER:
-					sparc_hwloop_state.start_address = operands[1].value.labeladdress;
+					context->hwloop_state.start_address = operands[1].value.labeladdress;
 					break;
 				case LOOPE_REGISTER:
-					sparc_hwloop_state.end_address = operands[1].value.labeladdress;
+					context->hwloop_state.end_address = operands[1].value.labeladdress;
 					break;
 				case LOOPB_REGISTER:
 					/* save the loop bounds into loop counter register */
 					if (operands[1].type == OPERAND_TYPE_REGISTER) {
 						src1_reg = operands[1].value.reg;
-						sparc_hwloop_state.loop_counter = *(sparc_window_registers[src1_reg]); 
+						context->hwloop_state.loop_counter = SPARC_REGISTER(src1_reg); 
 					} else {
-						sparc_hwloop_state.loop_counter = operands[1].value.imm22;
+						context->hwloop_state.loop_counter = operands[1].value.imm22;
 					}
 					break;
 				default:
-					gen_simulator->cleanUp();
+					context->simulator->cleanUp(context);
 					simerror("Unknown register for hwloop init!");
 					break;
 			}
 			operand_iter = 2;
 			unhandled_operands -= 2;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case HWLOOP_START:
 			/* only set current loop state to active */
-			sparc_hwloop_state.hwloop_state = HWLOOP_STATE_ACTIVE;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
+			context->hwloop_state.hwloop_state = HWLOOP_STATE_ACTIVE;
 			break;
 		case PREDBEGIN:
 			/* we have predicated blocks on condition code */
 			if (operands[0].type == OPERAND_TYPE_ICC) {
 				icc = operands[0].value.icc;
-				sparc_pred_state.predicate_state = PREDICATE_STATE_ICC;
-				sparc_pred_state.predicate_condition.icc = icc;
+				context->pred_state.predicate_state = PREDICATE_STATE_ICC;
+				context->pred_state.predicate_condition.icc = icc;
 			} else if (operands[0].type == OPERAND_TYPE_PREG) {
 				/* we have predicated blocks on predicate registers */
 				src1_reg = operands[0].value.preg;
-				sparc_pred_state.predicate_state = PREDICATE_STATE_PREG;
-				sparc_pred_state.predicate_condition.preg_condition.preg = src1_reg;
+				context->pred_state.predicate_state = PREDICATE_STATE_PREG;
+				context->pred_state.predicate_condition.preg_condition.preg = src1_reg;
 				src2_op = operands[1].value.tf;
-				sparc_pred_state.predicate_condition.preg_condition.tf = src2_op;
+				context->pred_state.predicate_condition.preg_condition.tf = src2_op;
 			} else {
-				cleanUp();
+				cleanUp(context);
 				simerror("Unknown operand type for predbegin instruction!");
 			}
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case PREDEND:
 			/* save that predicated block is finished */
-			sparc_pred_state.predicate_state = PREDICATE_STATE_NONE;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
+			context->pred_state.predicate_state = PREDICATE_STATE_NONE;
 			break;
 		case PREDSET:
 			dst_reg = operands[0].value.preg;
 			/* if second operand is icc, we have to set t and f on condition */
 			if (unhandled_operands > 1 && operands[1].type == OPERAND_TYPE_ICC) {
 				icc = operands[1].value.icc;
-				if (evaluateICC(icc)) {
+				if (evaluateICC(context, icc)) {
 					/* current icc is true => set t and clear f preg */
 					next_preg &= ~(1<<(2*dst_reg));
 					next_preg |= (1<<(2*dst_reg + 1));
@@ -879,8 +2648,6 @@ int simulateStep(FILE* outstream) {
 				operand_iter = 1;
 				unhandled_operands -= 1;
 			}
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case PREDCLEAR:
 			/* clear t and f predicate register */
@@ -889,12 +2656,10 @@ int simulateStep(FILE* outstream) {
 			next_preg &= ~(1<<(2*dst_reg + 1));
 			operand_iter = 1;
 			unhandled_operands -= 1;
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 		case UNKNOWN: 
 			fprintf(stderr, "UNKOWN opcode = %d\n", opcode);
-			cleanUp();
+			cleanUp(context);
 			simerror("Not supported opcode encoutered!");
 			break;
 		/* equal for all arithmetic/logic instructions */
@@ -902,25 +2667,22 @@ int simulateStep(FILE* outstream) {
 			/* save address of destination register */
 			dst_reg = operands[0].value.reg;
 			if (dst_reg != (G_REGISTER + 0)) {
-				dst_address = sparc_window_registers[dst_reg];
+				dst_address = &SPARC_REGISTER(dst_reg);
 			}
 			/* save value of src1 register */
 			src1_reg = operands[1].value.reg;
-			src1_op = *(sparc_window_registers[src1_reg]);
+			src1_op = SPARC_REGISTER(src1_reg);
 			/* depending on type of src2, save either contents of
 			   register or the sign extended immediate value */
 			if (operands[2].type == OPERAND_TYPE_REGISTER) {
 				src2_reg = operands[2].value.reg;
-				src2_op = *(sparc_window_registers[src2_reg]);
+				src2_op = SPARC_REGISTER(src2_reg);
 			} else {
 				src2_op = operands[2].value.simm13;
 			}
 			/* save that we have handled the first three operands */
 			operand_iter = 3;
 			unhandled_operands -= 3;
-			/* all integer instructions take the same amount of cycles */
-			sparc_cycle_counter += CYCLES_INTEGER_INSTR;
-			sparc_cycle_counter_local += CYCLES_INTEGER_INSTR;
 			break;
 	}
 
@@ -976,7 +2738,8 @@ int simulateStep(FILE* outstream) {
 			break;
 		case ADDX:
 		case ADDXCC:
-			dst_value = src1_op + src2_op + PSR_GET_C(sparc_psr);
+			materializeICC(context);
+			dst_value = src1_op + src2_op + PSR_GET_C(context->psr);
 			break;
 		case SUB:
 		case SUBCC:
@@ -989,7 +2752,8 @@ int simulateStep(FILE* outstream) {
 			break;
 		case SUBX:
 		case SUBXCC:
-			dst_value = src1_op - src2_op - PSR_GET_C(sparc_psr);
+			materializeICC(context);
+			dst_value = src1_op - src2_op - PSR_GET_C(context->psr);
 			break;
 		case MULSCC:
 			break;
@@ -998,50 +2762,43 @@ int simulateStep(FILE* outstream) {
 			tmp_udivmul_result = ((uint64_t) src1_op) * ((uint64_t) src2_op);
 			dst_value = (uint32_t) (tmp_udivmul_result & 0xffffffffL);
 			tmp_y_value = (uint32_t) ((tmp_udivmul_result >> 32) & 0xffffffffL);
-			sparc_cycle_counter += (CYCLES_MUL - CYCLES_INTEGER_INSTR);
-			sparc_cycle_counter_local += (CYCLES_MUL - CYCLES_INTEGER_INSTR);
 			break;
 		case SMUL:
 		case SMULCC:
 			tmp_sdivmul_result = ((int64_t) src1_op) * ((int64_t) ((int32_t) src2_op));
 			dst_value = (uint32_t) (tmp_sdivmul_result & 0xffffffffL);
 			tmp_y_value = (uint32_t) ((tmp_sdivmul_result >> 32) & 0xffffffffL);
-			sparc_cycle_counter += (CYCLES_MUL - CYCLES_INTEGER_INSTR);
-			sparc_cycle_counter_local += (CYCLES_MUL - CYCLES_INTEGER_INSTR);
 			break;
 		case UDIV:
 		case UDIVCC:
 			if (src2_op == 0) {
-				gen_simulator->cleanUp();
+				context->simulator->cleanUp(context);
 				simerror("Encountered division by zero!");
 			}
-			tmp_udivmul_result = (uint64_t) sparc_y;
+			tmp_udivmul_result = (uint64_t) context->y;
 			tmp_udivmul_result <<= 32;
 			tmp_udivmul_result |= src1_op;
 			tmp_udivmul_result = tmp_udivmul_result / (uint64_t) src2_op;
 			dst_value = (uint32_t) (tmp_udivmul_result & 0xffffffffL);
-			sparc_cycle_counter += (CYCLES_DIV - CYCLES_INTEGER_INSTR);
-			sparc_cycle_counter_local += (CYCLES_DIV - CYCLES_INTEGER_INSTR);
 			break;
 		case SDIV:
 		case SDIVCC:
 			if (src2_op == 0) {
-				gen_simulator->cleanUp();
+				context->simulator->cleanUp(context);
 				simerror("Encountered division by zero!");
 			}
-			tmp_sdivmul_result = (int64_t) ((int32_t) sparc_y);
+			tmp_sdivmul_result = (int64_t) ((int32_t) context->y);
 			tmp_sdivmul_result <<= 32;
 			tmp_sdivmul_result |= src1_op;
 			tmp_sdivmul_result = tmp_sdivmul_result / (int64_t) ((int32_t) src2_op);
 			dst_value = (uint32_t) (tmp_sdivmul_result & 0xffffffffL);
-			sparc_cycle_counter += (CYCLES_DIV - CYCLES_INTEGER_INSTR);
-			sparc_cycle_counter_local += (CYCLES_DIV - CYCLES_INTEGER_INSTR);
 			break;
 		default:
 			break;
 		}
 
-	/* handle all instruction which influence icc of psr */
+	/* handle all instruction which influence icc of psr, the icc 
+	   are only calculated when they are read */
 	switch (opcode) {
 		/* all of the following instructions only check for
 		   zero and negative */
@@ -1053,81 +2810,28 @@ int simulateStep(FILE* outstream) {
 		case XNORCC:
 		case UMULCC:
 		case SMULCC:
-			changes_icc = 1;	
-			/* clear next icc */
-			next_icc = 0;
-			if (dst_value & (1<<31)) { 
-				PSR_SET_N(next_icc);
-			}
-			if (dst_value == 0) {
-				PSR_SET_Z(next_icc);
-			}
+		/* udivcc never sets the overflow bit */
+		case UDIVCC:
+			changes_icc = 1;
+			next_icc_op = ICC_OP_LOGIC;
 			break;
 		case ADDCC:
 		case TADDCC:
 		case TADDCCTV:
 			changes_icc = 1;
-			/* clear next icc */
-			next_icc = 0;
-			if (dst_value & (1<<31)) {
-				PSR_SET_N(next_icc);
-			}
-			if (dst_value == 0) {
-				PSR_SET_Z(next_icc);
-			}
-			if ( ( (src1_op & (1<<31)) && (src2_op & (1<<31)) && (!(dst_value & (1<<31))) ) ||
-				 ( (!(src1_op & (1<<31))) && (!(src2_op & (1<<31))) && (dst_value & (1<<31)) ) ) {
-				PSR_SET_V(next_icc);
-			}
-			if ( ( (src1_op & (1<<31)) && (src2_op & (1<<31)) ) ||
-				 ( (!(dst_value & (1<<31))) && ((src1_op & (1<<31)) || (src2_op & (1<<31))) ) ) {
-				PSR_SET_C(next_icc);
-			}
+			next_icc_op = ICC_OP_ADD;
 			break;
 		case SUBCC:
 		case TSUBCC:
 		case TSUBCCTV:
 			changes_icc = 1;
-			/* clear next icc */
-			next_icc = 0;
-			if (dst_value & (1<<31)) {
-				PSR_SET_N(next_icc);
-			}
-			if (dst_value == 0) {
-				PSR_SET_Z(next_icc);
-			}
-			if ( ( (src1_op & (1<<31)) && (!(src2_op & (1<<31))) && (!(dst_value & (1<<31))) ) ||
-				 ( (!(src1_op & (1<<31))) && (src2_op & (1<<31)) && (dst_value & (1<<31)) ) ) {
-				PSR_SET_V(next_icc);
-			}
-			if ( ( (!(src1_op & (1<<31))) && (src2_op & (1<<31)) ) ||
-				 ( (dst_value & (1<<31)) && ((!(src1_op & (1<<31))) || (src2_op & (1<<31))) ) ) {
-				PSR_SET_C(next_icc);
-			}
+			next_icc_op = ICC_OP_SUB;
 			break;
-		case UDIVCC:
-			changes_icc = 1;
-			/* clear next icc */
-			next_icc = 0;
-			if (dst_value & (1<<31)) {
-				PSR_SET_N(next_icc);
-			}
-			if (dst_value == 0) {
-				PSR_SET_Z(next_icc);
-			}
-			if (tmp_udivmul_result & 0xffffffff00000000L) {
-				PSR_SET_V(next_icc);
-			}
 		case SDIVCC:
 			changes_icc = 1;
-			/* clear next icc */
-			next_icc = 0;
-			if (dst_value & (1<<31)) {
-				PSR_SET_N(next_icc);
-			}
-			if (dst_value == 0) {
-				PSR_SET_Z(next_icc);
-			}
+			next_icc_op = ICC_OP_NONE;
+			/* calculate icc directly */
+			next_icc = iccLogic(dst_value);
 			if ((tmp_sdivmul_result & 0xffffffff00000000L) && 
 				((tmp_sdivmul_result >> 32) != 0xffffffffL)) {
 				PSR_SET_V(next_icc);
@@ -1138,104 +2842,71 @@ int simulateStep(FILE* outstream) {
 
 	/* check whether the current instruction is predicated
 	   or if we are within a predicated block... */
-	if (sparc_pred_state.predicate_state == PREDICATE_STATE_NONE) {
+	if (context->pred_state.predicate_state == PREDICATE_STATE_NONE) {
 		executed = 1;
 	}
 	/* predicated blocks on integer condition codes */
-	if (sparc_pred_state.predicate_state == PREDICATE_STATE_ICC &&
-		evaluateICC(sparc_pred_state.predicate_condition.icc)) {
+	if (context->pred_state.predicate_state == PREDICATE_STATE_ICC &&
+		evaluateICC(context, context->pred_state.predicate_condition.icc)) {
 		executed = 1;
 	} 
 	/* predicated blocks on predicate registers */
-	if (sparc_pred_state.predicate_state == PREDICATE_STATE_PREG &&
-		evaluatePred(sparc_pred_state.predicate_condition.preg_condition.preg, 
-					sparc_pred_state.predicate_condition.preg_condition.tf)) {
+	if (context->pred_state.predicate_state == PREDICATE_STATE_PREG &&
+		evaluatePred(context, context->pred_state.predicate_condition.preg_condition.preg, 
+					context->pred_state.predicate_condition.preg_condition.tf)) {
 		executed = 1;
 	}
 
 	if (executed) {
+		if (memoryOpcodeName(opcode)) {
+			accessDataCache(context, memory_address);
+		}
+		if (context->pipeline.store_entries && context->pipeline.info[cur_pc].store && 
+			!(context->functional)) {
+			chargeStore(context, context->pipeline.ahead);
+		}
+
 		/* handle load/store instructions */
 		switch (opcode) {
 			/* ldsba not implemented => same as normal ldsb */
 			case LDSBA:
 			case LDSB:
 				if (dst_address) {
-					/* get lower address */
-					i = memory_address & 0x00000003;
-					/* get byte according to address */
-					dst_value >>= ((3 - i)*8); 
-					dst_value &= 0x000000ff;
-					/* sign extension */
-					if (dst_value & 0x00000080) {
-						dst_value |= 0xffffff00;
-					}
-					*dst_address = dst_value;
-	/* 				fprintf(outstream, "ldsb [0x%08x]= 0x%08x\n", memory_address, dst_value); */
+					*dst_address = LOAD_SBYTE(memory_address);
 				}
 				break;
 			/* ldsha not implemented => same as normal ldsh */
 			case LDSHA:
 			case LDSH:
 				if (dst_address) {
-					/* check for valid address: LSB has to be zero! */
-					if (memory_address & 0x00000001) {
-						gen_simulator->cleanUp();
-						simerror("Unknown memory address for ldsh instruction!");
-					}
-					/* get lower address */
-					i = (memory_address & 0x00000002) >> 1;
-					/* get halfword according to address */
-					dst_value >>= ((1 - i)*16); 
-					dst_value &= 0x0000ffff;
-					/* sign extension */
-					if (dst_value & 0x00008000) {
-						dst_value |= 0xffff0000;
-					}
-					*dst_address = dst_value;
-	/* 				fprintf(outstream, "ldsh [0x%08x]= 0x%08x\n", memory_address, dst_value); */
+					CHECK_ALIGNMENT(memory_address, 0x00000001, 
+						"Unknown memory address for ldsh instruction!");
+					*dst_address = LOAD_SHALF(memory_address);
 				}
 				break;
 			/* lduba not implemented => same as normal ldub */
 			case LDUBA:
 			case LDUB:
 				if (dst_address) {
-					/* get lower address */
-					i = memory_address & 0x00000003;
-					/* get byte according to address */
-					dst_value >>= ((3 - i)*8); 
-					dst_value &= 0x000000ff;
-					*dst_address = dst_value;
-	/* 				fprintf(outstream, "ldub [0x%08x]= 0x%08x\n", memory_address, dst_value); */
+					*dst_address = LOAD_BYTE(memory_address);
 				}
 				break;
 			/* lduha not implemented => same as normal lduh */
 			case LDUHA:
 			case LDUH:
 				if (dst_address) {
-					/* check for valid address: LSB has to be zero! */
-					if (memory_address & 0x00000001) {
-						gen_simulator->cleanUp();
-						simerror("Unknown memory address for lduh instruction!");
-					}
-					/* get lower address */
-					i = (memory_address & 0x00000002) >> 1;
-					/* get halfword according to address */
-					dst_value >>= ((1 - i)*16); 
-					dst_value &= 0x0000ffff;
-					*dst_address = dst_value;
+					CHECK_ALIGNMENT(memory_address, 0x00000001, 
+						"Unknown memory address for lduh instruction!");
+					*dst_address = LOAD_HALF(memory_address);
 				}
 				break;
 			/* lda not implemented => same as normal ld */
 			case LDA:
 			case LD:
 				if (dst_address) {
-					/* check address to be valid */
-					if (memory_address & 0x00000003) {
-						gen_simulator->cleanUp();
-						simerror("Unknown memory address for ld instruction!");
-					}
-					
-					*dst_address = dst_value;
+					CHECK_ALIGNMENT(memory_address, 0x00000003, 
+						"Unknown memory address for ld instruction!");
+					*dst_address = LOAD_WORD(memory_address);
 				}
 				break;
 			case LDDA:
@@ -1245,33 +2916,19 @@ int simulateStep(FILE* outstream) {
 				break;
 			case STBA:
 			case STB:
-				data_memory[memory_address] = (uint8_t) (dst_value & (0x000000ff));
+				STORE_BYTE(memory_address, dst_value);
 				break;
 			case STHA:
 			case STH:
-				/* check address to be valid */
-				if (memory_address & 0x00000001) {
-					gen_simulator->cleanUp();
-					simerror("Unknown destination address for sth instruction!");
-				}
-				for (i = 1; i >= 0; i--) {
-					data_memory[(memory_address & 0xfffffffe) + i] = 
-						(uint8_t) (dst_value & (0x000000ff));
-					dst_value >>= 8;
-				}
+				CHECK_ALIGNMENT(memory_address, 0x00000001, 
+					"Unknown destination address for sth instruction!");
+				STORE_HALF(memory_address, dst_value);
 				break;
 			case STA:
 			case ST:
-				/* check address to be valid */
-				if (memory_address & 0x00000003) {
-					gen_simulator->cleanUp();
-					simerror("Unknown destination address for st instruction!");
-				}
-				for (i = 3; i >= 0; i--) {
-					data_memory[(memory_address & 0xfffffffc) + i] = 
-						(uint8_t) (dst_value & (0x000000ff));
-					dst_value >>= 8;
-				}
+				CHECK_ALIGNMENT(memory_address, 0x00000003, 
+					"Unknown destination address for st instruction!");
+				STORE_WORD(memory_address, dst_value);
 				break;
 			case STDA:
 			case STD:
@@ -1279,7 +2936,7 @@ int simulateStep(FILE* outstream) {
 					"implement store double instructions!\n");
 				break;
 			case JUMPL:
-				sparc_npc = memory_address;
+				context->npc = memory_address;
 				if (dst_address) {
 					*dst_address = (cur_pc << 2);
 				}
@@ -1287,14 +2944,14 @@ int simulateStep(FILE* outstream) {
 			/* handle predset/predclear instructions */
 			case PREDSET:
 			case PREDCLEAR:
-				sparc_preg = next_preg;
+				context->preg = next_preg;
 				break;
 			/* write y register in case of a multiplication */
 			case UMUL:
 			case UMULCC:
 			case SMUL:
 			case SMULCC:
-				sparc_y = tmp_y_value;
+				context->y = tmp_y_value;
 			default:
 				if (dst_address) {
 					*dst_address = dst_value;
@@ -1303,14 +2960,19 @@ int simulateStep(FILE* outstream) {
 		}
 		/* if the current instruction influences the icc... */
 		if (changes_icc) {
-			PSR_CLR_ICCS(sparc_psr);
-			sparc_psr |= next_icc;
+			if (next_icc_op == ICC_OP_NONE) {
+				context->lazy_icc.op = ICC_OP_NONE;
+				PSR_CLR_ICCS(context->psr);
+				context->psr |= next_icc;
+			} else {
+				setLazyICC(context, next_icc_op, src1_op, src2_op, dst_value);
+			}
 		}
 
 	}
 
 	/* if the next instruction is end of memory => return from main... */
-	if (sparc_pc == (END_OF_INS_MEM>>2)) {
+	if (context->pc == (END_OF_INS_MEM>>2)) {
 		return 0;
 	} else {
 		return 1;
@@ -1319,514 +2981,2033 @@ int simulateStep(FILE* outstream) {
 }
 
 /**
-  * @brief Prints the return value of the main function and the
-  *        number of simulated cycles to the given file stream.
-  * @param[in] outstream File stream where to print the information.
+  * @brief Fetches and executes the instruction at the program counter,
+  *        without profiling it. Fast-forwarding skips the instruction 
+  *        cache and the pipeline model.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream The output file stream where to write additional
+  *                      information. Currently only used for debugging.
+  * @return 1 if there are unhandled instructions, 0 if there is a return
+  *         from the main function.
   */
-void printResults(FILE* outstream) {
-	fprintf(outstream, "Main function returned value 0x%08x.\n", 
-		*(sparc_window_registers[RET_VAL_REGISTER]));
-	fprintf(outstream, "Simulated cycles: %d.\n", sparc_cycle_counter);
-}
+static int stepInstruction(sim_context_t* context, FILE* outstream) {
+	if (context->functional) {
+		return executeInstruction(context, outstream);
+	}
+	if (context->icache.tags) {
+		fetchInstructions(context, context->pc, 1);
+	}
+	if (context->pipeline.enabled) {
+		chargeStalls(context, context->pipeline.last, context->pc);
+		context->pipeline.last = context->pc;
+	}
+	return executeInstruction(context, outstream);
+}
+
+/**
+  * @brief Profiles, traces and executes the instruction at the program
+  *        counter, within run() or simulateStep() which catch its 
+  *        memory faults.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream The output file stream where to write additional
+  *                      information. Currently only used for debugging.
+  * @return 1 if there are unhandled instructions, 0 if there is a return
+  *         from the main function.
+  */
+static int simulateInstruction(sim_context_t* context, FILE* outstream) {
+	/* a memory fault is reported for this instruction */
+	context->fault_start = context->pc;
+	context->fault_length = 1;
+	if (context->profile_entries) {
+		profileBlock(context, context->pc, 1);
+	}
+	if (context->calls.nodes) {
+		traceCalls(context, context->pc, 1);
+	}
+	return stepInstruction(context, outstream);
+}
+
+/**
+  * @brief Simulates one step and returns 0 if a return from the main
+  *        function has been detected.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream The output file stream where to write additional
+  *                      information. Currently only used for debugging.
+  * @return 1 if there are unhandled instructions, 0 if there is a return
+  *         from the main function.
+  */
+int simulateStep(sim_context_t* context, FILE* outstream) {
+
+	int result;
+
+	/* memory faults of this thread belong to this context */
+	if (sigsetjmp(context->fault_jump, 0)) {
+		reportMemoryFault(context);
+	}
+	fault_context = context;
+	result = simulateInstruction(context, outstream);
+	fault_context = 0;
+
+	return result;
+}
+
+/*=====================================*/
+/* Threaded code engine                */
+/*=====================================*/
+
+/**
+  * @brief Evaluates whether the current instruction is executed with
+  *        respect to the predication state of the processor.
+  * @param[in,out] context The simulator context.
+  * @return 1 if the instruction is executed, 0 otherwise.
+  */
+static int evaluatePredState(sim_context_t* context) {
+	switch (context->pred_state.predicate_state) {
+		case PREDICATE_STATE_NONE:
+			return 1;
+		case PREDICATE_STATE_ICC:
+			return evaluateICC(context, context->pred_state.predicate_condition.icc);
+		case PREDICATE_STATE_PREG:
+			return evaluatePred(context, context->pred_state.predicate_condition.preg_condition.preg, 
+						context->pred_state.predicate_condition.preg_condition.tf);
+		default:
+			return 0;
+	}
+}
+
+/**
+  * @brief Shifts the given value arithmetically to the right, exactly 
+  *        as the reference interpreter does.
+  * @param[in] value Value to be shifted.
+  * @param[in] count Number of bit positions.
+  * @return The shifted value.
+  */
+static uint32_t shiftRightArithmetic(uint32_t value, uint32_t count) {
+	if ((int32_t) count <= 0) {
+		return value;
+	}
+	if (count >= 32) {
+		return (value & 0x80000000) ? 0xffffffff : 0;
+	}
+	return (uint32_t) (((int32_t) value) >> count);
+}
+
+/**
+  * @brief Divides the 64 bit value y:src1 by src2 (unsigned).
+  * @param[in] context The simulator context.
+  * @param[in] src1 Lower 32 bits of the dividend.
+  * @param[in] src2 Divisor.
+  * @return The quotient.
+  */
+static uint64_t divideUnsigned(sim_context_t* context, uint32_t src1, uint32_t src2) {
+	uint64_t result;
+
+	if (src2 == 0) {
+		context->simulator->cleanUp(context);
+		simerror("Encountered division by zero!");
+	}
+	result = (uint64_t) context->y;
+	result <<= 32;
+	result |= src1;
+	return result / (uint64_t) src2;
+}
+
+/**
+  * @brief Divides the 64 bit value y:src1 by src2 (signed).
+  * @param[in] context The simulator context.
+  * @param[in] src1 Lower 32 bits of the dividend.
+  * @param[in] src2 Divisor.
+  * @return The quotient.
+  */
+static int64_t divideSigned(sim_context_t* context, uint32_t src1, uint32_t src2) {
+	int64_t result;
+
+	if (src2 == 0) {
+		context->simulator->cleanUp(context);
+		simerror("Encountered division by zero!");
+	}
+	result = (int64_t) ((int32_t) context->y);
+	result <<= 32;
+	result |= src1;
+	return result / (int64_t) ((int32_t) src2);
+}
+
+/**
+  * @brief Translates the source operand 2 of a three operand instruction
+  *        and selects the register or immediate form of the handler.
+  * @param[in] operand Source operand 2 of the abstract instruction.
+  * @param[out] code Pre-decoded instruction.
+  * @param[in] reg_form Handler for register source operand 2.
+  * @return Handler of the matching operand form.
+  */
+static threaded_handler_t translateSource2(sparc_operand* operand, 
+		threaded_instruction_t* code, threaded_handler_t reg_form) {
+	if (operand->type == OPERAND_TYPE_REGISTER) {
+		code->rs2 = operand->value.reg;
+		return reg_form;
+	}
+	code->imm = operand->value.simm13;
+	/* immediate form always directly follows register form */
+	return reg_form + 1;
+}
+
+/**
+  * @brief Translates one abstract instruction into a pre-decoded 
+  *        instruction of the threaded code engine.
+  * @param[in] instruction The abstract instruction.
+  * @param[out] code Pre-decoded instruction without handler address.
+  * @return The handler executing the instruction.
+  */
+static threaded_handler_t translateInstruction(sparc_instruction* instruction, 
+		threaded_instruction_t* code) {
+
+	sparc_operand* operands = instruction->operands;
+	threaded_handler_t handler = THREADED_FALLBACK;
+
+	code->rd = 0;
+	code->rs1 = 0;
+	code->rs2 = 0;
+	code->icc = 0;
+	code->imm = 0;
+
+	switch (instruction->opcode) {
+		case NOP:
+			return THREADED_NOP;
+		case CYCLE_PRINT:
+			return THREADED_CYCLE_PRINT;
+		case CYCLE_CLEAR:
+			return THREADED_CYCLE_CLEAR;
+		case HWLOOP_START:
+			return THREADED_HWLOOP_START;
+		case PREDEND:
+			return THREADED_PREDEND;
+		case SETHI:
+			code->rd = operands[0].value.reg;
+			code->imm = operands[1].value.imm22 << 10;
+			return THREADED_SETHI;
+		case CALL:
+			code->imm = operands[0].value.labeladdress;
+			return THREADED_CALL;
+		case BRANCH:
+			code->imm = operands[0].value.labeladdress;
+			code->icc = operands[1].value.icc;
+			if (code->icc == CC_A) {
+				return THREADED_BA;
+			} else if (code->icc == CC_N) {
+				return THREADED_BN;
+			}
+			return THREADED_BICC;
+		case RD:
+			if (operands[1].value.reg != Y_REGISTER_NO) {
+				return THREADED_FALLBACK;
+			}
+			code->rd = operands[0].value.reg;
+			return THREADED_RD_Y;
+		case WR:
+			if (operands[0].value.reg != Y_REGISTER_NO) {
+				return THREADED_FALLBACK;
+			}
+			code->rs1 = operands[1].value.reg;
+			return translateSource2(&operands[2], code, THREADED_WR_R);
+		case MOV:
+			code->rd = operands[0].value.reg;
+			code->rs1 = operands[1].value.reg;
+			code->icc = operands[2].value.icc;
+			return THREADED_MOV;
+		case SEL:
+			code->rd = operands[0].value.reg;
+			code->icc = operands[3].value.icc;
+			if (operands[1].type == OPERAND_TYPE_REGISTER) {
+				code->rs1 = operands[1].value.reg;
+				if (operands[2].type == OPERAND_TYPE_REGISTER) {
+					code->rs2 = operands[2].value.reg;
+					return THREADED_SEL_RR;
+				} else if (operands[2].type == OPERAND_TYPE_SIMM11) {
+					code->imm = operands[2].value.simm11;
+					return THREADED_SEL_RI;
+				}
+			} else if (operands[2].type == OPERAND_TYPE_SIMM8) {
+				code->imm = operands[1].value.simm8;
+				code->rs2 = (uint8_t) operands[2].value.simm8;
+				return THREADED_SEL_II;
+			}
+			return THREADED_FALLBACK;
+		case HWLOOP_INIT:
+			switch (operands[0].value.loopreg) {
+				case LOOPS_REGISTER:
+					code->imm = operands[1].value.labeladdress;
+					return THREADED_HWLOOP_S;
+				case LOOPE_REGISTER:
+					code->imm = operands[1].value.labeladdress;
+					return THREADED_HWLOOP_E;
+				case LOOPB_REGISTER:
+					if (operands[1].type == OPERAND_TYPE_REGISTER) {
+						code->rs1 = operands[1].value.reg;
+						return THREADED_HWLOOP_B_R;
+					}
+					code->imm = operands[1].value.imm22;
+					return THREADED_HWLOOP_B_I;
+				default:
+					return THREADED_FALLBACK;
+			}
+		case PREDBEGIN:
+			if (operands[0].type == OPERAND_TYPE_ICC) {
+				code->icc = operands[0].value.icc;
+				return THREADED_PREDBEGIN_ICC;
+			} else if (operands[0].type == OPERAND_TYPE_PREG) {
+				code->rs1 = operands[0].value.preg;
+				code->rs2 = operands[1].value.tf;
+				return THREADED_PREDBEGIN_PREG;
+			}
+			return THREADED_FALLBACK;
+		case PREDSET:
+			code->rd = operands[0].value.preg;
+			if (instruction->num_operands > 1 && operands[1].type == OPERAND_TYPE_ICC) {
+				code->icc = operands[1].value.icc;
+				return THREADED_PREDSET_ICC;
+			}
+			return THREADED_PREDSET;
+		case PREDCLEAR:
+			code->rd = operands[0].value.preg;
+			return THREADED_PREDCLEAR;
+		/* all instructions with three operands rd, rs1 and rs2/simm13 */
+		case AND:		handler = THREADED_AND_R;		break;
+		case ANDCC:		handler = THREADED_ANDCC_R;		break;
+		case ANDN:		handler = THREADED_ANDN_R;		break;
+		case ANDNCC:	handler = THREADED_ANDNCC_R;	break;
+		case OR:		handler = THREADED_OR_R;		break;
+		case ORCC:		handler = THREADED_ORCC_R;		break;
+		case ORN:		handler = THREADED_ORN_R;		break;
+		case ORNCC:		handler = THREADED_ORNCC_R;		break;
+		case XOR:		handler = THREADED_XOR_R;		break;
+		case XORCC:		handler = THREADED_XORCC_R;		break;
+		case XNOR:		handler = THREADED_XNOR_R;		break;
+		case XNORCC:	handler = THREADED_XNORCC_R;	break;
+		case SLL:		handler = THREADED_SLL_R;		break;
+		case SRL:		handler = THREADED_SRL_R;		break;
+		case SRA:		handler = THREADED_SRA_R;		break;
+		case ADD:		handler = THREADED_ADD_R;		break;
+		/* tagged arithmetic is the same as addcc/subcc, as there
+		   are no traps */
+		case ADDCC:
+		case TADDCC:
+		case TADDCCTV:	handler = THREADED_ADDCC_R;		break;
+		case ADDX:		handler = THREADED_ADDX_R;		break;
+		case ADDXCC:	handler = THREADED_ADDXCC_R;	break;
+		case SUB:		handler = THREADED_SUB_R;		break;
+		case SUBCC:
+		case TSUBCC:
+		case TSUBCCTV:	handler = THREADED_SUBCC_R;		break;
+		case SUBX:		handler = THREADED_SUBX_R;		break;
+		case SUBXCC:	handler = THREADED_SUBXCC_R;	break;
+		case UMUL:		handler = THREADED_UMUL_R;		break;
+		case UMULCC:	handler = THREADED_UMULCC_R;	break;
+		case SMUL:		handler = THREADED_SMUL_R;		break;
+		case SMULCC:	handler = THREADED_SMULCC_R;	break;
+		case UDIV:		handler = THREADED_UDIV_R;		break;
+		case UDIVCC:	handler = THREADED_UDIVCC_R;	break;
+		case SDIV:		handler = THREADED_SDIV_R;		break;
+		case SDIVCC:	handler = THREADED_SDIVCC_R;	break;
+		case SAVE:		handler = THREADED_SAVE_R;		break;
+		case RESTORE:	handler = THREADED_RESTORE_R;	break;
+		case JUMPL:		handler = THREADED_JUMPL_R;		break;
+		/* alternate space accesses are the same as normal accesses */
+		case LDSB:
+		case LDSBA:		handler = THREADED_LDSB_R;		break;
+		case LDSH:
+		case LDSHA:		handler = THREADED_LDSH_R;		break;
+		case LDUB:
+		case LDUBA:		handler = THREADED_LDUB_R;		break;
+		case LDUH:
+		case LDUHA:		handler = THREADED_LDUH_R;		break;
+		case LD:		handler = THREADED_LD_R;		break;
+		case STB:
+		case STBA:		handler = THREADED_STB_R;		break;
+		case STH:
+		case STHA:		handler = THREADED_STH_R;		break;
+		case ST:
+		case STA:		handler = THREADED_ST_R;		break;
+		/* all other instructions are left to the reference interpreter */
+		default:
+			return THREADED_FALLBACK;
+	}
+
+	code->rd = operands[0].value.reg;
+	code->rs1 = operands[1].value.reg;
+	return translateSource2(&operands[2], code, handler);
+}
+
+/**
+  * @brief Checks whether an instruction ends a basic block. Control 
+  *        transfer instructions end the block after their delay slot.
+  * @param[in] opcode Opcode of the instruction.
+  * @return 1 if the instruction ends a block, 0 otherwise.
+  */
+static int endsBlock(int opcode) {
+	switch (opcode) {
+		case BRANCH:
+		case CALL:
+		case JUMPL:
+		case HWLOOP_INIT:
+		case HWLOOP_START:
+		case PREDBEGIN:
+		case PREDEND:
+		case PREDSET:
+		case PREDCLEAR:
+		/* printed cycles have to be exact */
+		case CYCLE_PRINT:
+		case CYCLE_CLEAR:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+  * @brief Translates all abstract instructions into the pre-decoded
+  *        instruction stream of the threaded code engine and marks
+  *        all block leaders.
+  * @param[in,out] context The simulator context.
+  * @param[in] handlers Addresses of all handlers, indexed by
+  *                     the handler identifiers.
+  */
+static void buildThreadedCode(sim_context_t* context, void* const* handlers) {
+
+	uint32_t i;
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	sparc_operand* operands;
+
+	context->threaded_code = malloc(sizeof(threaded_instruction_t)*number_instructions);
+	context->threaded_leaders = calloc(number_instructions + 1, sizeof(uint8_t));
+	context->threaded_blocks = calloc(number_instructions, sizeof(threaded_block_t*));
+	context->threaded_steps = calloc(number_instructions, sizeof(threaded_block_t*));
+
+	if (!context->threaded_code || !context->threaded_leaders || !context->threaded_blocks || !context->threaded_steps) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for threaded code!");
+	}
+
+	for (i = 0; i < number_instructions; i++) {
+		context->threaded_code[i].handler = 
+			handlers[translateInstruction(&(context->instructions[i]), &(context->threaded_code[i]))];
+
+		/* static targets of control transfers start a new block, the 
+		   end of a hardware loop must end a block as the next pc is 
+		   redirected to the start of the loop there */
+		operands = context->instructions[i].operands;
+		switch (context->instructions[i].opcode) {
+			case BRANCH:
+			case CALL:
+				if (operands[0].value.labeladdress < number_instructions) {
+					context->threaded_leaders[operands[0].value.labeladdress] = 1;
+				}
+				break;
+			case HWLOOP_INIT:
+				if ((operands[0].value.loopreg == LOOPS_REGISTER || 
+					 operands[0].value.loopreg == LOOPE_REGISTER) &&
+					operands[1].value.labeladdress < number_instructions) {
+					context->threaded_leaders[operands[1].value.labeladdress] = 1;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/** 
+  * Instruction pairs which are executed by a single fused handler:
+  * handler of the first and the second instruction, fused handler 
+  */
+static const threaded_handler_t threaded_fusions[][3] = {
+	/* sethi %hi(x), r; or r, %lo(x), r */
+	{THREADED_SETHI, THREADED_OR_I, THREADED_SETHI_OR_I},
+	/* sll r, n, r; add r, base, r */
+	{THREADED_SLL_I, THREADED_ADD_R, THREADED_SLL_I_ADD_R},
+	/* subcc/cmp; bicc */
+	{THREADED_SUBCC_R, THREADED_BICC, THREADED_SUBCC_R_BICC},
+	{THREADED_SUBCC_I, THREADED_BICC, THREADED_SUBCC_I_BICC},
+	/* ret; restore */
+	{THREADED_JUMPL_I, THREADED_RESTORE_R, THREADED_JUMPL_I_RESTORE_R},
+	{THREADED_JUMPL_I, THREADED_RESTORE_I, THREADED_JUMPL_I_RESTORE_I}
+};
+
+/**
+  * @brief Replaces the handlers of common instruction pairs of a block
+  *        by fused handlers, which execute both instructions with a 
+  *        single dispatch. The second instruction keeps its entry, which
+  *        is skipped by the fused handler. As pairs never span blocks, 
+  *        a branch target within a pair starts a block of its own.
+  * @param[in,out] block The block.
+  * @param[in] handlers Addresses of all handlers, indexed by
+  *                     the handler identifiers.
+  */
+static void fuseInstructions(threaded_block_t* block, void* const* handlers) {
+	threaded_instruction_t* code = block->code;
+	uint32_t i;
+	uint32_t j;
+
+	for (i = 0; i + 1 < block->length; i++) {
+		for (j = 0; j < sizeof(threaded_fusions)/sizeof(threaded_fusions[0]); j++) {
+			if (code[i].handler == handlers[threaded_fusions[j][0]] &&
+				code[i + 1].handler == handlers[threaded_fusions[j][1]]) {
+				/* jmpl must not write a register read by restore */
+				if (threaded_fusions[j][0] == THREADED_JUMPL_I && code[i].rd) {
+					continue;
+				}
+				code[i].handler = handlers[threaded_fusions[j][2]];
+				i++;
+				break;
+			}
+		}
+	}
+}
+
+/**
+  * @brief Builds a block of the threaded code engine.
+  * @param[in,out] context The simulator context.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] single Whether the block contains only one instruction.
+  * @param[in] handlers Addresses of all handlers, indexed by
+  *                     the handler identifiers.
+  * @return The new block.
+  */
+static threaded_block_t* buildBlock(sim_context_t* context, uint32_t start, int single,
+		void* const* handlers) {
+
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	uint32_t end = start;
+	uint32_t i;
+	uint32_t load_use, control;
+	int opcode;
+
+	threaded_block_t* block;
+
+	/* search end of block */
+	while (!single) {
+		opcode = context->instructions[end].opcode;
+		if (opcode == BRANCH || opcode == CALL || opcode == JUMPL) {
+			/* include delay slot */
+			if (end + 1 < number_instructions) {
+				end++;
+			}
+			break;
+		}
+		if (endsBlock(opcode) || end + 1 >= number_instructions ||
+			context->threaded_leaders[end + 1]) {
+			break;
+		}
+		end++;
+	}
+
+	block = malloc(sizeof(threaded_block_t));
+	if (!block) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for threaded code!");
+	}
+
+	block->start = start;
+	block->length = end - start + 1;
+	block->cycles = 0;
+	block->instructions = 0;
+	block->load_use_stalls = 0;
+	block->control_stalls = 0;
+	block->offsets = 0;
+	block->taken = 0;
+	block->fallthrough = 0;
+	block->executions = 0;
+	block->native = 0;
+	block->code = malloc(sizeof(threaded_instruction_t)*(block->length + 1));
+
+	if (!(block->code)) {
+		free(block);
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for threaded code!");
+	}
+
+	if (context->pipeline.enabled) {
+		buildPipeline(context);
+		if (context->pipeline.store_entries) {
+			block->offsets = malloc(sizeof(uint32_t)*block->length);
+			if (!(block->offsets)) {
+				freeBlock(block);
+				context->simulator->cleanUp(context);
+				simerror("Could not allocate memory for threaded code!");
+			}
+		}
+	}
+
+	for (i = 0; i < block->length; i++) {
+		block->code[i] = context->threaded_code[start + i];
+		/* the reference interpreter counts the cycles and instructions of 
+		   fallback instructions */
+		if (block->code[i].handler != handlers[THREADED_FALLBACK]) {
+			block->cycles += instructionCycles(context, context->instructions[start + i].opcode);
+			(block->instructions)++;
+		}
+		/* the stalls within the block do not depend on the execution, 
+		   the stall on entry is charged by the core */
+		if (context->pipeline.enabled && i > 0) {
+			pipelineStalls(&(context->pipeline), start + i - 1, start + i, &load_use, &control);
+			block->load_use_stalls += load_use;
+			block->control_stalls += control;
+			block->cycles += load_use + control;
+		}
+		if (block->offsets) {
+			block->offsets[i] = block->cycles;
+		}
+	}
+	block->code[block->length].handler = handlers[THREADED_BLOCK_END];
+
+	fuseInstructions(block, handlers);
+
+	return block;
+}
+
+/**
+  * @brief Returns the cached block starting at the given address and 
+  *        builds it on the first access.
+  * @param[in,out] context The simulator context.
+  * @param[in] pc Word address of the first instruction.
+  * @param[in] npc Next program counter on block entry.
+  * @param[in] handlers Addresses of all handlers, indexed by
+  *                     the handler identifiers.
+  * @return The block.
+  */
+static threaded_block_t* lookupBlock(sim_context_t* context, uint32_t pc, uint32_t npc,
+		void* const* handlers) {
+
+	/* only a sequential entry allows to execute a whole block */
+	if (npc == pc + 1) {
+		if (!context->threaded_blocks[pc]) {
+			context->threaded_blocks[pc] = buildBlock(context, pc, 0, handlers);
+		}
+		return context->threaded_blocks[pc];
+	}
+
+	if (!context->threaded_steps[pc]) {
+		context->threaded_steps[pc] = buildBlock(context, pc, 1, handlers);
+	}
+	return context->threaded_steps[pc];
+}
+
+/**
+  * @brief Terminates the simulation for a misaligned memory access of 
+  *        a compiled block.
+  * @param[in,out] context The simulator context.
+  * @param[in] opcode Opcode of the memory access.
+  */
+static void jitMemoryError(sim_context_t* context, int opcode) {
+	context->simulator->cleanUp(context);
+	switch (opcode) {
+		case LDSH:
+			simerror("Unknown memory address for ldsh instruction!");
+			break;
+		case LDUH:
+			simerror("Unknown memory address for lduh instruction!");
+			break;
+		case LD:
+			simerror("Unknown memory address for ld instruction!");
+			break;
+		case STH:
+			simerror("Unknown destination address for sth instruction!");
+			break;
+		default:
+			simerror("Unknown destination address for st instruction!");
+			break;
+	}
+}
+
+/**
+  * @brief Sets the mode of the just-in-time compiler.
+  * @param[in,out] context The simulator context.
+  * @param[in] mode One of JIT_MODE_OFF, JIT_MODE_ON or JIT_MODE_CHECK.
+  */
+void setJITMode(sim_context_t* context, int mode) {
+	context->jit_mode = mode;
+
+	context->jit_env.context = context;
+	context->jit_env.glob_regs = context->glob_regs;
+	context->jit_env.window = &(context->window);
+	context->jit_env.psr = &(context->psr);
+	context->jit_env.lazy_icc = &(context->lazy_icc);
+	context->jit_env.y = &(context->y);
+	context->jit_env.data_memory = &(context->data_memory);
+	context->jit_env.change_cwp = changeCWP;
+	context->jit_env.evaluate_icc = evaluateICC;
+	context->jit_env.materialize_icc = materializeICC;
+	context->jit_env.memory_error = jitMemoryError;
+}
+
+/**
+  * @brief Saves registers and data memory for the differential check
+  *        of a compiled block.
+  * @param[in,out] context The simulator context.
+  * @param[out] state The saved state.
+  */
+static void saveCheckState(sim_context_t* context, jit_check_state_t* state) {
+	if (!(state->memory)) {
+		state->memory = malloc(sizeof(uint8_t)*context->data_memory_size);
+		if (!(state->memory)) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for compiled block check!");
+		}
+	}
+	memcpy(state->glob_regs, context->glob_regs, sizeof(context->glob_regs));
+	memcpy(state->window_regs, context->window_regs, sizeof(context->window_regs));
+	state->window = context->window;
+	state->psr = context->psr;
+	state->lazy_icc = context->lazy_icc;
+	state->y = context->y;
+	memcpy(state->memory, context->data_memory, context->data_memory_size);
+}
+
+/**
+  * @brief Restores registers and data memory saved by saveCheckState().
+  * @param[in,out] context The simulator context.
+  * @param[in] state The saved state.
+  */
+static void restoreCheckState(sim_context_t* context, const jit_check_state_t* state) {
+	memcpy(context->glob_regs, state->glob_regs, sizeof(context->glob_regs));
+	memcpy(context->window_regs, state->window_regs, sizeof(context->window_regs));
+	context->window = state->window;
+	context->psr = state->psr;
+	context->lazy_icc = state->lazy_icc;
+	context->y = state->y;
+	memcpy(context->data_memory, state->memory, context->data_memory_size);
+}
+
+/**
+  * @brief Compares the current state after the handlers executed the
+  *        block under check with the state after its compiled version
+  *        and terminates the simulation on any difference.
+  * @param[in,out] context The simulator context.
+  * @param[in] pc Program counter after the block.
+  * @param[in] npc Next program counter after the block.
+  */
+static void checkCompiledBlock(sim_context_t* context, uint32_t pc, uint32_t npc) {
+	if (pc == context->jit_check_pc && npc == context->jit_check_pc + 1 &&
+		!memcmp(context->glob_regs, context->jit_check_after.glob_regs, sizeof(context->glob_regs)) &&
+		!memcmp(context->window_regs, context->jit_check_after.window_regs, sizeof(context->window_regs)) &&
+		context->window == context->jit_check_after.window &&
+		psrValue(context->psr, &context->lazy_icc) == 
+			psrValue(context->jit_check_after.psr, &context->jit_check_after.lazy_icc) && 
+		context->y == context->jit_check_after.y &&
+		!memcmp(context->data_memory, context->jit_check_after.memory, context->data_memory_size)) {
+		return;
+	}
+	fprintf(stderr, "Compiled block at 0x%08x differs from interpreter "
+		"(next pc 0x%08x instead of 0x%08x).\n", context->jit_check_block->start, 
+		context->jit_check_pc, pc);
+	context->simulator->cleanUp(context);
+	simerror("Differential check of compiled block failed!");
+}
+
+/**
+  * @brief Discards the compiled versions of all blocks of a block cache
+  *        and restarts counting their executions.
+  * @param[in,out] blocks Block cache indexed by word address, may be 0.
+  * @param[in] number_instructions Number of instructions.
+  */
+static void discardCompiledBlocks(threaded_block_t** blocks, uint32_t number_instructions) {
+	uint32_t i;
+
+	for (i = 0; blocks && i < number_instructions; i++) {
+		if (blocks[i]) {
+			blocks[i]->native = 0;
+			blocks[i]->executions = 0;
+		}
+	}
+}
+
+/**
+  * @brief Compiles a hot block. If the arena of the compiled blocks is 
+  *        exhausted, all compiled blocks are discarded and the block is 
+  *        compiled into the flushed arena.
+  * @param[in,out] context The simulator context.
+  * @param[in] block The block to compile.
+  * @return The compiled block, 0 if the block can not be compiled.
+  */
+static jit_block_fct_t compileBlock(sim_context_t* context, threaded_block_t* block) {
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	jit_block_fct_t native;
+
+	native = jitCompileBlock(&context->jit_env, context->instructions, 
+		block->start, block->length);
+	if (!native && context->jit_env.arena_full) {
+		discardCompiledBlocks(context->threaded_blocks, number_instructions);
+		discardCompiledBlocks(context->functional_engine.blocks, number_instructions);
+		jitFlush(&context->jit_env);
+		native = jitCompileBlock(&context->jit_env, context->instructions, 
+			block->start, block->length);
+	}
+	return native;
+}
+
+/**
+  * @brief Sets or clears a breakpoint. run() stops before an instruction
+  *        with a breakpoint if RUN_BREAKPOINT is part of its stop mask.
+  * @param[in,out] context The simulator context.
+  * @param[in] address Byte address of the instruction.
+  * @param[in] enable Whether to set (enable != 0) or clear the breakpoint.
+  * @return 0 on success, 1 if the address is outside of the instructions.
+  */
+int setBreakpoint(sim_context_t* context, uint32_t address, int enable) {
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	uint32_t pc = address >> 2;
+
+	if ((address & 3) || pc >= number_instructions) {
+		return 1;
+	}
+
+	if (!context->run_breakpoints) {
+		context->run_breakpoints = calloc(number_instructions, sizeof(uint8_t));
+		if (!context->run_breakpoints) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for breakpoints!");
+		}
+	}
+
+	if (enable && !context->run_breakpoints[pc]) {
+		context->run_num_breakpoints++;
+	} else if (!enable && context->run_breakpoints[pc]) {
+		context->run_num_breakpoints--;
+	}
+	context->run_breakpoints[pc] = (enable != 0);
+
+	return 0;
+}
+
+/**
+  * @brief Checks whether one of the given instructions has a breakpoint.
+  * @param[in,out] context The simulator context.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] length Number of instructions.
+  * @return 1 if there is a breakpoint, 0 otherwise.
+  */
+static int hasBreakpoint(sim_context_t* context, uint32_t start, uint32_t length) {
+	uint32_t i;
+
+	for (i = 0; i < length; i++) {
+		if (context->run_breakpoints[start + i]) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* specialized cores of the threaded code engine, one per target */
+
+/* sparc v8 */
+#define CORE_NAME runCoreV8
+#define CORE_FEATURES 0
+#include "gen_sim_core.h"
+
+/* sparc v8 with hardware loops, predicated blocks on icc and movcc */
+#define CORE_NAME runCoreBlockICCMovCC
+#define CORE_FEATURES (TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_ICC | \
+	TARGET_FEATURE_MOVCC)
+#include "gen_sim_core.h"
+
+/* sparc v8 with hardware loops, predicated blocks on icc and selcc */
+#define CORE_NAME runCoreBlockICCSelCC
+#define CORE_FEATURES (TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_ICC | \
+	TARGET_FEATURE_SELCC)
+#include "gen_sim_core.h"
+
+/* sparc v8 with hardware loops, predicated blocks on pregs and selcc */
+#define CORE_NAME runCoreBlockPregSelCC
+#define CORE_FEATURES (TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_PREG | \
+	TARGET_FEATURE_SELCC)
+#include "gen_sim_core.h"
+
+/* any other combination of extensions */
+#define CORE_NAME runCoreGeneric
+#define CORE_FEATURES TARGET_FEATURES_ALL
+#include "gen_sim_core.h"
+
+/* any target with cache models or branch predictor */
+#define CORE_NAME runCoreModels
+#define CORE_FEATURES TARGET_FEATURES_ALL
+#define CORE_MODELS 1
+#include "gen_sim_core.h"
+
+/** Specialized cores and the target features they support */
+static const struct {
+	uint32_t		features;
+	run_fct_t		core;
+} run_cores[] = {
+	{0, runCoreV8},
+	{TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_ICC | TARGET_FEATURE_MOVCC, 
+		runCoreBlockICCMovCC},
+	{TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_ICC | TARGET_FEATURE_SELCC, 
+		runCoreBlockICCSelCC},
+	{TARGET_FEATURE_HWLOOP | TARGET_FEATURE_PRED_PREG | TARGET_FEATURE_SELCC, 
+		runCoreBlockPregSelCC}
+};
+
+/**
+  * @brief Returns whether a cache model, the branch predictor or the 
+  *        pipeline model is enabled, which the just-in-time compiler 
+  *        does not support.
+  * @param[in] context The simulator context.
+  * @return 1 if any model is enabled, 0 otherwise.
+  */
+int hasModels(sim_context_t* context) {
+	return context->icache.tags || context->dcache.tags || 
+		context->predictor.model != PREDICTOR_NONE || context->pipeline.enabled;
+}
+
+/**
+  * @brief Returns the core specialized for the features of the target,
+  *        which does not access any model.
+  * @param[in] context The simulator context.
+  * @return The core.
+  */
+static run_fct_t targetCore(sim_context_t* context) {
+
+	uint32_t features = context->simulator->getTargetFeatures(context);
+	run_fct_t core = runCoreGeneric;
+	uint32_t i;
+
+	for (i = 0; i < sizeof(run_cores)/sizeof(run_cores[0]); i++) {
+		if (run_cores[i].features == features) {
+			core = run_cores[i].core;
+		}
+	}
+	return core;
+}
+
+/**
+  * @brief Simulates the program until the main function returns or one 
+  *        of the requested events occurs. The abstract instructions are 
+  *        pre-decoded into a stream of handler addresses, and every 
+  *        handler directly jumps to the handler of the next instruction 
+  *        (direct threading). The stream is split into cached basic 
+  *        blocks, which charge their cycles once and are chained to their
+  *        successors. Instructions without a specialized handler, and 
+  *        blocks which would cross a stop, are executed by simulateStep().
+  *        Each target runs on a core which only handles the instruction
+  *        set extensions enabled by the target, or on a core with cache
+  *        models, branch predictor and pipeline model.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream The output file stream where to write additional
+  *                      information, 0 for no output.
+  * @param[in] max_steps Maximum number of instructions to execute, 0 for 
+  *                      no limit.
+  * @param[in] stop_mask Further events to stop at (RUN_CYCLE_PRINT, 
+  *                      RUN_CYCLE_CLEAR, RUN_BREAKPOINT). A breakpoint at
+  *                      the current instruction is ignored, so that a 
+  *                      stopped simulation can be continued.
+  * @return The reason for stopping (RUN_EXIT, RUN_STEPS, RUN_CYCLE_PRINT,
+  *         RUN_CYCLE_CLEAR or RUN_BREAKPOINT).
+  */
+int run(sim_context_t* context, FILE* outstream, uint32_t max_steps, uint32_t stop_mask) {
+	int reason;
+
+	/* the threaded code contains the handler addresses of the core 
+	   selected at the first run */
+	if (!context->run_core) {
+		context->run_core = hasModels(context) ? runCoreModels : targetCore(context);
+	}
+
+	/* compiled blocks neither access the cache models nor predict branches
+	   nor model the pipeline */
+	if (context->run_core == runCoreModels && context->jit_mode != JIT_MODE_OFF) {
+		context->simulator->cleanUp(context);
+		simerror("The just-in-time compiler does not support cache, predictor and pipeline models!");
+	}
+
+	/* memory faults of this thread belong to this context */
+	if (sigsetjmp(context->fault_jump, 0)) {
+		reportMemoryFault(context);
+	}
+	fault_context = context;
+	reason = context->run_core(context, outstream, max_steps, stop_mask);
+	fault_context = 0;
+
+	return reason;
+}
+
+/**
+  * @brief Sets the array in which run() counts the executed instructions
+  *        of each block, e.g. to collect basic block vectors.
+  * @param[in,out] context The simulator context.
+  * @param[in] counts Array with one counter per instruction, indexed by
+  *                   the word address of the first instruction of a 
+  *                   block, or 0 to stop counting. The counters are only
+  *                   incremented, the array is owned by the caller.
+  */
+void setBlockCounts(sim_context_t* context, uint32_t* counts) {
+	context->block_counts = counts;
+}
+
+/**
+  * @brief Executes the program like run(), but purely functional: no
+  *        cycles are accounted, the cache, predictor and pipeline models
+  *        are neither accessed nor updated, and nothing is printed. With
+  *        models, the program is executed by the core of the target 
+  *        without models on its own threaded code. The local cycle
+  *        counter starts from zero afterwards.
+  * @param[in,out] context The simulator context.
+  * @param[in] max_steps Maximum number of instructions to execute, 0 for 
+  *                      no limit.
+  * @param[in] stop_mask Further events to stop at, see run().
+  * @return The reason for stopping, see run().
+  */
+int fastForward(sim_context_t* context, uint32_t max_steps, uint32_t stop_mask) {
+
+	uint64_t cycle_counter = context->cycle_counter;
+	uint64_t fetch_cycles = context->fetch_cycles;
+	int models = hasModels(context);
+	int reason;
+
+	/* the discarded cycles are not attributed to any block or function */
+	if (context->profile_entries) {
+		flushProfile(context);
+	}
+	if (context->calls.nodes) {
+		callsCharge(&(context->calls), context->cycle_counter, context->instruction_counter, 1);
+	}
+
+	/* the engines charge whole blocks at once, discarding their 
+	   cycles is cheaper than checking the mode in each block */
+	if (models) {
+		if (!context->functional_engine.core) {
+			context->functional_engine.core = targetCore(context);
+		}
+		swapEngine(context);
+	}
+	context->functional = 1;
+	reason = run(context, 0, max_steps, stop_mask);
+	context->functional = 0;
+	if (models) {
+		swapEngine(context);
+	}
+
+	context->cycle_counter = cycle_counter;
+	context->cycle_counter_local = 0;
+	context->fetch_cycles = fetch_cycles;
+	context->profile_start = cycle_counter;
+	context->calls.start_cycles = cycle_counter;
+	context->calls.start_instructions = context->instruction_counter;
+	pipelineDrain(&(context->pipeline));
+
+	return reason;
+}
+
+/**
+  * @brief Prints the accesses and misses of a cache model.
+  * @param[in] outstream File stream where to print the information.
+  * @param[in] name Name of the cache.
+  * @param[in] stats Statistics of the cache.
+  */
+static void printCacheStats(FILE* outstream, const char* name, const sim_cache_stats_t* stats) {
+	fprintf(outstream, "%s: %llu accesses, %llu misses (%.2f%%).\n", name,
+		(unsigned long long) stats->accesses, (unsigned long long) stats->misses,
+		stats->accesses ? 100.0*stats->misses/stats->accesses : 0.0);
+}
+
+/**
+  * @brief Prints the return value of the main function and the
+  *        number of simulated cycles to the given file stream, and the
+  *        statistics of the enabled cache models, branch predictor and 
+  *        pipeline model.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to print the information.
+  */
+void printResults(sim_context_t* context, FILE* outstream) {
+	fprintf(outstream, "Executed instructions: %llu.\n", 
+		(unsigned long long) context->instruction_counter);
+	if (context->icache.tags) {
+		printCacheStats(outstream, "Instruction cache", &(context->icache.stats));
+	}
+	if (context->dcache.tags) {
+		printCacheStats(outstream, "Data cache", &(context->dcache.stats));
+	}
+	if (context->predictor.model != PREDICTOR_NONE) {
+		fprintf(outstream, "Conditional branches: %llu, %llu taken, %llu mispredicted (%.2f%%).\n",
+			(unsigned long long) context->predictor.stats.branches,
+			(unsigned long long) context->predictor.stats.taken,
+			(unsigned long long) context->predictor.stats.mispredictions,
+			context->predictor.stats.branches ? 
+				100.0*context->predictor.stats.mispredictions/context->predictor.stats.branches : 0.0);
+	}
+	if (context->pipeline.enabled) {
+		fprintf(outstream, "Pipeline stalls: %llu load-use, %llu control, %llu store buffer cycles.\n",
+			(unsigned long long) context->pipeline.stats.load_use,
+			(unsigned long long) context->pipeline.stats.control,
+			(unsigned long long) context->pipeline.stats.store);
+	}
+	fprintf(outstream, "Main function returned value 0x%08x.\n", 
+		SPARC_REGISTER(RET_VAL_REGISTER));
+	fprintf(outstream, "Simulated cycles: %llu.\n", 
+		(unsigned long long) context->cycle_counter);
+}
+
+/**
+  * @brief Returns a percentile of the cycles of a region from its
+  *        cycle histogram, accurate to 1/CYCLE_HISTOGRAM_SUB.
+  * @param[in] region The region.
+  * @param[in] histogram The cycle histogram of the region.
+  * @param[in] percent The percentile, 1 to 100.
+  * @return The cycles which are not exceeded by the given percentage
+  *         of the executions of the region.
+  */
+static uint64_t histogramPercentile(const sim_region_t* region, const uint64_t* histogram,
+	uint32_t percent) {
+
+	uint64_t rank = (region->count*percent + 99)/100;
+	uint64_t counted = 0;
+	uint64_t cycles = region->max_cycles;
+	uint32_t i;
+
+	for (i = 0; i < CYCLE_HISTOGRAM_SIZE; i++) {
+		counted += histogram[i];
+		if (counted >= rank) {
+			cycles = histogramCycles(i);
+			break;
+		}
+	}
+
+	return (cycles < region->min_cycles) ? region->min_cycles : cycles;
+}
+
+/**
+  * @brief Prints the statistics of one line of the region table.
+  * @param[in] outstream File stream where to print the information.
+  * @param[in] region The region.
+  * @param[in] histogram The cycle histogram of the region, 0 if there 
+  *                      are no percentiles.
+  */
+static void printRegion(FILE* outstream, const sim_region_t* region, const uint64_t* histogram) {
+	fprintf(outstream, " %12llu %14llu %14.1f", (unsigned long long) region->count, 
+		(unsigned long long) region->min_cycles, (double) region->sum_cycles/region->count);
+	if (histogram) {
+		fprintf(outstream, " %14llu %14llu %14llu", 
+			(unsigned long long) histogramPercentile(region, histogram, 50),
+			(unsigned long long) histogramPercentile(region, histogram, 90),
+			(unsigned long long) histogramPercentile(region, histogram, 99));
+	}
+	fprintf(outstream, " %14llu %18llu %18llu\n", (unsigned long long) region->max_cycles, 
+		(unsigned long long) region->sum_cycles, (unsigned long long) region->sum_instructions);
+}
+
+/**
+  * @brief Prints the start and end address of a region.
+  * @param[in] outstream File stream where to print the information.
+  * @param[in] region The region.
+  */
+static void printRegionAddresses(FILE* outstream, const sim_region_t* region) {
+	if (region->start == REGION_START_PROGRAM) {
+		fprintf(outstream, "%-10s ", "start");
+	} else {
+		fprintf(outstream, "0x%08x ", region->start << 2);
+	}
+	fprintf(outstream, "0x%08x", region->end << 2);
+}
+
+/**
+  * @brief Prints the accesses and misses of a cache model in a region.
+  * @param[in] outstream File stream where to print the information.
+  * @param[in] stats Statistics of the cache in the region.
+  */
+static void printRegionCache(FILE* outstream, const sim_cache_stats_t* stats) {
+	fprintf(outstream, " %18llu %18llu %8.2f", (unsigned long long) stats->accesses, 
+		(unsigned long long) stats->misses, 
+		stats->accesses ? 100.0*stats->misses/stats->accesses : 0.0);
+}
+
+/**
+  * @brief Prints the accumulated executions of all regions closed by 
+  *        cycle print instructions to the given file stream. If cycle
+  *        statistics are collected, the table contains percentiles and 
+  *        a first line for all regions together. If cache models are 
+  *        enabled, a second table contains their accesses and misses.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to print the information.
+  */
+void printRegions(sim_context_t* context, FILE* outstream) {
+
+	sim_region_t* region;
+	sim_region_t all = { REGION_START_PROGRAM, 0, 0, UINT64_MAX, 0, 0, 0, { 0, 0 }, { 0, 0 } };
+	uint64_t* histograms = context->region_histograms;
+	uint64_t all_histogram[CYCLE_HISTOGRAM_SIZE];
+	uint32_t i, j;
+
+	fprintf(outstream, "Regions (%u):\n", context->num_regions);
+	fprintf(outstream, "%-10s %-10s %12s %14s %14s", "start", "end", "count", "min cycles", 
+		"mean cycles");
+	if (histograms) {
+		fprintf(outstream, " %14s %14s %14s", "p50 cycles", "p90 cycles", "p99 cycles");
+	}
+	fprintf(outstream, " %14s %18s %18s\n", "max cycles", "sum cycles", "sum instructions");
+
+	/* all regions together */
+	if (histograms && context->num_regions) {
+		memset(all_histogram, 0, sizeof(all_histogram));
+		for (i = 0; i < context->num_regions; i++) {
+			region = &(context->regions[i]);
+			all.count += region->count;
+			if (region->min_cycles < all.min_cycles) {
+				all.min_cycles = region->min_cycles;
+			}
+			if (region->max_cycles > all.max_cycles) {
+				all.max_cycles = region->max_cycles;
+			}
+			all.sum_cycles += region->sum_cycles;
+			all.sum_instructions += region->sum_instructions;
+			for (j = 0; j < CYCLE_HISTOGRAM_SIZE; j++) {
+				all_histogram[j] += histograms[i*CYCLE_HISTOGRAM_SIZE + j];
+			}
+		}
+		fprintf(outstream, "%-10s %-10s", "all", "-");
+		printRegion(outstream, &all, all_histogram);
+	}
+
+	for (i = 0; i < context->num_regions; i++) {
+		region = &(context->regions[i]);
+		printRegionAddresses(outstream, region);
+		printRegion(outstream, region, histograms ? &(histograms[i*CYCLE_HISTOGRAM_SIZE]) : 0);
+	}
+
+	if (!context->icache.tags && !context->dcache.tags) {
+		return;
+	}
+
+	fprintf(outstream, "Region caches (%u):\n", context->num_regions);
+	fprintf(outstream, "%-10s %-10s", "start", "end");
+	if (context->icache.tags) {
+		fprintf(outstream, " %18s %18s %8s", "icache accesses", "icache misses", "miss %");
+	}
+	if (context->dcache.tags) {
+		fprintf(outstream, " %18s %18s %8s", "dcache accesses", "dcache misses", "miss %");
+	}
+	fprintf(outstream, "\n");
+	for (i = 0; i < context->num_regions; i++) {
+		region = &(context->regions[i]);
+		printRegionAddresses(outstream, region);
+		if (context->icache.tags) {
+			printRegionCache(outstream, &(region->icache));
+		}
+		if (context->dcache.tags) {
+			printRegionCache(outstream, &(region->dcache));
+		}
+		fprintf(outstream, "\n");
+	}
+}
+
+/**
+  * @brief Prints the statistics of each executed conditional branch to 
+  *        the given file stream, ordered by address. Branches are only 
+  *        counted if a branch predictor is enabled.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to print the information.
+  */
+void printBranches(sim_context_t* context, FILE* outstream) {
+
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	uint32_t count = 0;
+	uint32_t i;
+	sim_branch_stats_t* stats;
+
+	for (i = 0; context->branch_stats && i < number_instructions; i++) {
+		count += (context->branch_stats[i].branches != 0);
+	}
+
+	fprintf(outstream, "Branches (%u):\n", count);
+	fprintf(outstream, "%-10s %18s %18s %8s %18s %8s\n", "address", "executions", "taken", 
+		"taken %", "mispredictions", "miss %");
+	for (i = 0; count && i < number_instructions; i++) {
+		stats = &(context->branch_stats[i]);
+		if (stats->branches) {
+			fprintf(outstream, "0x%08x %18llu %18llu %8.2f %18llu %8.2f\n", i << 2, 
+				(unsigned long long) stats->branches, (unsigned long long) stats->taken, 
+				100.0*stats->taken/stats->branches, (unsigned long long) stats->mispredictions, 
+				100.0*stats->mispredictions/stats->branches);
+		}
+	}
+}
+
+/**
+  * @brief Enables or disables the cycle histograms of the regions, from
+  *        which printRegions() prints percentiles. They should be enabled
+  *        before the simulation.
+  * @param[in,out] context The simulator context.
+  * @param[in] enable 1 to collect the cycle histograms, 0 otherwise.
+  */
+void setCycleStatistics(sim_context_t* context, int enable) {
+
+	if (!enable) {
+		free(context->region_histograms);
+		context->region_histograms = 0;
+	} else if (!context->region_histograms) {
+		/* at least one bucket, so that the histograms are enabled */
+		context->region_histograms = calloc((context->max_regions ? context->max_regions : 1)*
+			CYCLE_HISTOGRAM_SIZE, sizeof(uint64_t));
+		if (!context->region_histograms) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for cycle histograms!");
+		}
+	}
+}
+
+/**
+  * @brief Enables or disables the profile of execution counts and cycles
+  *        per instruction, which printProfile() prints. It should be 
+  *        enabled before the simulation. The threaded code engine counts
+  *        whole blocks and attributes the cycles of a block to its first
+  *        instruction.
+  * @param[in,out] context The simulator context.
+  * @param[in] enable 1 to collect the profile, 0 otherwise.
+  */
+void setProfiling(sim_context_t* context, int enable) {
+
+	uint32_t size = context->simulator->getNumberOfInstructions(context) + 1;
+
+	if (!enable) {
+		free(context->profile_entries);
+		context->profile_entries = 0;
+	} else if (!context->profile_entries) {
+		context->profile_entries = calloc(3*size, sizeof(uint64_t));
+		if (!context->profile_entries) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for profile!");
+		}
+		context->profile_exits = context->profile_entries + size;
+		context->profile_cycles = context->profile_exits + size;
+		context->profile_pc = PROFILE_NONE;
+		context->profile_start = context->cycle_counter;
+	}
+}
+
+/**
+  * @brief Enables or disables the shadow call stack, from which 
+  *        printFunctions() and writeCallStacks() print the cycles and 
+  *        instructions of each function. It should be enabled before the
+  *        simulation, main is the first function on the stack.
+  * @param[in,out] context The simulator context.
+  * @param[in] enable 1 to trace the calls, 0 otherwise.
+  */
+void setCallTracing(sim_context_t* context, int enable) {
+
+	char** names = context->calls.names;
+	uint32_t num_names = context->calls.num_names;
+
+	if (!enable) {
+		/* the names of a function map are kept */
+		context->calls.names = 0;
+		callsFree(&(context->calls));
+		context->calls.names = names;
+		context->calls.num_names = num_names;
+	} else if (!context->calls.nodes) {
+		if (callsReset(&(context->calls), context->pc)) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for call stack!");
+		}
+		context->calls.start_cycles = context->cycle_counter;
+		context->calls.start_instructions = context->instruction_counter;
+	}
+}
+
+/**
+  * @brief Reads the names of functions from a map file, each line 
+  *        contains the byte address of the first instruction of a 
+  *        function and its name, e.g. "0x00000040 sort".
+  *        Empty lines and lines starting with '#' are ignored.
+  *        Functions without name are printed with their address.
+  * @param[in,out] context The simulator context.
+  * @param[in] instream File stream of the function map.
+  */
+void readFunctionMap(sim_context_t* context, FILE* instream) {
+
+	char line[256];
+	char name[128];
+	char message[128];
+	unsigned long address;
+	char rest;
+	uint32_t line_number = 0;
+	int fields, result;
+
+	while (fgets(line, sizeof(line), instream)) {
+		line_number++;
+		fields = sscanf(line, " %lx %127s %c", &address, name, &rest);
+		if (fields == EOF || line[strspn(line, " \t")] == '#') {
+			continue;
+		}
+		result = 1;
+		if (fields == 2 && !(address & 3) && address <= UINT32_MAX) {
+			result = callsSetName(&(context->calls), 
+				context->simulator->getNumberOfInstructions(context), 
+				(uint32_t) (address >> 2), name);
+		}
+		if (result == 2) {
+			context->simulator->cleanUp(context);
+			simerror("Could not allocate memory for function names!");
+		}
+		if (result) {
+			snprintf(message, sizeof(message), "Invalid function map in line %u!", line_number);
+			context->simulator->cleanUp(context);
+			simerror(message);
+		}
+	}
+}
+
+/**
+  * @brief Prints the calls and the inclusive and exclusive cycles and 
+  *        instructions of each function, if the calls are traced (see 
+  *        setCallTracing()).
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to print the information.
+  */
+void printFunctions(sim_context_t* context, FILE* outstream) {
+	if (!context->calls.nodes) {
+		return;
+	}
+	callsCharge(&(context->calls), context->cycle_counter, context->instruction_counter, 1);
+	if (callsPrintFunctions(&(context->calls), 
+		context->simulator->getNumberOfInstructions(context), outstream)) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for function statistics!");
+	}
+}
+
+/**
+  * @brief Writes the cycles of each path of calls as folded stacks, which
+  *        flame graph tools read, if the calls are traced (see 
+  *        setCallTracing()).
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to write the stacks.
+  */
+void writeCallStacks(sim_context_t* context, FILE* outstream) {
+
+	int result;
+
+	if (!context->calls.nodes) {
+		return;
+	}
+	callsCharge(&(context->calls), context->cycle_counter, context->instruction_counter, 1);
+	result = callsWriteFolded(&(context->calls), outstream);
+	if (result == 2) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for call stacks!");
+	}
+	if (result) {
+		context->simulator->cleanUp(context);
+		simerror("Could not write call stacks!");
+	}
+}
+
+/**
+  * @brief Returns the results of the simulation so far.
+  * @param[in,out] context The simulator context.
+  * @param[out] results The results of the simulation.
+  */
+void getResults(sim_context_t* context, sim_results_t* results) {
+	results->return_value = SPARC_REGISTER(RET_VAL_REGISTER);
+	results->cycles = context->cycle_counter;
+	results->instructions = context->instruction_counter;
+	results->region_cycles = context->cycle_counter_region;
+	results->regions = context->cycle_regions;
+	results->icache = context->icache.stats;
+	results->dcache = context->dcache.stats;
+	results->branches = context->predictor.stats;
+	results->pipeline = context->pipeline.stats;
+}
 
 /**
   * @brief Prints the register contents of the current window,
   *        the ICC flags of the psr, the contents of the preg and
   *        the y-register to the given file stream.
+  * @param[in,out] context The simulator context.
   * @param[in] outstream File stream where to print the information.
   */
-void printRegisters(FILE* outstream) {
+void printRegisters(sim_context_t* context, FILE* outstream) {
 
 	uint32_t i;
 
-	/* register names */
-	const char* reg_names = "goli";
+	/* register names */
+	const char* reg_names = "goli";
+
+	materializeICC(context);
+
+	fprintf(outstream, "Register contents of current window:\n");
+	for(i = 0; i < 32; i++) {
+		fprintf(outstream, "%%%c%d:\t0x%08x\n", reg_names[(i/8)], 
+			(i%8), SPARC_REGISTER(i));
+	}
+	fprintf(outstream, "%%y:\t\t0x%08x\n", context->y);
+	fprintf(outstream, "PSR:\tN=%d, Z=%d, V=%d, C=%d\n", 
+		PSR_GET_N(context->psr), PSR_GET_Z(context->psr), 
+		PSR_GET_V(context->psr), PSR_GET_C(context->psr));
+	fprintf(outstream, "\n");
+	fprintf(outstream, "preg:\t0x%08x\n", context->preg);
+
+}
+
+/**
+  * @brief Prints the disassembly of one instruction, without its address
+  *        and newline.
+  * @param[in,out] context The simulator context.
+  * @param[in] i Word address of the instruction.
+  * @param[in] outstream File stream where to print the information.
+  */
+static void printInstruction(sim_context_t* context, uint32_t i, FILE* outstream) {
+
+	uint32_t operand_iter;
+	uint32_t num_operands, operands_end;
+	int opcode;
+
+	int reg;
+	int immediate;
+	int icc;
+	uint32_t address;
+
+	/* register names */
+	const char* reg_names = "goli";
+
+	/* branch codes in plain text */
+	static const char* branch_codes[16] = {
+		"n", "e", "le", "l", "leu", "cs",
+		"neg", "vs", "a", "ne", "g", "ge",
+		"gu", "cc", "pos", "vc" 
+	};
+
+	opcode = context->instructions[i].opcode;
+	num_operands = context->instructions[i].num_operands;
+	operands_end = num_operands;
+	operand_iter = 0;
+
+	switch(opcode) {
+		case CYCLE_PRINT:
+			/* only meta instruction for simulator */
+			fprintf(outstream, "sim-printcycles");
+			break;
+		case CYCLE_CLEAR:
+			/* only meta instruction for simulator */
+			fprintf(outstream, "sim-clearcycles");
+			break;
+		case CALL:
+			address = context->instructions[i].operands[0].value.labeladdress;
+			fprintf(outstream, "call 0x%08x", address);
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case SETHI:
+			fprintf(outstream, "sethi");
+			break;
+		case NOP:
+			fprintf(outstream, "nop");
+			break;
+		case BRANCH:
+			address = context->instructions[i].operands[0].value.labeladdress;
+			icc = context->instructions[i].operands[1].value.icc;
+			fprintf(outstream, "b%s", branch_codes[icc]);
+			fprintf(outstream, " 0x%08x", address);
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case LDSB:
+			fprintf(outstream, "ldsb");
+			break;
+		case LDSH:
+			fprintf(outstream, "ldsh");
+			break;
+		case LDUB:
+			fprintf(outstream, "ldub");
+			break;
+		case LDUH:
+			fprintf(outstream, "lduh");
+			break;
+		case LD:
+			fprintf(outstream, "ld");
+			break;
+		case LDD:
+			fprintf(outstream, "ldd");
+			break;
+		case LDSBA:
+			fprintf(outstream, "ldsba");
+			break;
+		case LDSHA:
+			fprintf(outstream, "ldsha");
+			break;
+		case LDUBA:
+			fprintf(outstream, "lduba");
+			break;
+		case LDUHA:
+			fprintf(outstream, "lduha");
+			break;
+		case LDA:
+			fprintf(outstream, "lda");
+			break;
+		case LDDA:
+			fprintf(outstream, "ldda");
+			break;
+		case STB:
+			fprintf(outstream, "stb");
+			break;
+		case STH:
+			fprintf(outstream, "sth");
+			break;
+		case ST:
+			fprintf(outstream, "st");
+			break;
+		case STD:
+			fprintf(outstream, "std");
+			break;
+		case STBA:
+			fprintf(outstream, "stba");
+			break;
+		case STHA:
+			fprintf(outstream, "stha");
+			break;
+		case STA:
+			fprintf(outstream, "sta");
+			break;
+		case STDA:
+			fprintf(outstream, "stda");
+			break;
+		case LDSTUB:
+			fprintf(outstream, "ldstub");
+			break;
+		case LDSTUBA:
+			fprintf(outstream, "ldstuba");
+			break;
+		case SWAP:
+			fprintf(outstream, "swap");
+			break;
+		case SWAPA:
+			fprintf(outstream, "swapa");
+			break;
+		case AND:
+			fprintf(outstream, "and");
+			break;
+		case ANDCC:
+			fprintf(outstream, "andcc");
+			break;
+		case ANDN:
+			fprintf(outstream, "andn");
+			break;
+		case ANDNCC:
+			fprintf(outstream, "andncc");
+			break;
+		case OR:
+			fprintf(outstream, "or");
+			break;
+		case ORCC:
+			fprintf(outstream, "orcc");
+			break;
+		case ORN:
+			fprintf(outstream, "orn");
+			break;
+		case ORNCC:
+			fprintf(outstream, "orncc");
+			break;
+		case XOR:
+			fprintf(outstream, "xor");
+			break;
+		case XORCC:
+			fprintf(outstream, "xorcc");
+			break;
+		case XNOR:
+			fprintf(outstream, "xnor");
+			break;
+		case XNORCC:
+			fprintf(outstream, "xnorcc");
+			break;
+		case SLL:
+			fprintf(outstream, "sll");
+			break;
+		case SRL:
+			fprintf(outstream, "srl");
+			break;
+		case SRA:
+			fprintf(outstream, "sra");
+			break;
+		case ADD:
+			fprintf(outstream, "add");
+			break;
+		case ADDCC:
+			fprintf(outstream, "addcc");
+			break;
+		case ADDX:
+			fprintf(outstream, "addx");
+			break;
+		case ADDXCC:
+			fprintf(outstream, "addxcc");
+			break;
+		case TADDCC:
+			fprintf(outstream, "taddcc");
+			break;
+		case TADDCCTV:
+			fprintf(outstream, "taddcctv");
+			break;
+		case SUB:
+			fprintf(outstream, "sub");
+			break;
+		case SUBCC:
+			fprintf(outstream, "subcc");
+			break;
+		case SUBX:
+			fprintf(outstream, "subx");
+			break;
+		case SUBXCC:
+			fprintf(outstream, "subxcc");
+			break;
+		case TSUBCC:
+			fprintf(outstream, "tsubcc");
+			break;
+		case TSUBCCTV:
+			fprintf(outstream, "tsubcctv");
+			break;
+		case MULSCC:
+			fprintf(outstream, "mulscc");
+			break;
+		case UMUL:
+			fprintf(outstream, "umul");
+			break;
+		case SMUL:
+			fprintf(outstream, "smul");
+			break;
+		case UMULCC:
+			fprintf(outstream, "umulcc");
+			break;
+		case SMULCC:
+			fprintf(outstream, "smulcc");
+			break;
+		case UDIV:
+			fprintf(outstream, "udiv");
+			break;
+		case SDIV:
+			fprintf(outstream, "sdiv");
+			break;
+		case UDIVCC:
+			fprintf(outstream, "udivcc");
+			break;
+		case SDIVCC:
+			fprintf(outstream, "sdivcc");
+			break;
+		case SAVE:
+			fprintf(outstream, "save");
+			break;
+		case RESTORE:
+			fprintf(outstream, "restore");
+			break;
+		case JUMPL:
+			fprintf(outstream, "jumpl");
+			break;
+		case RD:
+			fprintf(outstream, "rd");
+			/* handle predicated rd instruction */
+			if (num_operands == 3) {
+				icc = context->instructions[i].operands[2].value.icc;
+				fprintf(outstream, "[%s]", branch_codes[icc]);
+			} else if (num_operands == 4) {
+				reg = context->instructions[i].operands[2].value.preg;
+				fprintf(outstream, "[%%p%d]", reg);
+				if (context->instructions[i].operands[3].value.tf) {
+					fprintf(outstream, "[t]");
+				} else {
+					fprintf(outstream, "[f]");
+				}
+			}
+			reg = context->instructions[i].operands[1].value.reg;
+			if (reg != Y_REGISTER_NO) {
+				cleanUp(context);
+				simerror("Unknown source register for read instruction!");
+			}
+			fprintf(outstream, " %%y,");
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case WR:
+			fprintf(outstream, "wr");
+			break;
+		case MOV:
+			icc = context->instructions[i].operands[2].value.icc;
+			fprintf(outstream, "mov[%s]", branch_codes[icc]);
+			/* last operand has already been printed */
+			operands_end = 2;
+			break;
+		case SEL:
+			icc = context->instructions[i].operands[3].value.icc;
+			fprintf(outstream, "sel[%s]", branch_codes[icc]);
+			/* select needs special treatment for src operands */
+			if (context->instructions[i].operands[1].type == OPERAND_TYPE_REGISTER) {
+				reg = context->instructions[i].operands[1].value.reg;
+				fprintf(outstream, " %%%c%d,", reg_names[(reg/8)], (reg%8));
+				if (context->instructions[i].operands[2].type == OPERAND_TYPE_REGISTER) {
+					reg = context->instructions[i].operands[2].value.reg;
+					fprintf(outstream, " %%%c%d,", reg_names[(reg/8)], (reg%8));
+				} else if (context->instructions[i].operands[2].type == OPERAND_TYPE_SIMM11) {
+					immediate = context->instructions[i].operands[2].value.simm11;
+					fprintf(outstream, " %d,", immediate);
+				} else {
+					cleanUp(context);
+					simerror("Unknown type for source2 of selcc instruction!");
+				}
+
+			} else if (context->instructions[i].operands[1].type == OPERAND_TYPE_SIMM8) {
+				immediate = context->instructions[i].operands[1].value.simm8;
+				fprintf(outstream, " %d,", immediate);
+				/* second operand has to be simm8 then... */
+				immediate = context->instructions[i].operands[2].value.simm8;
+				fprintf(outstream, " %d,", immediate);
+			} else {
+				cleanUp(context);
+				simerror("Unknown type for source1 of selcc instruction!");
+			}
 
-	fprintf(outstream, "Register contents of current window:\n");
-	for(i = 0; i < 32; i++) {
-		fprintf(outstream, "%%%c%d:\t0x%08x\n", reg_names[(i/8)], 
-			(i%8), *(sparc_window_registers[i]));
+			/* all operands have already been printed */
+			operands_end = 0;
+			break;
+		case HWLOOP_INIT:
+			fprintf(outstream, "hwloop init ");
+			address = context->instructions[i].operands[1].value.labeladdress;
+			reg = context->instructions[i].operands[0].value.loopreg;
+			if (reg == LOOPS_REGISTER) {
+				fprintf(outstream, "0x%08x, %%loops", address);
+			} else if (reg == LOOPE_REGISTER) {
+				fprintf(outstream, "0x%08x, %%loope", address);
+			} else if (reg == LOOPB_REGISTER) {
+				if (context->instructions[i].operands[1].type == OPERAND_TYPE_REGISTER) {
+					reg = context->instructions[i].operands[1].value.reg;
+					fprintf(outstream, "%%%c%d, ", reg_names[reg/8], (reg%8));
+				} else {
+					immediate = context->instructions[i].operands[1].value.imm22;
+					fprintf(outstream, "%d, ", immediate);
+				}
+				fprintf(outstream, "%%loopb");
+			}
+			operands_end = 0;
+			break;
+		case HWLOOP_START:
+			fprintf(outstream, "hwloop start");
+			operands_end = 0;
+			break;
+		case PREDBEGIN:
+			fprintf(outstream, "predbegin");
+			if (context->instructions[i].operands[0].type == OPERAND_TYPE_ICC) {
+				icc = context->instructions[i].operands[0].value.icc;
+				fprintf(outstream, "[%s]", branch_codes[icc]);
+			} else {
+				reg = context->instructions[i].operands[0].value.preg;
+				fprintf(outstream, "[%%p%d]", reg);
+				if (context->instructions[i].operands[1].value.tf) {
+					fprintf(outstream, "[t]");
+				} else {
+					fprintf(outstream, "[f]");
+				}
+			}
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case PREDEND:
+			fprintf(outstream, "predend");
+			break;
+		case PREDSET:
+			fprintf(outstream, "predset");
+			/* handle predicated versions of predset */
+			if (num_operands > 1) {
+				if (context->instructions[i].operands[1].type == OPERAND_TYPE_ICC) {
+					icc = context->instructions[i].operands[1].value.icc;
+				} else {
+					reg = context->instructions[i].operands[1].value.reg;
+					fprintf(outstream, "[%%p%d]", reg);
+					if (context->instructions[i].operands[2].value.tf) {
+						fprintf(outstream, "[t]");
+					} else {
+						fprintf(outstream, "[f]");
+					}
+					icc = context->instructions[i].operands[3].value.icc;
+				}
+				fprintf(outstream, "[%s]", branch_codes[icc]);
+			}
+			if (context->instructions[i].operands[0].type != OPERAND_TYPE_PREG) {
+				cleanUp(context);
+				simerror("Unknown register type for predclear instruction!");
+			}
+			reg = context->instructions[i].operands[0].value.preg;
+			fprintf(outstream, " %%p%d", reg);
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case PREDCLEAR:
+			if (context->instructions[i].operands[0].type != OPERAND_TYPE_PREG) {
+				cleanUp(context);
+				simerror("Unknown register type for predclear instruction!");
+			}
+			reg = context->instructions[i].operands[0].value.preg;
+			fprintf(outstream, "predclear %%p%d", reg);
+			/* there are no unhandled operands */
+			operands_end = 0;
+			break;
+		case UNKNOWN: 
+		default:
+			cleanUp(context);
+			simerror("Not supported opcode encoutered!");
+			break;
+	}
+	/* fully predicated instructions */
+	if (operands_end == 5) {
+		reg = context->instructions[i].operands[3].value.preg;
+		fprintf(outstream, "[%%p%d]", reg);
+		if (context->instructions[i].operands[4].value.tf) {
+			fprintf(outstream, "[t]");
+		} else {
+			fprintf(outstream, "[f]");
+		}
+		operands_end = 3;
+	} else if (operands_end == 4) {
+	/* predicated instructions on codition code */
+		icc = context->instructions[i].operands[3].value.icc;
+		fprintf(outstream, "[%s]", branch_codes[icc]);
+		operands_end = 3;
 	}
-	fprintf(outstream, "%%y:\t\t0x%08x\n", sparc_y);
-	fprintf(outstream, "PSR:\tN=%d, Z=%d, V=%d, C=%d\n", 
-		PSR_GET_N(sparc_psr), PSR_GET_Z(sparc_psr), 
-		PSR_GET_V(sparc_psr), PSR_GET_C(sparc_psr));
-	fprintf(outstream, "\n");
-	fprintf(outstream, "preg:\t0x%08x\n", sparc_preg);
 
+	for (operand_iter = 1; operand_iter < operands_end; operand_iter++) {
+		if (context->instructions[i].operands[operand_iter].type == OPERAND_TYPE_REGISTER) {
+			reg = context->instructions[i].operands[operand_iter].value.reg;
+			fprintf(outstream, " %%%c%d", reg_names[(reg/8)], (reg%8));
+		} else if (context->instructions[i].operands[operand_iter].type == OPERAND_TYPE_SIMM13) {
+			immediate = context->instructions[i].operands[operand_iter].value.simm13;
+			fprintf(outstream, " %d", immediate);
+		} else if (context->instructions[i].operands[operand_iter].type == OPERAND_TYPE_IMM22) {
+			immediate = context->instructions[i].operands[operand_iter].value.imm22;
+			fprintf(outstream, " %d", immediate);
+		}
+		fprintf(outstream, ",");
+	}
+	if ((num_operands > 0) && context->instructions[i].operands[0].type == OPERAND_TYPE_REGISTER) {
+		reg = context->instructions[i].operands[0].value.reg;
+		if (opcode != WR) {
+			fprintf(outstream, " %%%c%d", reg_names[(reg/8)], (reg%8));
+		} else {
+			fprintf(outstream, " %%y");
+		}
+	}
 }
 
 /**
   * @brief Prints out all instructions on the given output file stream. 
+  * @param[in,out] context The simulator context.
   * @param[in] outstream File stream where to print the information.
   */
-void printInstructions(FILE* outstream) {
+void printInstructions(sim_context_t* context, FILE* outstream) {
 
 	uint32_t i;
-	uint32_t number_instructions = gen_simulator->getNumberOfInstructions();
-	
-	uint32_t operand_iter;
-	uint32_t num_operands, operands_end;
-	int opcode;
-
-	int reg;
-	int immediate;
-	int icc;
-	uint32_t address;
-
-	/* register names */
-	const char* reg_names = "goli";
-
-	/* branch codes in plain text */
-	static const char* branch_codes[16] = {
-		"n", "e", "le", "l", "leu", "cs",
-		"neg", "vs", "a", "ne", "g", "ge",
-		"gu", "cc", "pos", "vc" 
-	};
-
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
 
 	fprintf(outstream, "Contents of instruction memory (%d bytes):\n", 
-		header.instruction_size);
+		context->header.instruction_size);
 
 	/* iterate over all existing instructions */
 	for (i = 0; i < number_instructions; i++) {
-
-		opcode = instructions[i].opcode;
-		num_operands = instructions[i].num_operands;
-		operands_end = num_operands;
-		operand_iter = 0;
-		
 		fprintf(outstream, "%08x\t", i);
+		printInstruction(context, i, outstream);
+		fprintf(outstream, "\n");
+	}
+	fprintf(outstream, "\n");
+}
 
-		switch(opcode) {
-			case CYCLE_PRINT:
-				/* only meta instruction for simulator */
-				fprintf(outstream, "sim-printcycles");
-				break;
-			case CYCLE_CLEAR:
-				/* only meta instruction for simulator */
-				fprintf(outstream, "sim-clearcycles");
-				break;
-			case CALL:
-				address = instructions[i].operands[0].value.labeladdress;
-				fprintf(outstream, "call 0x%08x", address);
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case SETHI:
-				fprintf(outstream, "sethi");
-				break;
-			case NOP:
-				fprintf(outstream, "nop");
-				break;
-			case BRANCH:
-				address = instructions[i].operands[0].value.labeladdress;
-				icc = instructions[i].operands[1].value.icc;
-				fprintf(outstream, "b%s", branch_codes[icc]);
-				fprintf(outstream, " 0x%08x", address);
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case LDSB:
-				fprintf(outstream, "ldsb");
-				break;
-			case LDSH:
-				fprintf(outstream, "ldsh");
-				break;
-			case LDUB:
-				fprintf(outstream, "ldub");
-				break;
-			case LDUH:
-				fprintf(outstream, "lduh");
-				break;
-			case LD:
-				fprintf(outstream, "ld");
-				break;
-			case LDD:
-				fprintf(outstream, "ldd");
-				break;
-			case LDSBA:
-				fprintf(outstream, "ldsba");
-				break;
-			case LDSHA:
-				fprintf(outstream, "ldsha");
-				break;
-			case LDUBA:
-				fprintf(outstream, "lduba");
-				break;
-			case LDUHA:
-				fprintf(outstream, "lduha");
-				break;
-			case LDA:
-				fprintf(outstream, "lda");
-				break;
-			case LDDA:
-				fprintf(outstream, "ldda");
-				break;
-			case STB:
-				fprintf(outstream, "stb");
-				break;
-			case STH:
-				fprintf(outstream, "sth");
-				break;
-			case ST:
-				fprintf(outstream, "st");
-				break;
-			case STD:
-				fprintf(outstream, "std");
-				break;
-			case STBA:
-				fprintf(outstream, "stba");
-				break;
-			case STHA:
-				fprintf(outstream, "stha");
-				break;
-			case STA:
-				fprintf(outstream, "sta");
-				break;
-			case STDA:
-				fprintf(outstream, "stda");
-				break;
-			case LDSTUB:
-				fprintf(outstream, "ldstub");
-				break;
-			case LDSTUBA:
-				fprintf(outstream, "ldstuba");
-				break;
-			case SWAP:
-				fprintf(outstream, "swap");
-				break;
-			case SWAPA:
-				fprintf(outstream, "swapa");
-				break;
-			case AND:
-				fprintf(outstream, "and");
-				break;
-			case ANDCC:
-				fprintf(outstream, "andcc");
-				break;
-			case ANDN:
-				fprintf(outstream, "andn");
-				break;
-			case ANDNCC:
-				fprintf(outstream, "andncc");
-				break;
-			case OR:
-				fprintf(outstream, "or");
-				break;
-			case ORCC:
-				fprintf(outstream, "orcc");
-				break;
-			case ORN:
-				fprintf(outstream, "orn");
-				break;
-			case ORNCC:
-				fprintf(outstream, "orncc");
-				break;
-			case XOR:
-				fprintf(outstream, "xor");
-				break;
-			case XORCC:
-				fprintf(outstream, "xorcc");
-				break;
-			case XNOR:
-				fprintf(outstream, "xnor");
-				break;
-			case XNORCC:
-				fprintf(outstream, "xnorcc");
-				break;
-			case SLL:
-				fprintf(outstream, "sll");
-				break;
-			case SRL:
-				fprintf(outstream, "srl");
-				break;
-			case SRA:
-				fprintf(outstream, "sra");
-				break;
-			case ADD:
-				fprintf(outstream, "add");
-				break;
-			case ADDCC:
-				fprintf(outstream, "addcc");
-				break;
-			case ADDX:
-				fprintf(outstream, "addx");
-				break;
-			case ADDXCC:
-				fprintf(outstream, "addxcc");
-				break;
-			case TADDCC:
-				fprintf(outstream, "taddcc");
-				break;
-			case TADDCCTV:
-				fprintf(outstream, "taddcctv");
-				break;
-			case SUB:
-				fprintf(outstream, "sub");
-				break;
-			case SUBCC:
-				fprintf(outstream, "subcc");
-				break;
-			case SUBX:
-				fprintf(outstream, "subx");
-				break;
-			case SUBXCC:
-				fprintf(outstream, "subxcc");
-				break;
-			case TSUBCC:
-				fprintf(outstream, "tsubcc");
-				break;
-			case TSUBCCTV:
-				fprintf(outstream, "tsubcctv");
-				break;
-			case MULSCC:
-				fprintf(outstream, "mulscc");
-				break;
-			case UMUL:
-				fprintf(outstream, "umul");
-				break;
-			case SMUL:
-				fprintf(outstream, "smul");
-				break;
-			case UMULCC:
-				fprintf(outstream, "umulcc");
-				break;
-			case SMULCC:
-				fprintf(outstream, "smulcc");
-				break;
-			case UDIV:
-				fprintf(outstream, "udiv");
-				break;
-			case SDIV:
-				fprintf(outstream, "sdiv");
-				break;
-			case UDIVCC:
-				fprintf(outstream, "udivcc");
-				break;
-			case SDIVCC:
-				fprintf(outstream, "sdivcc");
-				break;
-			case SAVE:
-				fprintf(outstream, "save");
-				break;
-			case RESTORE:
-				fprintf(outstream, "restore");
-				break;
-			case JUMPL:
-				fprintf(outstream, "jumpl");
-				break;
-			case RD:
-				fprintf(outstream, "rd");
-				/* handle predicated rd instruction */
-				if (num_operands == 3) {
-					icc = instructions[i].operands[2].value.icc;
-					fprintf(outstream, "[%s]", branch_codes[icc]);
-				} else if (num_operands == 4) {
-					reg = instructions[i].operands[2].value.preg;
-					fprintf(outstream, "[%%p%d]", reg);
-					if (instructions[i].operands[3].value.tf) {
-						fprintf(outstream, "[t]");
-					} else {
-						fprintf(outstream, "[f]");
-					}
-				}
-				reg = instructions[i].operands[1].value.reg;
-				if (reg != Y_REGISTER_NO) {
-					cleanUp();
-					simerror("Unknown source register for read instruction!");
-				}
-				fprintf(outstream, " %%y,");
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case WR:
-				fprintf(outstream, "wr");
-				break;
-			case MOV:
-				icc = instructions[i].operands[2].value.icc;
-				fprintf(outstream, "mov[%s]", branch_codes[icc]);
-				/* last operand has already been printed */
-				operands_end = 2;
-				break;
-			case SEL:
-				icc = instructions[i].operands[3].value.icc;
-				fprintf(outstream, "sel[%s]", branch_codes[icc]);
-				/* select needs special treatment for src operands */
-				if (instructions[i].operands[1].type == OPERAND_TYPE_REGISTER) {
-					reg = instructions[i].operands[1].value.reg;
-					fprintf(outstream, " %%%c%d,", reg_names[(reg/8)], (reg%8));
-					if (instructions[i].operands[2].type == OPERAND_TYPE_REGISTER) {
-						reg = instructions[i].operands[2].value.reg;
-						fprintf(outstream, " %%%c%d,", reg_names[(reg/8)], (reg%8));
-					} else if (instructions[i].operands[2].type == OPERAND_TYPE_SIMM11) {
-						immediate = instructions[i].operands[2].value.simm11;
-						fprintf(outstream, " %d,", immediate);
-					} else {
-						cleanUp();
-						simerror("Unknown type for source2 of selcc instruction!");
-					}
+/**
+  * @brief Prints the blocks with the most cycles of the profile (see
+  *        setProfiling()), each with the executions and disassembly of 
+  *        its instructions. The addresses are word addresses as printed 
+  *        by printInstructions(). Blocks which have been left early, e.g.
+  *        by the end of the simulation, count as executed completely.
+  * @param[in,out] context The simulator context.
+  * @param[in] outstream File stream where to print the information.
+  */
+void printProfile(sim_context_t* context, FILE* outstream) {
 
-				} else if (instructions[i].operands[1].type == OPERAND_TYPE_SIMM8) {
-					immediate = instructions[i].operands[1].value.simm8;
-					fprintf(outstream, " %d,", immediate);
-					/* second operand has to be simm8 then... */
-					immediate = instructions[i].operands[2].value.simm8;
-					fprintf(outstream, " %d,", immediate);
-				} else {
-					cleanUp();
-					simerror("Unknown type for source1 of selcc instruction!");
-				}
+	uint32_t number_instructions = context->simulator->getNumberOfInstructions(context);
+	uint32_t hotspots[PROFILE_HOTSPOTS];
+	uint32_t num_hotspots = 0;
+	uint32_t num_blocks = 0;
+	uint64_t* executions;
+	uint64_t* cycles;
+	uint64_t total = 0;
+	uint64_t active = 0;
+	uint32_t i, j, pc;
 
-				/* all operands have already been printed */
-				operands_end = 0;
-				break;
-			case HWLOOP_INIT:
-				fprintf(outstream, "hwloop init ");
-				address = instructions[i].operands[1].value.labeladdress;
-				reg = instructions[i].operands[0].value.loopreg;
-				if (reg == LOOPS_REGISTER) {
-					fprintf(outstream, "0x%08x, %%loops", address);
-				} else if (reg == LOOPE_REGISTER) {
-					fprintf(outstream, "0x%08x, %%loope", address);
-				} else if (reg == LOOPB_REGISTER) {
-					if (instructions[i].operands[1].type == OPERAND_TYPE_REGISTER) {
-						reg = instructions[i].operands[1].value.reg;
-						fprintf(outstream, "%%%c%d, ", reg_names[reg/8], (reg%8));
-					} else {
-						immediate = instructions[i].operands[1].value.imm22;
-						fprintf(outstream, "%d, ", immediate);
-					}
-					fprintf(outstream, "%%loopb");
-				}
-				operands_end = 0;
-				break;
-			case HWLOOP_START:
-				fprintf(outstream, "hwloop start");
-				operands_end = 0;
-				break;
-			case PREDBEGIN:
-				fprintf(outstream, "predbegin");
-				if (instructions[i].operands[0].type == OPERAND_TYPE_ICC) {
-					icc = instructions[i].operands[0].value.icc;
-					fprintf(outstream, "[%s]", branch_codes[icc]);
-				} else {
-					reg = instructions[i].operands[0].value.preg;
-					fprintf(outstream, "[%%p%d]", reg);
-					if (instructions[i].operands[1].value.tf) {
-						fprintf(outstream, "[t]");
-					} else {
-						fprintf(outstream, "[f]");
-					}
-				}
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case PREDEND:
-				fprintf(outstream, "predend");
-				break;
-			case PREDSET:
-				fprintf(outstream, "predset");
-				/* handle predicated versions of predset */
-				if (num_operands > 1) {
-					if (instructions[i].operands[1].type == OPERAND_TYPE_ICC) {
-						icc = instructions[i].operands[1].value.icc;
-					} else {
-						reg = instructions[i].operands[1].value.reg;
-						fprintf(outstream, "[%%p%d]", reg);
-						if (instructions[i].operands[2].value.tf) {
-							fprintf(outstream, "[t]");
-						} else {
-							fprintf(outstream, "[f]");
-						}
-						icc = instructions[i].operands[3].value.icc;
-					}
-					fprintf(outstream, "[%s]", branch_codes[icc]);
-				}
-				if (instructions[i].operands[0].type != OPERAND_TYPE_PREG) {
-					cleanUp();
-					simerror("Unknown register type for predclear instruction!");
-				}
-				reg = instructions[i].operands[0].value.preg;
-				fprintf(outstream, " %%p%d", reg);
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case PREDCLEAR:
-				if (instructions[i].operands[0].type != OPERAND_TYPE_PREG) {
-					cleanUp();
-					simerror("Unknown register type for predclear instruction!");
-				}
-				reg = instructions[i].operands[0].value.preg;
-				fprintf(outstream, "predclear %%p%d", reg);
-				/* there are no unhandled operands */
-				operands_end = 0;
-				break;
-			case UNKNOWN: 
-			default:
-				cleanUp();
-				simerror("Not supported opcode encoutered!");
-				break;
+	if (!context->profile_entries) {
+		return;
+	}
+	flushProfile(context);
+	cycles = context->profile_cycles;
+
+	executions = malloc((number_instructions ? number_instructions : 1)*sizeof(uint64_t));
+	if (!executions) {
+		context->simulator->cleanUp(context);
+		simerror("Could not allocate memory for profile!");
+	}
+
+	/* the blocks which are active at an address have been entered at or 
+	   before it and have not been left before it */
+	for (i = 0; i < number_instructions; i++) {
+		active += context->profile_entries[i];
+		executions[i] = active;
+		active -= context->profile_exits[i];
+		total += cycles[i];
+		if (!(context->profile_entries[i])) {
+			continue;
 		}
-		/* fully predicated instructions */
-		if (operands_end == 5) {
-			reg = instructions[i].operands[3].value.preg;
-			fprintf(outstream, "[%%p%d]", reg);
-			if (instructions[i].operands[4].value.tf) {
-				fprintf(outstream, "[t]");
-			} else {
-				fprintf(outstream, "[f]");
-			}
-			operands_end = 3;
-		} else if (operands_end == 4) {
-		/* predicated instructions on codition code */
-			icc = instructions[i].operands[3].value.icc;
-			fprintf(outstream, "[%s]", branch_codes[icc]);
-			operands_end = 3;
-		}
-
-		for (operand_iter = 1; operand_iter < operands_end; operand_iter++) {
-			if (instructions[i].operands[operand_iter].type == OPERAND_TYPE_REGISTER) {
-				reg = instructions[i].operands[operand_iter].value.reg;
-				fprintf(outstream, " %%%c%d", reg_names[(reg/8)], (reg%8));
-			} else if (instructions[i].operands[operand_iter].type == OPERAND_TYPE_SIMM13) {
-				immediate = instructions[i].operands[operand_iter].value.simm13;
-				fprintf(outstream, " %d", immediate);
-			} else if (instructions[i].operands[operand_iter].type == OPERAND_TYPE_IMM22) {
-				immediate = instructions[i].operands[operand_iter].value.imm22;
-				fprintf(outstream, " %d", immediate);
-			}
-			fprintf(outstream, ",");
-		}
-		if ((num_operands > 0) && instructions[i].operands[0].type == OPERAND_TYPE_REGISTER) {
-			reg = instructions[i].operands[0].value.reg;
-			if (opcode != WR) {
-				fprintf(outstream, " %%%c%d", reg_names[(reg/8)], (reg%8));
-			} else {
-				fprintf(outstream, " %%y");
+		num_blocks++;
+		/* keep the hotspots sorted by their cycles */
+		for (j = num_hotspots; j > 0 && cycles[hotspots[j - 1]] < cycles[i]; j--) {
+			if (j < PROFILE_HOTSPOTS) {
+				hotspots[j] = hotspots[j - 1];
+			}
+		}
+		if (j < PROFILE_HOTSPOTS) {
+			hotspots[j] = i;
+			if (num_hotspots < PROFILE_HOTSPOTS) {
+				num_hotspots++;
 			}
 		}
-		fprintf(outstream, "\n");
 	}
-	fprintf(outstream, "\n");
+
+	fprintf(outstream, "Profile (%u blocks, %llu cycles), hotspots:\n", num_blocks, 
+		(unsigned long long) total);
+	if (context->jit_env.arena_flushes) {
+		fprintf(outstream, "Compiled blocks discarded %u times (arena full)\n", 
+			context->jit_env.arena_flushes);
+	}
+	for (j = 0; j < num_hotspots; j++) {
+		pc = hotspots[j];
+		fprintf(outstream, "#%-3u %08x %18llu cycles %8.2f %% %18llu entries\n", j + 1, pc, 
+			(unsigned long long) cycles[pc], total ? 100.0*cycles[pc]/total : 0.0,
+			(unsigned long long) context->profile_entries[pc]);
+		/* the block ends before the next block or a change of the executions */
+		for (i = pc; i < number_instructions && (i == pc || 
+			(!(context->profile_entries[i]) && executions[i] == executions[i - 1])); i++) {
+			fprintf(outstream, "     %08x %18llu\t", i, (unsigned long long) executions[i]);
+			printInstruction(context, i, outstream);
+			fprintf(outstream, "\n");
+		}
+	}
+
+	free(executions);
 }
 
 /**
   * @brief Prints out the contents of the data memory to the given
   *        output file stream.
+  * @param[in,out] context The simulator context.
   * @param[in] outstream File stream where to print the information.
   */
-void printMemory(FILE* outstream) {
+void printMemory(sim_context_t* context, FILE* outstream) {
 
 	uint32_t i;
 
 	fprintf(outstream, "Contents of data memory (%d bytes):\n", 
-		data_memory_size);
-	for (i = 0; i < data_memory_size; i++) {
+		context->data_memory_size);
+	for (i = 0; i < context->data_memory_size; i++) {
 		if ((i%16) == 0) {
 			fprintf(outstream, "%08x\t", i);
 		}
-		fprintf(outstream, "%02x", data_memory[i]);
+		fprintf(outstream, "%02x", context->data_memory[i]);
 		if ((i%4) == 3) {
 			fprintf(outstream, " ");
 		}
@@ -1840,19 +5021,21 @@ void printMemory(FILE* outstream) {
 
 /**
   * @brief Returns a pointer to the simulator header struct.
+  * @param[in,out] context The simulator context.
   * @return Pointer to the simulator header struct.
   */
-simulator_header_t* getFileHeader(void) {
-	return &header;
+simulator_header_t* getFileHeader(sim_context_t* context) {
+	return &(context->header);
 }
 
 /**
   * @brief Returns the address of the pointer to the instruction
   *        array.
+  * @param[in,out] context The simulator context.
   * @return Address of the pointer to the instruction array.
   */
-sparc_instruction** getInstructions(void) {
-	return &instructions;
+sparc_instruction** getInstructions(sim_context_t* context) {
+	return &(context->instructions);
 }
 
 /**
@@ -1863,7 +5046,9 @@ sparc_instruction** getInstructions(void) {
   * @return 0 on success, 1 otherwise.
   */
 int gen_simulator_init(gen_simulator_t* simulator, error_fct_t error_fct) {
-	
+
+	struct sigaction action;
+
 	simulator->readFileHeader = readFileHeader;
 	simulator->readMemory = readMemory;
 
@@ -1871,10 +5056,33 @@ int gen_simulator_init(gen_simulator_t* simulator, error_fct_t error_fct) {
 	simulator->printMemory = printMemory;
 	simulator->printRegisters = printRegisters;
 	simulator->printResults = printResults;
+	simulator->printRegions = printRegions;
+	simulator->printBranches = printBranches;
+	simulator->printProfile = printProfile;
+	simulator->printFunctions = printFunctions;
+	simulator->writeCallStacks = writeCallStacks;
+	simulator->readFunctionMap = readFunctionMap;
+	simulator->readTimingModel = readTimingModel;
+	simulator->setCycleStatistics = setCycleStatistics;
+	simulator->setProfiling = setProfiling;
+	simulator->setCallTracing = setCallTracing;
 	
 	simulator->resetSimulator = resetSimulator;
+	simulator->saveSnapshot = saveSnapshot;
+	simulator->restoreSnapshot = restoreSnapshot;
+	simulator->writeSnapshot = writeSnapshot;
+	simulator->readSnapshot = readSnapshot;
+	simulator->freeSnapshot = freeSnapshot;
+	simulator->shareProgram = shareProgram;
+	simulator->getResults = getResults;
 
 	simulator->simulateStep = simulateStep;
+	simulator->run = run;
+	simulator->fastForward = fastForward;
+	simulator->setBlockCounts = setBlockCounts;
+	simulator->setBreakpoint = setBreakpoint;
+	simulator->setJITMode = setJITMode;
+	simulator->hasModels = hasModels;
 
 	simulator->getInstructions = getInstructions;
 	simulator->getFileHeader = getFileHeader;
@@ -1882,8 +5090,62 @@ int gen_simulator_init(gen_simulator_t* simulator, error_fct_t error_fct) {
 	simulator->cleanUp = cleanUp;
 
 	simerror = error_fct;
-	gen_simulator = simulator;
+
+	/* install the memory fault handler once for all contexts */
+	if (!fault_handler_installed) {
+		memset(&action, 0, sizeof(action));
+		action.sa_sigaction = memoryFault;
+		action.sa_flags = SA_SIGINFO;
+		sigemptyset(&action.sa_mask);
+		sigaction(SIGSEGV, &action, &data_memory_fault_action);
+		fault_handler_installed = 1;
+	}
 
 	return 0;
 
 }
+
+/**
+  * @brief Creates an empty simulator context, in which a binary can be 
+  *        loaded and simulated by the functions of the given simulator.
+  * @param[in] simulator The generic simulator data structure, 
+  *                      initialized by simulator_init() of the target and
+  *                      gen_simulator_init().
+  * @return The context, or 0 if it could not be allocated.
+  */
+sim_context_t* gen_simulator_create_context(gen_simulator_t* simulator) {
+
+	sim_context_t* context = calloc(1, sizeof(sim_context_t));
+
+	if (context) {
+		context->simulator = simulator;
+		context->psr = PSR_INIT_MASK;
+		context->npc = 1;
+		context->window = context->window_regs;
+		context->jit_mode = JIT_MODE_OFF;
+		context->region_start = REGION_START_PROGRAM;
+		context->timing[TIMING_INTEGER] = CYCLES_INTEGER_INSTR;
+		context->timing[TIMING_LOAD_SINGLE] = CYCLES_LOAD_SINGLE;
+		context->timing[TIMING_LOAD_DOUBLE] = CYCLES_LOAD_DOUBLE;
+		context->timing[TIMING_STORE_SINGLE] = CYCLES_STORE_SINGLE;
+		context->timing[TIMING_STORE_DOUBLE] = CYCLES_STORE_DOUBLE;
+		context->timing[TIMING_MUL] = CYCLES_MUL;
+		context->timing[TIMING_DIV] = CYCLES_DIV;
+		context->timing[TIMING_CONTROL] = CYCLES_INTEGER_INSTR;
+		context->timing[TIMING_WINDOW] = CYCLES_INTEGER_INSTR;
+	}
+
+	return context;
+}
+
+/**
+  * @brief Releases a simulator context and all of its memory.
+  * @param[in] context The context created by 
+  *                    gen_simulator_create_context().
+  */
+void gen_simulator_destroy_context(sim_context_t* context) {
+	if (context) {
+		context->simulator->cleanUp(context);
+		free(context);
+	}
+}
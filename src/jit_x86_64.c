@@ -0,0 +1,859 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/jit_x86_64.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+/* needed for anonymous memory mappings */
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#include "sparc_target.h"
+#include "sparc.tab.h"
+#include "jit_x86_64.h"
+
+#if defined(__x86_64__)
+
+/** Maximum number of host code bytes per compiled instruction */
+#define JIT_MAX_INSTRUCTION_SIZE	128
+/** Maximum number of host code bytes for prologue and epilogue */
+#define JIT_MAX_FRAME_SIZE			64
+
+/** Host registers used by compiled blocks */
+enum {
+	RAX = 0, RCX = 1, RDX = 2, RBX = 3,
+	RSP = 4, RBP = 5, RSI = 6, RDI = 7
+};
+
+/** Current emit position within the arena (per compiling thread) */
+static __thread uint8_t* code = 0;
+
+/** Processor state accessed by the block which is compiled */
+static __thread const jit_environment_t* jit_env = 0;
+
+/*=============================*/
+/* Host code emission          */
+/*=============================*/
+
+static void emit8(uint8_t value) {
+	*(code++) = value;
+}
+
+static void emit32(uint32_t value) {
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		emit8((uint8_t) (value >> (8*i)));
+	}
+}
+
+static void emit64(uint64_t value) {
+	emit32((uint32_t) value);
+	emit32((uint32_t) (value >> 32));
+}
+
+/**
+  * @brief Emits a 3 byte instruction.
+  */
+static void emit3(uint8_t b1, uint8_t b2, uint8_t b3) {
+	emit8(b1);
+	emit8(b2);
+	emit8(b3);
+}
+
+/**
+  * @brief Emits mov reg64, imm64.
+  */
+static void emitMovImm64(int reg, const void* value) {
+	emit8(0x48);
+	emit8(0xb8 + reg);
+	emit64((uint64_t) (uintptr_t) value);
+}
+
+/**
+  * @brief Emits mov reg32, imm32.
+  */
+static void emitMovImm32(int reg, uint32_t value) {
+	emit8(0xb8 + reg);
+	emit32(value);
+}
+
+/**
+  * @brief Emits a call of the given C function, which gets the simulator
+  *        context as first argument (rdi) and at most one further 
+  *        argument, which has to be loaded into esi before.
+  */
+static void emitCall(const void* function) {
+	emitMovImm64(RDI, jit_env->context);
+	emitMovImm64(RAX, function);
+	/* call rax */
+	emit8(0xff);
+	emit8(0xd0);
+}
+
+/**
+  * @brief Loads the pointer to the registers of the current window 
+  *        into r12.
+  */
+static void emitLoadWindow(void) {
+	/* mov r12, imm64; mov r12, [r12] */
+	emit8(0x49);
+	emit8(0xbc);
+	emit64((uint64_t) (uintptr_t) jit_env->window);
+	emit8(0x4d); emit3(0x8b, 0x24, 0x24);
+}
+
+/**
+  * @brief Loads a sparc register of the current window into a host 
+  *        register (rax, rcx or rdx).
+  * @param[in] reg Host register.
+  * @param[in] sparc_reg Sparc register number.
+  */
+static void emitLoadReg(int reg, int sparc_reg) {
+	if (sparc_reg == G_REGISTER + 0) {
+		/* xor reg32, reg32 */
+		emit8(0x31);
+		emit8(0xc0 | (reg << 3) | reg);
+		return;
+	}
+	if (sparc_reg < 8) {
+		emitMovImm64(reg, &(jit_env->glob_regs[sparc_reg]));
+		/* mov reg32, [reg64] */
+		emit8(0x8b);
+		emit8((reg << 3) | reg);
+		return;
+	}
+	/* mov reg32, [r12 + 4*(sparc_reg - 8)] */
+	emit8(0x41);
+	emit3(0x8b, 0x44 | (reg << 3), 0x24);
+	emit8(4*(sparc_reg - 8));
+}
+
+/**
+  * @brief Stores eax into a sparc register of the current window, 
+  *        writes to %g0 are ignored. Clobbers rdx.
+  * @param[in] sparc_reg Sparc register number.
+  */
+static void emitStoreReg(int sparc_reg) {
+	if (sparc_reg == G_REGISTER + 0) {
+		return;
+	}
+	if (sparc_reg < 8) {
+		emitMovImm64(RDX, &(jit_env->glob_regs[sparc_reg]));
+		/* mov [rdx], eax */
+		emit8(0x89);
+		emit8(0x02);
+		return;
+	}
+	/* mov [r12 + 4*(sparc_reg - 8)], eax */
+	emit8(0x41);
+	emit3(0x89, 0x44, 0x24);
+	emit8(4*(sparc_reg - 8));
+}
+
+/**
+  * @brief Loads source operand 2 (register or simm13) into ecx.
+  */
+static void emitSource2(sparc_operand* operand) {
+	if (operand->type == OPERAND_TYPE_REGISTER) {
+		emitLoadReg(RCX, operand->value.reg);
+	} else {
+		emitMovImm32(RCX, operand->value.simm13);
+	}
+}
+
+/**
+  * @brief Records an icc setting operation in the lazy icc state of the
+  *        simulator core. Expects src1 in edx, src2 in ecx and the result
+  *        in eax. Clobbers rsi.
+  * @param[in] op Kind of the operation (icc_op_t).
+  */
+static void emitLazyICC(uint32_t op) {
+	emitMovImm64(RSI, jit_env->lazy_icc);
+	/* mov dword [rsi], op */
+	emit8(0xc7); emit8(0x06); emit32(op);
+	/* logic operations only depend on the result */
+	if (op != ICC_OP_LOGIC) {
+		/* mov [rsi+4], edx; mov [rsi+8], ecx */
+		emit3(0x89, 0x56, 0x04);
+		emit3(0x89, 0x4e, 0x08);
+	}
+	/* mov [rsi+12], eax */
+	emit3(0x89, 0x46, 0x0c);
+}
+
+/**
+  * @brief Calculates the address of a load/store instruction into ecx.
+  */
+static void emitAddress(sparc_operand* operands) {
+	emitLoadReg(RAX, operands[1].value.reg);
+	emitSource2(&operands[2]);
+	/* add ecx, eax */
+	emit8(0x01);
+	emit8(0xc1);
+}
+
+/**
+  * @brief Terminates the simulation if the address in ecx is misaligned.
+  * @param[in] mask Bits of the address which have to be zero.
+  * @param[in] opcode Opcode for the error message.
+  */
+static void emitAlignmentCheck(uint32_t mask, int opcode) {
+	/* test ecx, mask */
+	emit8(0xf7);
+	emit8(0xc1);
+	emit32(mask);
+	/* jz over error call (mov esi + mov rdi + mov rax + call rax) */
+	emit8(0x74);
+	emit8(5 + 10 + 10 + 2);
+	emitMovImm32(RSI, opcode);
+	emitCall(jit_env->memory_error);
+}
+
+/*=============================*/
+/* Instruction translation     */
+/*=============================*/
+
+/**
+  * @brief Checks whether an instruction can be compiled.
+  * @param[in] instruction The abstract instruction.
+  * @return 1 if the instruction is supported, 0 otherwise.
+  */
+static int isSupported(sparc_instruction* instruction) {
+	sparc_operand* operands = instruction->operands;
+
+	switch (instruction->opcode) {
+		case NOP:
+		case SETHI:
+		case BRANCH:
+		case CALL:
+		case JUMPL:
+		case AND: case ANDCC: case ANDN: case ANDNCC:
+		case OR: case ORCC: case ORN: case ORNCC:
+		case XOR: case XORCC: case XNOR: case XNORCC:
+		case SLL: case SRL:
+		case ADD: case ADDCC: case TADDCC: case TADDCCTV:
+		case ADDX: case ADDXCC:
+		case SUB: case SUBCC: case TSUBCC: case TSUBCCTV:
+		case SUBX: case SUBXCC:
+		case UMUL: case UMULCC: case SMUL: case SMULCC:
+		case SAVE: case RESTORE:
+		case LDSB: case LDSBA: case LDUB: case LDUBA:
+		case LDSH: case LDSHA: case LDUH: case LDUHA:
+		case LD:
+		case STB: case STBA: case STH: case STHA: case ST: case STA:
+		case MOV:
+			return 1;
+		case SRA:
+			/* shift by register differs from the host semantics */
+			return operands[2].type != OPERAND_TYPE_REGISTER;
+		case RD:
+			return operands[1].value.reg == Y_REGISTER_NO;
+		case WR:
+			return operands[0].value.reg == Y_REGISTER_NO;
+		case SEL:
+			if (operands[1].type == OPERAND_TYPE_REGISTER) {
+				return operands[2].type == OPERAND_TYPE_REGISTER || 
+					operands[2].type == OPERAND_TYPE_SIMM11;
+			}
+			return operands[2].type == OPERAND_TYPE_SIMM8;
+		default:
+			return 0;
+	}
+}
+
+/**
+  * @brief Checks whether an instruction is a control transfer instruction.
+  */
+static int isControlTransfer(sparc_instruction* instruction) {
+	return instruction->opcode == BRANCH || instruction->opcode == CALL || 
+		instruction->opcode == JUMPL;
+}
+
+/**
+  * @brief Emits an arithmetic or logic instruction with operands 
+  *        rd, rs1 and rs2/simm13.
+  * @return 1 on success, 0 if the opcode is not handled.
+  */
+static int emitALU(sparc_instruction* instruction) {
+	sparc_operand* operands = instruction->operands;
+	int opcode = instruction->opcode;
+	uint32_t icc_op = ICC_OP_NONE;
+	int32_t count;
+
+	switch (opcode) {
+		case ADDX:
+		case ADDXCC:
+		case SUBX:
+		case SUBXCC:
+			/* the carry is read => icc of the psr have to be valid */
+			emitCall(jit_env->materialize_icc);
+			break;
+		default:
+			break;
+	}
+
+	emitLoadReg(RAX, operands[1].value.reg);
+	emitSource2(&operands[2]);
+
+	switch (opcode) {
+		case ADDX:
+		case ADDXCC:
+		case SUBX:
+		case SUBXCC:
+			/* edx = C */
+			emitMovImm64(RDX, jit_env->psr);
+			emit8(0x8b); emit8(0x12);
+			emit3(0xc1, 0xea, 20);
+			emit3(0x83, 0xe2, 0x01);
+			break;
+		default:
+			break;
+	}
+
+	switch (opcode) {
+		case ANDCC:
+		case ANDNCC:
+		case ORCC:
+		case ORNCC:
+		case XORCC:
+		case XNORCC:
+			icc_op = ICC_OP_LOGIC;
+			/* fall through */
+		case AND:
+		case ANDN:
+		case OR:
+		case ORN:
+		case XOR:
+		case XNOR:
+			if (opcode == AND || opcode == ANDCC || opcode == ANDN || opcode == ANDNCC) {
+				emit8(0x21);
+			} else if (opcode == OR || opcode == ORCC || opcode == ORN || opcode == ORNCC) {
+				emit8(0x09);
+			} else {
+				emit8(0x31);
+			}
+			emit8(0xc8);
+			/* andn, orn and xnor negate the result (as the interpreter) */
+			if (opcode == ANDN || opcode == ANDNCC || opcode == ORN || 
+				opcode == ORNCC || opcode == XNOR || opcode == XNORCC) {
+				emit8(0xf7);
+				emit8(0xd0);
+			}
+			break;
+		case SLL:
+			emit8(0xd3);
+			emit8(0xe0);
+			break;
+		case SRL:
+			emit8(0xd3);
+			emit8(0xe8);
+			break;
+		case SRA:
+			count = operands[2].value.simm13;
+			if (count > 0) {
+				emit3(0xc1, 0xf8, count >= 32 ? 31 : count);
+			}
+			break;
+		case ADDCC:
+		case TADDCC:
+		case TADDCCTV:
+			icc_op = ICC_OP_ADD;
+			/* fall through */
+		case ADD:
+			/* keep src1 for the icc: mov edx, eax */
+			emit8(0x89);
+			emit8(0xc2);
+			emit8(0x01);
+			emit8(0xc8);
+			break;
+		case SUBCC:
+		case TSUBCC:
+		case TSUBCCTV:
+			icc_op = ICC_OP_SUB;
+			/* fall through */
+		case SUB:
+			/* keep src1 for the icc: mov edx, eax */
+			emit8(0x89);
+			emit8(0xc2);
+			emit8(0x29);
+			emit8(0xc8);
+			break;
+		/* addxcc and subxcc do not change the icc (as the interpreter) */
+		case ADDX:
+		case ADDXCC:
+			emit8(0x01); emit8(0xc8);
+			emit8(0x01); emit8(0xd0);
+			break;
+		case SUBX:
+		case SUBXCC:
+			emit8(0x29); emit8(0xc8);
+			emit8(0x29); emit8(0xd0);
+			break;
+		case UMULCC:
+		case SMULCC:
+			icc_op = ICC_OP_LOGIC;
+			/* fall through */
+		case UMUL:
+		case SMUL:
+			if (opcode == SMUL || opcode == SMULCC) {
+				/* movsxd rcx, ecx */
+				emit3(0x48, 0x63, 0xc9);
+			}
+			/* imul rax, rcx */
+			emit8(0x48); emit3(0x0f, 0xaf, 0xc1);
+			/* y = rax >> 32 */
+			emit3(0x48, 0x89, 0xc2);
+			emit8(0x48); emit3(0xc1, 0xea, 32);
+			emitMovImm64(RSI, jit_env->y);
+			emit8(0x89); emit8(0x16);
+			break;
+		default:
+			return 0;
+	}
+
+	if (icc_op != ICC_OP_NONE) {
+		emitLazyICC(icc_op);
+	}
+	emitStoreReg(operands[0].value.reg);
+	return 1;
+}
+
+/**
+  * @brief Emits a load or store instruction.
+  */
+static void emitMemory(sparc_instruction* instruction) {
+	sparc_operand* operands = instruction->operands;
+	int reg = operands[0].value.reg;
+
+	switch (instruction->opcode) {
+		case LDSB:
+		case LDSBA:
+			if (reg != G_REGISTER + 0) {
+				emitAddress(operands);
+				/* movsx eax, byte [rbx + rcx] */
+				emit8(0x0f); emit3(0xbe, 0x04, 0x0b);
+				emitStoreReg(reg);
+			}
+			break;
+		case LDUB:
+		case LDUBA:
+			if (reg != G_REGISTER + 0) {
+				emitAddress(operands);
+				/* movzx eax, byte [rbx + rcx] */
+				emit8(0x0f); emit3(0xb6, 0x04, 0x0b);
+				emitStoreReg(reg);
+			}
+			break;
+		case LDSH:
+		case LDSHA:
+		case LDUH:
+		case LDUHA:
+			if (reg != G_REGISTER + 0) {
+				emitAddress(operands);
+				if (instruction->opcode == LDSH || instruction->opcode == LDSHA) {
+					emitAlignmentCheck(0x1, LDSH);
+				} else {
+					emitAlignmentCheck(0x1, LDUH);
+				}
+				/* movzx eax, word [rbx + rcx]; rol ax, 8 */
+				emit8(0x0f); emit3(0xb7, 0x04, 0x0b);
+				emit8(0x66); emit3(0xc1, 0xc0, 0x08);
+				if (instruction->opcode == LDSH || instruction->opcode == LDSHA) {
+					/* movsx eax, ax */
+					emit3(0x0f, 0xbf, 0xc0);
+				} else {
+					/* movzx eax, ax */
+					emit3(0x0f, 0xb7, 0xc0);
+				}
+				emitStoreReg(reg);
+			}
+			break;
+		case LD:
+			if (reg != G_REGISTER + 0) {
+				emitAddress(operands);
+				emitAlignmentCheck(0x3, LD);
+				/* mov eax, [rbx + rcx]; bswap eax */
+				emit3(0x8b, 0x04, 0x0b);
+				emit8(0x0f); emit8(0xc8);
+				emitStoreReg(reg);
+			}
+			break;
+		case STB:
+		case STBA:
+			emitAddress(operands);
+			emitLoadReg(RAX, reg);
+			/* mov [rbx + rcx], al */
+			emit3(0x88, 0x04, 0x0b);
+			break;
+		case STH:
+		case STHA:
+			emitAddress(operands);
+			emitAlignmentCheck(0x1, STH);
+			emitLoadReg(RAX, reg);
+			/* rol ax, 8; mov [rbx + rcx], ax */
+			emit8(0x66); emit3(0xc1, 0xc0, 0x08);
+			emit8(0x66); emit3(0x89, 0x04, 0x0b);
+			break;
+		case ST:
+		case STA:
+			emitAddress(operands);
+			emitAlignmentCheck(0x3, ST);
+			emitLoadReg(RAX, reg);
+			/* bswap eax; mov [rbx + rcx], eax */
+			emit8(0x0f); emit8(0xc8);
+			emit3(0x89, 0x04, 0x0b);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+  * @brief Emits a conditional move or select instruction.
+  */
+static void emitSelect(sparc_instruction* instruction) {
+	sparc_operand* operands = instruction->operands;
+	int icc;
+
+	if (instruction->opcode == MOV) {
+		icc = operands[2].value.icc;
+	} else {
+		icc = operands[3].value.icc;
+	}
+	emitMovImm32(RSI, icc);
+	emitCall(jit_env->evaluate_icc);
+
+	/* ecx = value if condition holds */
+	if (operands[1].type == OPERAND_TYPE_REGISTER) {
+		emitLoadReg(RCX, operands[1].value.reg);
+	} else {
+		emitMovImm32(RCX, operands[1].value.simm8);
+	}
+
+	/* edx = value otherwise (movcc keeps the destination) */
+	if (instruction->opcode == MOV) {
+		emitLoadReg(RDX, operands[0].value.reg);
+	} else if (operands[2].type == OPERAND_TYPE_REGISTER) {
+		emitLoadReg(RDX, operands[2].value.reg);
+	} else if (operands[2].type == OPERAND_TYPE_SIMM11) {
+		emitMovImm32(RDX, operands[2].value.simm11);
+	} else {
+		emitMovImm32(RDX, operands[2].value.simm8);
+	}
+
+	/* test eax, eax; cmove ecx, edx; mov eax, ecx */
+	emit8(0x85); emit8(0xc0);
+	emit3(0x0f, 0x44, 0xca);
+	emit8(0x89); emit8(0xc8);
+	emitStoreReg(operands[0].value.reg);
+}
+
+/**
+  * @brief Emits one instruction which is not a control transfer.
+  */
+static void emitInstruction(sparc_instruction* instruction) {
+	sparc_operand* operands = instruction->operands;
+
+	switch (instruction->opcode) {
+		case NOP:
+			break;
+		case SETHI:
+			emitMovImm32(RAX, operands[1].value.imm22 << 10);
+			emitStoreReg(operands[0].value.reg);
+			break;
+		case SAVE:
+		case RESTORE:
+			/* source operands are read from the old window */
+			emitLoadReg(RAX, operands[1].value.reg);
+			emitSource2(&operands[2]);
+			emit8(0x01); emit8(0xc8);
+			/* mov [rsp], eax */
+			emit3(0x89, 0x04, 0x24);
+			emitMovImm32(RSI, instruction->opcode == RESTORE);
+			emitCall(jit_env->change_cwp);
+			emitLoadWindow();
+			/* mov eax, [rsp] */
+			emit3(0x8b, 0x04, 0x24);
+			emitStoreReg(operands[0].value.reg);
+			break;
+		case RD:
+			emitMovImm64(RAX, jit_env->y);
+			emit8(0x8b); emit8(0x00);
+			emitStoreReg(operands[0].value.reg);
+			break;
+		case WR:
+			emitLoadReg(RAX, operands[1].value.reg);
+			emitSource2(&operands[2]);
+			emit8(0x31); emit8(0xc8);
+			emitMovImm64(RDX, jit_env->y);
+			emit8(0x89); emit8(0x02);
+			break;
+		case MOV:
+		case SEL:
+			emitSelect(instruction);
+			break;
+		case LDSB: case LDSBA: case LDUB: case LDUBA:
+		case LDSH: case LDSHA: case LDUH: case LDUHA:
+		case LD:
+		case STB: case STBA: case STH: case STHA: case ST: case STA:
+			emitMemory(instruction);
+			break;
+		default:
+			emitALU(instruction);
+			break;
+	}
+}
+
+/**
+  * @brief Emits the part of a control transfer instruction which is
+  *        executed before its delay slot. The branch condition is kept
+  *        in ebp.
+  * @param[in] instruction The control transfer instruction.
+  * @param[in] pc Word address of the instruction.
+  */
+static void emitControlTransfer(sparc_instruction* instruction, uint32_t pc) {
+	sparc_operand* operands = instruction->operands;
+
+	switch (instruction->opcode) {
+		case BRANCH:
+			if (operands[1].value.icc != CC_A && operands[1].value.icc != CC_N) {
+				emitMovImm32(RSI, operands[1].value.icc);
+				emitCall(jit_env->evaluate_icc);
+				/* mov ebp, eax */
+				emit8(0x89); emit8(0xc5);
+			}
+			break;
+		case CALL:
+			emitMovImm32(RAX, pc << 2);
+			emitStoreReg(CALL_ADDR_REGISTER);
+			break;
+		case JUMPL:
+			emitLoadReg(RAX, operands[1].value.reg);
+			emitSource2(&operands[2]);
+			emit8(0x01); emit8(0xc8);
+			/* shr eax, 2; mov ebp, eax */
+			emit3(0xc1, 0xe8, 0x02);
+			emit8(0x89); emit8(0xc5);
+			emitMovImm32(RAX, pc << 2);
+			emitStoreReg(operands[0].value.reg);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+  * @brief Emits the calculation of the next program counter after the
+  *        delay slot of a control transfer instruction into eax.
+  */
+static void emitNextPC(sparc_instruction* instruction, uint32_t pc) {
+	sparc_operand* operands = instruction->operands;
+
+	switch (instruction->opcode) {
+		case BRANCH:
+			if (operands[1].value.icc == CC_A) {
+				emitMovImm32(RAX, operands[0].value.labeladdress);
+			} else if (operands[1].value.icc == CC_N) {
+				emitMovImm32(RAX, pc + 2);
+			} else {
+				/* test ebp, ebp; mov eax, pc + 2; mov ecx, target; cmovne eax, ecx */
+				emit8(0x85); emit8(0xed);
+				emitMovImm32(RAX, pc + 2);
+				emitMovImm32(RCX, operands[0].value.labeladdress);
+				emit3(0x0f, 0x45, 0xc1);
+			}
+			break;
+		case CALL:
+			emitMovImm32(RAX, operands[0].value.labeladdress);
+			break;
+		case JUMPL:
+			/* mov eax, ebp */
+			emit8(0x89); emit8(0xe8);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+  * @brief Compiles a basic block into host code. A block can only be
+  *        compiled if all instructions are supported and a control 
+  *        transfer is only the second last instruction followed by a 
+  *        delay slot. The caller has to ensure that no hardware loop
+  *        and no predicated block is active when the compiled block is
+  *        executed.
+  * @param[in,out] env Processor state and arena of the simulator core.
+  * @param[in] instructions All abstract instructions.
+  * @param[in] start Word address of the first instruction.
+  * @param[in] length Number of instructions of the block.
+  * @return The compiled block, 0 if the block can not be compiled.
+  */
+jit_block_fct_t jitCompileBlock(jit_environment_t* env, 
+		sparc_instruction* instructions, uint32_t start, uint32_t length) {
+
+	uint32_t i;
+	uint8_t* entry;
+	uint8_t* page;
+	uint8_t* limit;
+	sparc_instruction* cti = 0;
+	uint32_t cti_pc = 0;
+
+	/* check whether the whole block can be compiled */
+	for (i = 0; i < length; i++) {
+		if (!isSupported(&(instructions[start + i]))) {
+			return 0;
+		}
+		if (isControlTransfer(&(instructions[start + i])) && 
+			(i + 2 != length || isControlTransfer(&(instructions[start + i + 1])))) {
+			return 0;
+		}
+	}
+
+	/* allocate arena of the context on first use, it is never writable
+	   and executable at the same time */
+	if (!env->arena) {
+		env->arena = mmap(0, JIT_ARENA_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (env->arena == MAP_FAILED) {
+			env->arena = 0;
+			return 0;
+		}
+		env->arena_used = 0;
+	}
+
+	/* the caller has to flush the arena if it is exhausted */
+	if (env->arena_used + JIT_MAX_FRAME_SIZE + length*JIT_MAX_INSTRUCTION_SIZE > JIT_ARENA_SIZE) {
+		env->arena_full = 1;
+		return 0;
+	}
+
+	/* make the pages of the block writable, the page of the previous
+	   block is shared and thus not executable while emitting */
+	page = env->arena + (env->arena_used & ~(JIT_PAGE_SIZE - 1));
+	limit = env->arena + env->arena_used + JIT_MAX_FRAME_SIZE + length*JIT_MAX_INSTRUCTION_SIZE;
+	if (mprotect(page, limit - page, PROT_READ | PROT_WRITE)) {
+		return 0;
+	}
+
+	jit_env = env;
+	entry = env->arena + env->arena_used;
+	code = entry;
+
+	/* push rbx; push rbp; push r12; sub rsp, 16 (keeps the stack 
+	   aligned for calls) */
+	emit8(0x53);
+	emit8(0x55);
+	emit8(0x41); emit8(0x54);
+	emit8(0x48); emit3(0x83, 0xec, 0x10);
+	/* rbx = data memory, r12 = registers of the current window */
+	emitMovImm64(RBX, env->data_memory);
+	emit3(0x48, 0x8b, 0x1b);
+	emitLoadWindow();
+
+	for (i = 0; i < length; i++) {
+		if (isControlTransfer(&(instructions[start + i]))) {
+			cti = &(instructions[start + i]);
+			cti_pc = start + i;
+			emitControlTransfer(cti, cti_pc);
+		} else {
+			emitInstruction(&(instructions[start + i]));
+		}
+	}
+
+	if (cti) {
+		emitNextPC(cti, cti_pc);
+	} else {
+		emitMovImm32(RAX, start + length);
+	}
+
+	/* add rsp, 16; pop r12; pop rbp; pop rbx; ret */
+	emit8(0x48); emit3(0x83, 0xc4, 0x10);
+	emit8(0x41); emit8(0x5c);
+	emit8(0x5d);
+	emit8(0x5b);
+	emit8(0xc3);
+
+	/* make the emitted pages executable again */
+	if (mprotect(page, code - page, PROT_READ | PROT_EXEC)) {
+		return 0;
+	}
+
+	env->arena_used = (uint32_t) (code - env->arena);
+	/* align next block */
+	env->arena_used = (env->arena_used + 15) & ~15u;
+
+	return (jit_block_fct_t) entry;
+}
+
+/**
+  * @brief Discards all compiled blocks of the arena, e.g. if it is 
+  *        exhausted. The caller has to reset all references to them.
+  * @param[in,out] env Processor state and arena of the simulator core.
+  */
+void jitFlush(jit_environment_t* env) {
+	env->arena_used = 0;
+	env->arena_full = 0;
+	env->arena_flushes++;
+}
+
+/**
+  * @brief Releases the executable arena of all compiled blocks.
+  * @param[in,out] env Processor state and arena of the simulator core.
+  */
+void jitCleanUp(jit_environment_t* env) {
+	if (env->arena) {
+		munmap(env->arena, JIT_ARENA_SIZE);
+		env->arena = 0;
+		env->arena_used = 0;
+	}
+}
+
+#else
+
+/**
+  * @brief Compiling is not supported on this host.
+  * @return Always 0.
+  */
+jit_block_fct_t jitCompileBlock(jit_environment_t* env, 
+		sparc_instruction* instructions, uint32_t start, uint32_t length) {
+	return 0;
+}
+
+/**
+  * @brief Nothing to flush on this host.
+  */
+void jitFlush(jit_environment_t* env) {
+}
+
+/**
+  * @brief Nothing to release on this host.
+  */
+void jitCleanUp(jit_environment_t* env) {
+}
+
+#endif /* __x86_64__ */
@@ -0,0 +1,106 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/sim_branch.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "sim_branch.h"
+
+/**
+  * @brief Initializes a branch predictor without history.
+  * @param[out] predictor The predictor.
+  * @param[in] model The model, PREDICTOR_NONE disables the predictor.
+  * @param[in] bits Index bits of the counter table, 1 to 
+  *                 PREDICTOR_MAX_BITS, ignored by the static model.
+  * @param[in] penalty Cycles of a misprediction.
+  * @return 0 on success, 1 for invalid index bits and 2 if there is not
+  *         enough memory.
+  */
+int predictorInit(predictor_t* predictor, predictor_model_t model, uint32_t bits, 
+	uint32_t penalty) {
+
+	predictor->counters = 0;
+	predictor->index_mask = 0;
+	if (model != PREDICTOR_NONE && model != PREDICTOR_BTFN) {
+		if (!bits || bits > PREDICTOR_MAX_BITS) {
+			return 1;
+		}
+		predictor->counters = malloc(1 << bits);
+		if (!predictor->counters) {
+			return 2;
+		}
+		predictor->index_mask = (1 << bits) - 1;
+	}
+
+	predictor->model = model;
+	predictor->penalty = penalty;
+	predictorReset(predictor);
+
+	return 0;
+}
+
+/**
+  * @brief Initializes a branch predictor without history with the model,
+  *        table size and penalty of another predictor. An initialized 
+  *        predictor is freed before.
+  * @param[in,out] predictor The predictor.
+  * @param[in] source The initialized predictor to copy from.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int predictorInitFrom(predictor_t* predictor, const predictor_t* source) {
+	predictorFree(predictor);
+	return predictorInit(predictor, source->model, __builtin_popcount(source->index_mask),
+		source->penalty);
+}
+
+/**
+  * @brief Clears the history and the statistics. The counters start 
+  *        as not taken (1-bit) or weakly not taken (2-bit, gshare).
+  * @param[in,out] predictor The predictor.
+  */
+void predictorReset(predictor_t* predictor) {
+
+	uint32_t i;
+
+	if (predictor->counters) {
+		for (i = 0; i <= predictor->index_mask; i++) {
+			predictor->counters[i] = (predictor->model == PREDICTOR_1BIT) ? 0 : 1;
+		}
+	}
+	predictor->history = 0;
+	predictor->stats.branches = 0;
+	predictor->stats.taken = 0;
+	predictor->stats.mispredictions = 0;
+}
+
+/**
+  * @brief Frees the counter table of a predictor and disables it.
+  * @param[in,out] predictor The predictor.
+  */
+void predictorFree(predictor_t* predictor) {
+	free(predictor->counters);
+	predictor->counters = 0;
+	predictor->model = PREDICTOR_NONE;
+}
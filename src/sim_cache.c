@@ -0,0 +1,181 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/sim_cache.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "sim_cache.h"
+
+/** Nibble i holds way i, the order of an untouched set */
+#define CACHE_INITIAL_ORDER	0xfedcba9876543210ULL
+/** Mask with the given bit of every nibble set */
+#define CACHE_NIBBLES(bit)	(0x1111111111111111ULL << (bit))
+
+/**
+  * @brief Moves a way to the lowest position of the order of a set. The
+  *        position of the way is found without a loop: the nibbles of 
+  *        the order are a permutation, so exactly one nibble of order 
+  *        XOR way is zero.
+  * @param[in] order The order of the set.
+  * @param[in] way The way.
+  * @return The new order of the set.
+  */
+static uint64_t promoteWay(uint64_t order, uint32_t way) {
+
+	uint64_t x = order ^ (way*CACHE_NIBBLES(0));
+	uint64_t zero = (x - CACHE_NIBBLES(0)) & ~x & CACHE_NIBBLES(3);
+	/* bit offset of the nibble holding the way */
+	uint32_t shift = __builtin_ctzll(zero) - 3;
+	uint64_t below = order & ((1ULL << shift) - 1);
+	uint64_t above = (shift < 60) ? (order & ~((1ULL << (shift + 4)) - 1)) : 0;
+
+	return above | (below << 4) | way;
+}
+
+/**
+  * @brief Initializes an empty cache.
+  * @param[out] cache The cache.
+  * @param[in] size Capacity in bytes.
+  * @param[in] ways Associativity, at most CACHE_MAX_WAYS.
+  * @param[in] line_size Line size in bytes, a power of two of at least
+  *                      CACHE_MIN_LINE_SIZE.
+  * @param[in] policy Replacement policy.
+  * @param[in] penalty Cycles of a miss.
+  * @return 0 on success, 1 for an invalid geometry (the number of sets
+  *         has to be a power of two) and 2 if there is not enough memory.
+  */
+int cacheInit(cache_t* cache, uint32_t size, uint32_t ways, uint32_t line_size, 
+	cache_policy_t policy, uint32_t penalty) {
+
+	uint32_t sets;
+
+	if (!ways || ways > CACHE_MAX_WAYS || line_size < CACHE_MIN_LINE_SIZE ||
+		(line_size & (line_size - 1)) || size % (ways*line_size)) {
+		return 1;
+	}
+	sets = size/(ways*line_size);
+	if (!sets || (sets & (sets - 1))) {
+		return 1;
+	}
+
+	cache->tags = malloc(sets*ways*sizeof(uint32_t));
+	cache->order = malloc(sets*sizeof(uint64_t));
+	if (!cache->tags || !cache->order) {
+		cacheFree(cache);
+		return 2;
+	}
+
+	cache->ways = ways;
+	cache->set_mask = sets - 1;
+	cache->line_bits = __builtin_ctz(line_size);
+	cache->policy = policy;
+	cache->penalty = penalty;
+	cacheReset(cache);
+
+	return 0;
+}
+
+/**
+  * @brief Initializes an empty cache with the geometry, replacement 
+  *        policy and penalty of another cache. An initialized cache is
+  *        freed before.
+  * @param[in,out] cache The cache.
+  * @param[in] source The initialized cache to copy from.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int cacheInitFrom(cache_t* cache, const cache_t* source) {
+	cacheFree(cache);
+	return cacheInit(cache, ((source->set_mask + 1)*source->ways) << source->line_bits,
+		source->ways, 1 << source->line_bits, source->policy, source->penalty);
+}
+
+/**
+  * @brief Invalidates all lines and clears the statistics.
+  * @param[in,out] cache The cache.
+  */
+void cacheReset(cache_t* cache) {
+
+	uint32_t i;
+
+	for (i = 0; i < (cache->set_mask + 1)*cache->ways; i++) {
+		cache->tags[i] = CACHE_INVALID;
+	}
+	for (i = 0; i <= cache->set_mask; i++) {
+		cache->order[i] = CACHE_INITIAL_ORDER;
+	}
+	cache->seed = 0x2545f491;
+	cache->stats.accesses = 0;
+	cache->stats.misses = 0;
+}
+
+/**
+  * @brief Frees the arrays of a cache.
+  * @param[in,out] cache The cache.
+  */
+void cacheFree(cache_t* cache) {
+	free(cache->tags);
+	free(cache->order);
+	cache->tags = 0;
+	cache->order = 0;
+}
+
+/**
+  * @brief Looks up a line which is not in the most recently used way of
+  *        its set, and replaces a way on a miss.
+  * @param[in,out] cache The cache.
+  * @param[in] set The set of the line.
+  * @param[in] line The line address.
+  * @return The penalty of a miss, 0 on a hit.
+  */
+uint32_t cacheLookup(cache_t* cache, uint32_t set, uint32_t line) {
+
+	uint32_t* tags = &(cache->tags[set*cache->ways]);
+	uint32_t way;
+
+	for (way = 0; way < cache->ways; way++) {
+		if (tags[way] == line) {
+			/* FIFO keeps the order of insertion */
+			if (cache->policy != CACHE_POLICY_FIFO) {
+				cache->order[set] = promoteWay(cache->order[set], way);
+			}
+			return 0;
+		}
+	}
+
+	(cache->stats.misses)++;
+	if (cache->policy == CACHE_POLICY_RANDOM) {
+		/* xorshift32 */
+		cache->seed ^= cache->seed << 13;
+		cache->seed ^= cache->seed >> 17;
+		cache->seed ^= cache->seed << 5;
+		way = cache->seed % cache->ways;
+	} else {
+		way = (cache->order[set] >> (4*(cache->ways - 1))) & 0xf;
+	}
+	tags[way] = line;
+	cache->order[set] = promoteWay(cache->order[set], way);
+
+	return cache->penalty;
+}
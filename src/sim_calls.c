@@ -0,0 +1,382 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/sim_calls.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparc_target.h"
+#include "sparc.tab.h"
+#include "sim_calls.h"
+
+/** Initial number of nodes and frames */
+#define CALLS_INITIAL_SIZE	64
+
+/** Register which receives the return address of a call (%o7) */
+#define CALLS_LINK_REGISTER	(O_REGISTER + 7)
+
+/**
+  * @brief Starts a new call tree and call stack with the given function
+  *        as root, the names of the functions are kept.
+  * @param[in,out] calls The call stack.
+  * @param[in] root Word address of the function which is executed first.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int callsReset(call_stack_t* calls, uint32_t root) {
+
+	if (!calls->nodes) {
+		calls->nodes = malloc(CALLS_INITIAL_SIZE*sizeof(call_node_t));
+		calls->max_nodes = CALLS_INITIAL_SIZE;
+	}
+	if (!calls->frames) {
+		calls->frames = malloc(CALLS_INITIAL_SIZE*sizeof(call_frame_t));
+		calls->max_depth = CALLS_INITIAL_SIZE;
+	}
+	if (!calls->nodes || !calls->frames) {
+		return 2;
+	}
+
+	calls->nodes[0].function = root;
+	calls->nodes[0].parent = CALLS_NONE;
+	calls->nodes[0].child = CALLS_NONE;
+	calls->nodes[0].sibling = CALLS_NONE;
+	calls->nodes[0].calls = 1;
+	calls->nodes[0].cycles = 0;
+	calls->nodes[0].instructions = 0;
+	calls->num_nodes = 1;
+	calls->frames[0].node = 0;
+	calls->frames[0].ret = CALLS_NONE;
+	calls->depth = 1;
+	calls->last = CALLS_NONE;
+	calls->start_cycles = 0;
+	calls->start_instructions = 0;
+
+	return 0;
+}
+
+/**
+  * @brief Pushes a call of the given function on the call stack and 
+  *        enters its node below the current node.
+  * @param[in,out] calls The call stack.
+  * @param[in] function Word address of the called function.
+  * @param[in] ret Word address where the call returns to.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+static int pushCall(call_stack_t* calls, uint32_t function, uint32_t ret) {
+
+	uint32_t parent = calls->frames[calls->depth - 1].node;
+	uint32_t node = calls->nodes[parent].child;
+	void* grown;
+
+	while (node != CALLS_NONE && calls->nodes[node].function != function) {
+		node = calls->nodes[node].sibling;
+	}
+
+	if (node == CALLS_NONE) {
+		if (calls->num_nodes == calls->max_nodes) {
+			grown = realloc(calls->nodes, 2*calls->max_nodes*sizeof(call_node_t));
+			if (!grown) {
+				return 2;
+			}
+			calls->nodes = grown;
+			calls->max_nodes *= 2;
+		}
+		node = (calls->num_nodes)++;
+		calls->nodes[node].function = function;
+		calls->nodes[node].parent = parent;
+		calls->nodes[node].child = CALLS_NONE;
+		calls->nodes[node].sibling = calls->nodes[parent].child;
+		calls->nodes[node].calls = 0;
+		calls->nodes[node].cycles = 0;
+		calls->nodes[node].instructions = 0;
+		calls->nodes[parent].child = node;
+	}
+
+	if (calls->depth == calls->max_depth) {
+		grown = realloc(calls->frames, 2*calls->max_depth*sizeof(call_frame_t));
+		if (!grown) {
+			return 2;
+		}
+		calls->frames = grown;
+		calls->max_depth *= 2;
+	}
+	(calls->nodes[node].calls)++;
+	calls->frames[calls->depth].node = node;
+	calls->frames[calls->depth].ret = ret;
+	(calls->depth)++;
+
+	return 0;
+}
+
+/**
+  * @brief Updates the call stack when consecutive instructions are 
+  *        entered, which have to be executed after the last entered ones.
+  *        If the instruction before the last executed one is a call 
+  *        (call or jmpl writing %o7), the last one is its delay slot and 
+  *        the entered instruction is the called function. If it is a jmpl
+  *        without link to the return address of an active call, e.g. ret 
+  *        or retl, that call and all calls above it return. As returns 
+  *        are matched by address, leaf functions without save/restore and
+  *        tail jumps, which do not return, are handled alike.
+  * @param[in,out] calls The call stack.
+  * @param[in] instructions The instructions of the program.
+  * @param[in] start Word address of the first entered instruction.
+  * @param[in] length Number of entered instructions.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int callsEnter(call_stack_t* calls, const sparc_instruction* instructions, uint32_t start,
+	uint32_t length) {
+
+	uint32_t last = calls->last;
+	const sparc_instruction* transfer;
+	uint32_t i;
+
+	calls->last = start + length - 1;
+	if (last == CALLS_NONE || last == 0) {
+		return 0;
+	}
+
+	transfer = &(instructions[last - 1]);
+	if (transfer->opcode == CALL || (transfer->opcode == JUMPL && 
+		transfer->operands[0].value.reg == CALLS_LINK_REGISTER)) {
+		return pushCall(calls, start, last + 1);
+	}
+	if (transfer->opcode == JUMPL && transfer->operands[0].value.reg == G_REGISTER) {
+		for (i = calls->depth - 1; i > 0; i--) {
+			if (calls->frames[i].ret == start) {
+				calls->depth = i;
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+  * @brief Names a function, e.g. by the label of its first instruction.
+  *        A function keeps its first name.
+  * @param[in,out] calls The call stack.
+  * @param[in] number_instructions Number of instructions of the program.
+  * @param[in] function Word address of the function.
+  * @param[in] name The name, which is copied.
+  * @return 0 on success, 1 if the address is not an instruction, 2 if 
+  *         there is not enough memory.
+  */
+int callsSetName(call_stack_t* calls, uint32_t number_instructions, uint32_t function, 
+	const char* name) {
+
+	if (function >= number_instructions) {
+		return 1;
+	}
+	if (!calls->names) {
+		calls->names = calloc(number_instructions, sizeof(char*));
+		if (!calls->names) {
+			return 2;
+		}
+		calls->num_names = number_instructions;
+	}
+	if (!calls->names[function]) {
+		calls->names[function] = malloc(strlen(name) + 1);
+		if (!calls->names[function]) {
+			return 2;
+		}
+		strcpy(calls->names[function], name);
+	}
+
+	return 0;
+}
+
+/**
+  * @brief Returns the name of a function, or its byte address if it has
+  *        no name.
+  * @param[in] calls The call stack.
+  * @param[in] function Word address of the function.
+  * @param[out] buffer Buffer for the address, at least 11 characters.
+  * @return The name.
+  */
+static const char* functionName(const call_stack_t* calls, uint32_t function, char* buffer) {
+	if (calls->names && function < calls->num_names && calls->names[function]) {
+		return calls->names[function];
+	}
+	sprintf(buffer, "0x%08x", function << 2);
+	return buffer;
+}
+
+/** Statistics of a function over all of its nodes */
+typedef struct {
+	uint64_t		calls;
+	uint64_t		inclusive_cycles;
+	uint64_t		exclusive_cycles;
+	uint64_t		inclusive_instructions;
+	uint64_t		exclusive_instructions;
+} call_function_t;
+
+/**
+  * @brief Prints the calls and the inclusive and exclusive cycles and 
+  *        instructions of each called function, ordered by the inclusive 
+  *        cycles. The inclusive values of a recursive function only count
+  *        its outermost calls.
+  * @param[in] calls The call stack.
+  * @param[in] number_instructions Number of instructions of the program.
+  * @param[in] outstream File stream where to print the table.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int callsPrintFunctions(const call_stack_t* calls, uint32_t number_instructions, FILE* outstream) {
+
+	call_function_t* functions = calloc(number_instructions ? number_instructions : 1, 
+		sizeof(call_function_t));
+	uint64_t* totals = malloc(2*(calls->num_nodes ? calls->num_nodes : 1)*sizeof(uint64_t));
+	uint32_t* order = malloc((number_instructions ? number_instructions : 1)*sizeof(uint32_t));
+	uint32_t num_functions = 0;
+	uint32_t i, j, node, parent;
+	call_function_t* function;
+	char buffer[16];
+
+	if (!functions || !totals || !order) {
+		free(functions);
+		free(totals);
+		free(order);
+		return 2;
+	}
+
+	/* the totals of a node include its children, which follow it */
+	for (i = 0; i < calls->num_nodes; i++) {
+		totals[2*i] = calls->nodes[i].cycles;
+		totals[2*i + 1] = calls->nodes[i].instructions;
+	}
+	for (i = calls->num_nodes; i-- > 1; ) {
+		parent = calls->nodes[i].parent;
+		totals[2*parent] += totals[2*i];
+		totals[2*parent + 1] += totals[2*i + 1];
+	}
+
+	for (i = 0; i < calls->num_nodes; i++) {
+		function = &(functions[calls->nodes[i].function]);
+		if (!(function->calls)) {
+			order[num_functions++] = calls->nodes[i].function;
+		}
+		function->calls += calls->nodes[i].calls;
+		function->exclusive_cycles += calls->nodes[i].cycles;
+		function->exclusive_instructions += calls->nodes[i].instructions;
+		for (node = calls->nodes[i].parent; node != CALLS_NONE && 
+			calls->nodes[node].function != calls->nodes[i].function; node = calls->nodes[node].parent);
+		if (node == CALLS_NONE) {
+			function->inclusive_cycles += totals[2*i];
+			function->inclusive_instructions += totals[2*i + 1];
+		}
+	}
+
+	/* insertion sort by the inclusive cycles */
+	for (i = 1; i < num_functions; i++) {
+		node = order[i];
+		for (j = i; j > 0 && functions[order[j - 1]].inclusive_cycles < 
+			functions[node].inclusive_cycles; j--) {
+			order[j] = order[j - 1];
+		}
+		order[j] = node;
+	}
+
+	fprintf(outstream, "Functions (%u):\n", num_functions);
+	fprintf(outstream, "%-24s %12s %18s %8s %18s %8s %18s %18s\n", "function", "calls", 
+		"inclusive cycles", "%", "exclusive cycles", "%", "incl. instructions", 
+		"excl. instructions");
+	for (i = 0; i < num_functions; i++) {
+		function = &(functions[order[i]]);
+		fprintf(outstream, "%-24s %12llu %18llu %8.2f %18llu %8.2f %18llu %18llu\n", 
+			functionName(calls, order[i], buffer),
+			(unsigned long long) function->calls, 
+			(unsigned long long) function->inclusive_cycles, 
+			totals[0] ? 100.0*function->inclusive_cycles/totals[0] : 0.0,
+			(unsigned long long) function->exclusive_cycles, 
+			totals[0] ? 100.0*function->exclusive_cycles/totals[0] : 0.0,
+			(unsigned long long) function->inclusive_instructions, 
+			(unsigned long long) function->exclusive_instructions);
+	}
+
+	free(functions);
+	free(totals);
+	free(order);
+
+	return 0;
+}
+
+/**
+  * @brief Writes the exclusive cycles of each node of the call tree as
+  *        folded stacks, one line per node with the functions from main
+  *        to the node separated by ';' and the cycles, e.g. 
+  *        "main;sort;swap 1200", as read by flame graph tools. Nodes 
+  *        without cycles are left out.
+  * @param[in] calls The call stack.
+  * @param[in] outstream File stream where to write the stacks.
+  * @return 0 on success, 1 if writing failed, 2 if there is not enough
+  *         memory.
+  */
+int callsWriteFolded(const call_stack_t* calls, FILE* outstream) {
+
+	uint32_t* path = malloc((calls->num_nodes ? calls->num_nodes : 1)*sizeof(uint32_t));
+	uint32_t length;
+	uint32_t i, node;
+	char buffer[16];
+
+	if (!path) {
+		return 2;
+	}
+
+	for (i = 0; i < calls->num_nodes; i++) {
+		if (!(calls->nodes[i].cycles)) {
+			continue;
+		}
+		length = 0;
+		for (node = i; node != CALLS_NONE; node = calls->nodes[node].parent) {
+			path[length++] = node;
+		}
+		while (length--) {
+			fprintf(outstream, "%s%c", functionName(calls, calls->nodes[path[length]].function, 
+				buffer), length ? ';' : ' ');
+		}
+		fprintf(outstream, "%llu\n", (unsigned long long) calls->nodes[i].cycles);
+	}
+	free(path);
+
+	return ferror(outstream) ? 1 : 0;
+}
+
+/**
+  * @brief Frees the call tree, the call stack and the names.
+  * @param[in,out] calls The call stack.
+  */
+void callsFree(call_stack_t* calls) {
+
+	uint32_t i;
+
+	for (i = 0; calls->names && i < calls->num_names; i++) {
+		free(calls->names[i]);
+	}
+	free(calls->names);
+	free(calls->nodes);
+	free(calls->frames);
+	memset(calls, 0, sizeof(call_stack_t));
+}
@@ -24,14 +24,49 @@
  * THE SOFTWARE.
  */
 
+#define _DEFAULT_SOURCE
+
 #include <stdio.h>
 #include <dlfcn.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <getopt.h>
 #include <string.h>
+#include <pthread.h>
+#include <setjmp.h>
 
 #include "gen_simulator.h"
-
+#include "sim_sampling.h"
+
+/** Number of supported targets */
+#define NUM_TARGETS 4
+/** Pseudo target which compares all targets */
+#define SIM_LIB_ALL NUM_TARGETS
+/** Width of a column of the comparison table */
+#define COMPARE_COLUMN_WIDTH 19
+/** Maximum length of the error message of a target */
+#define MAX_ERROR_LENGTH 256
+
+/** Simulation of one target in the comparison of all targets */
+typedef struct {
+	int						sim_lib;
+	gen_simulator_t			simulator;
+	sim_context_t*			context;
+	FILE*					instream;
+	int						reference;
+	int						jit_mode;
+	const char*				timingfile;
+	pthread_t				thread;
+	sim_results_t			results;
+	uint32_t				number_instructions;
+	/* cycles of every region closed by a cycle print instruction */
+	uint64_t*				region_cycles;
+	uint32_t				num_regions;
+	uint32_t				max_regions;
+	/* error message, if the simulation failed */
+	int						failed;
+	char					error[MAX_ERROR_LENGTH];
+} target_run_t;
 
 /** Name of the current program. */
 static char* progname;
@@ -42,71 +77,527 @@ char* optarg;
 static FILE* instream; 
 static FILE* outstream;
 
-/* declare library handle for dynamic opening of shared libraries */
-static void* lib_handle = 0;
+/** Simulation of the current thread when comparing all targets, errors 
+    only terminate the simulation of the target */
+static __thread target_run_t* current_run;
+/** Jump buffer to leave the simulation of the current target */
+static __thread sigjmp_buf run_error;
+
+/* declare library handles for dynamic opening of shared libraries */
+static void* lib_handles[NUM_TARGETS];
+
+/* names of all supported targets */
+static const char* target_names[NUM_TARGETS] = {
+	"v8",
+	"v8-blockicc-movcc",
+	"v8-blockpreg-selcc",
+	"v8-blockicc-selcc"
+};
+
+/* paths to all supported targets */
+static const char* sim_libraries[NUM_TARGETS] = { 
+	"shared/libsim_sparc_v8.so",
+	"shared/libsim_sparc_v8-blockicc-movcc.so",
+	"shared/libsim_sparc_v8-blockpreg-selcc.so",
+	"shared/libsim_sparc_v8-blockicc-selcc.so"
+};
 
 /**
   * @brief Prints out a usage message on the given file stream.
   * @param[in] out The file stream where to write the message.
   */
 void usage(FILE* out) {
-	fprintf(out, "Usage: %s -t <target> [-i <binfile>] [-o <logfile>] [-s]\n\t-s\tTurn on silent mode.\n\n", progname);
+	fprintf(out, "Usage: %s -t <target> [-i <binfile>] [-o <logfile>] [-s] [-r] [-j] [-d] "
+		"[-M <timingfile>] [-R] [-C] [-B] [-p] [-c <stackfile> [-m <mapfile>]] [-S <snapfile>] [-L <snapfile>] [-F <trigger> [-W <window>]] [-P <interval>[:<clusters>[:<samples>]]]\n"
+		"\t-s\tTurn on silent mode.\n"
+		"\t-r\tUse the reference step-by-step interpreter instead of the threaded code engine.\n"
+		"\t-j\tCompile hot blocks to host code.\n"
+		"\t-d\tCompile hot blocks and check them against the interpreter.\n"
+		"\t-M\tRead the cycles of the instruction classes from a timing model file.\n"
+		"\t-R\tPrint a table of all regions between sim-clearcycles/sim-printcycles after\n"
+		"\t\tthe simulation instead of the cycles of each region.\n"
+		"\t-C, --cycle-stats\n"
+		"\t\tLike -R, with percentiles of the cycles of each region and of all regions.\n"
+		"\t-B\tPrint the statistics of each conditional branch after the simulation, if the\n"
+		"\t\ttiming model contains a branch predictor.\n"
+		"\t-p, --profile\n"
+		"\t\tCount the executions and cycles of each block and print the blocks with the most\n"
+		"\t\tcycles with their instructions after the simulation.\n"
+		"\t-c, --call-stacks\n"
+		"\t\tTrace calls and returns, print the cycles and instructions of each function and\n"
+		"\t\twrite the cycles of each path of calls as folded stacks to the given file.\n"
+		"\t-m\tRead the names of the functions from a map file (hex address and name per line).\n"
+		"\t-S\tSave a snapshot of the initial state to a file.\n"
+		"\t-L\tStart the simulation from a snapshot of the same binary, which is loaded as\n"
+		"\t\tusual and then overwritten by the registers and data memory of the snapshot.\n"
+		"\t-F\tFast-forward without cycles and output until the trigger: i<count> "
+		"instructions,\n\t\tp<address> byte address of an instruction or c<n> n-th sim-clearcycles.\n"
+		"\t-W\tSimulate windows of the given number of instructions with cycles after each\n"
+		"\t\ttrigger, default is the rest of the program.\n"
+		"\t-P\tEstimate the cycles from intervals of the given number of instructions, which\n"
+		"\t\tare clustered into at most <clusters> (default %d) clusters of which <samples>\n"
+		"\t\t(default %d) intervals each are simulated with cycles.\n"
+		"With target \"all\", the binaries of all targets are simulated concurrently and compared,\n"
+		"\"%%t\" in the binfile is replaced by the name of each target.\n\n", progname,
+		SAMPLING_MAX_CLUSTERS, SAMPLING_SAMPLES);
 }
 
 /**
   * @brief Prints out an error message, closes open file handles
-  * and terminates program.
+  * and terminates program. Errors of the simulation of a target, 
+  * when comparing all targets, only terminate this simulation.
   * @param[in] e Error message to be printed.
   */
 void simerror(char* e) {
 
+	int i;
+
+	if (current_run) {
+		current_run->failed = 1;
+		snprintf(current_run->error, MAX_ERROR_LENGTH, "%s", e);
+		siglongjmp(run_error, 1);
+	}
+
 	fprintf(stderr, "%s: %s\n", progname, e);
 
 	/* close all open file handles */
-	if (instream != stdin) {
+	if (instream && instream != stdin) {
 		fclose(instream);
 	}
 	if (outstream != stdout) {
 		fclose(outstream);
 	}
 	
-	if (lib_handle && dlclose(lib_handle)) {
-		fprintf(stderr, "%s: Could not close shared library!",
-			progname);
-		exit(EXIT_FAILURE);
+	for (i = 0; i < NUM_TARGETS; i++) {
+		if (lib_handles[i] && dlclose(lib_handles[i])) {
+			fprintf(stderr, "%s: Could not close shared library!",
+				progname);
+			exit(EXIT_FAILURE);
+		}
 	}
 
 	exit(EXIT_FAILURE);
 }
 
-int main(int argc, char** argv) {
+/**
+  * @brief Opens the shared library of a target and registers its 
+  *        functions and the generic functions in the given simulator.
+  * @param[in] sim_lib Index of the target.
+  * @param[out] simulator The generic simulator data structure.
+  */
+static void loadTarget(int sim_lib, gen_simulator_t* simulator) {
 
 	/* declare error string for dynamic opening of shared libraries */
 	char* dl_error;
 
-	/* function pointer to assembler init function */
+	/* function pointer to simulator init function */
 	simulator_init_fct_t init_fct;
 
+	/* open shared library */
+	lib_handles[sim_lib] = dlopen(sim_libraries[sim_lib], RTLD_LAZY);
+	if (!lib_handles[sim_lib]) {
+		fprintf(stderr, "%s\n", dlerror());
+		exit(EXIT_FAILURE);
+	}
+
+	/* get simulator init function */
+	*(void **) (&init_fct) = dlsym(lib_handles[sim_lib], "simulator_init");
+	if ((dl_error = dlerror()) != NULL) {
+		dlclose(lib_handles[sim_lib]);
+		lib_handles[sim_lib] = 0;
+		fprintf(stderr, "%s: %s\n", progname, dl_error);
+		fprintf(stderr, "%s: Error when opening shared library %s!\n", progname, sim_libraries[sim_lib]);
+		exit(EXIT_FAILURE);
+	}
+
+	/* let simulator register its target specific functions */
+	if (init_fct(simulator, simerror)) {
+		simerror("Could not initialize target specific simulator correctly!");
+	}
+
+	/* let simulator register its generic functions */
+	if (gen_simulator_init(simulator, simerror)) {
+		simerror("Could not initialize generic simulator correctly!");
+	}
+}
+
+/**
+  * @brief Reads a timing model file into a context.
+  * @param[in] simulator The generic simulator data structure.
+  * @param[in,out] context The simulator context.
+  * @param[in] timingfile Path of the timing model file.
+  */
+static void readTiming(gen_simulator_t* simulator, sim_context_t* context, const char* timingfile) {
+
+	FILE* timingstream = fopen(timingfile, "r");
+
+	if (!timingstream) {
+		simulator->cleanUp(context);
+		simerror("Could not open timing model file for reading!");
+	}
+	simulator->readTimingModel(context, timingstream);
+	fclose(timingstream);
+}
+
+/**
+  * @brief Reads the names of the functions from a map file.
+  * @param[in] simulator The generic simulator data structure.
+  * @param[in,out] context The simulator context.
+  * @param[in] mapfile Name of the function map file.
+  */
+static void readMap(gen_simulator_t* simulator, sim_context_t* context, const char* mapfile) {
+
+	FILE* mapstream = fopen(mapfile, "r");
+
+	if (!mapstream) {
+		simulator->cleanUp(context);
+		simerror("Could not open function map file for reading!");
+	}
+	simulator->readFunctionMap(context, mapstream);
+	fclose(mapstream);
+}
+
+/**
+  * @brief Alternates between fast-forwarding to a trigger without 
+  *        cycles and output, and simulating a window with cycles.
+  * @param[in] simulator The generic simulator data structure.
+  * @param[in,out] context The simulator context.
+  * @param[in] trigger Kind of the trigger: 'i' for a number of 
+  *                    instructions, 'p' for the byte address of an 
+  *                    instruction and 'c' for a number of cycle clear 
+  *                    instructions.
+  * @param[in] value Number of instructions, address or number of cycle
+  *                  clear instructions.
+  * @param[in] window Number of instructions of each window, 0 for the 
+  *                   rest of the program.
+  * @param[in] cyclestream File stream where to print the cycles of the
+  *                        regions, 0 for no output.
+  */
+static void simulateWindows(gen_simulator_t* simulator, sim_context_t* context,
+	char trigger, uint64_t value, uint32_t window, FILE* cyclestream) {
+
+	uint64_t remaining;
+	uint32_t steps;
+	int reason;
+
+	if (trigger == 'p' && simulator->setBreakpoint(context, (uint32_t) value, 1)) {
+		simulator->cleanUp(context);
+		simerror("Fast-forward address is outside of the instructions!");
+	}
+
+	do {
+		/* functional execution up to the trigger */
+		reason = RUN_STEPS;
+		switch (trigger) {
+			case 'i':
+				for (remaining = value; remaining && reason == RUN_STEPS; remaining -= steps) {
+					steps = (remaining > UINT32_MAX) ? UINT32_MAX : (uint32_t) remaining;
+					reason = simulator->fastForward(context, steps, 0);
+				}
+				break;
+			case 'p':
+				reason = simulator->fastForward(context, 0, RUN_BREAKPOINT);
+				break;
+			case 'c':
+				for (remaining = value; remaining && reason != RUN_EXIT; remaining--) {
+					reason = simulator->fastForward(context, 0, RUN_CYCLE_CLEAR);
+				}
+				break;
+		}
+		if (reason == RUN_EXIT) {
+			break;
+		}
+
+		/* detailed simulation of the window */
+		reason = simulator->run(context, cyclestream, window, 0);
+	} while (window && reason != RUN_EXIT);
+}
+
+/**
+  * @brief Saves the cycles of the region closed by a cycle print 
+  *        instruction, if there is a new one.
+  * @param[in,out] run The simulation of the target.
+  */
+static void recordRegion(target_run_t* run) {
+
+	run->simulator.getResults(run->context, &(run->results));
+	if (run->results.regions == run->num_regions) {
+		return;
+	}
+
+	if (run->num_regions == run->max_regions) {
+		run->max_regions = run->max_regions ? 2*run->max_regions : 64;
+		run->region_cycles = realloc(run->region_cycles, run->max_regions*sizeof(uint64_t));
+		if (!run->region_cycles) {
+			simerror("Could not allocate memory for region cycles!");
+		}
+	}
+	run->region_cycles[(run->num_regions)++] = run->results.region_cycles;
+}
+
+/**
+  * @brief Simulates the binary of one target, the main function of 
+  *        the threads comparing all targets. Errors are recorded in 
+  *        the simulation and reported by the main thread.
+  * @param[in,out] arg The simulation of the target.
+  * @return Always 0.
+  */
+static void* runTarget(void* arg) {
+
+	target_run_t* run = arg;
+	gen_simulator_t* simulator = &(run->simulator);
+	FILE* volatile nullstream = 0;
+
+	current_run = run;
+
+	if (sigsetjmp(run_error, 1)) {
+		current_run = 0;
+		if (nullstream) {
+			fclose(nullstream);
+		}
+		return 0;
+	}
+
+	/* output of cycle print instructions is collected instead */
+	nullstream = fopen("/dev/null", "w");
+	if (!nullstream) {
+		simerror("Could not open /dev/null for writing!");
+	}
+
+	simulator->readFileHeader(run->context, run->instream);
+	if ((simulator->checkTargetID(run->context))) {
+		simerror("Target ID not supported by current simulator!");
+	}
+	simulator->readMemory(run->context, run->instream);
+	simulator->readInstructions(run->context, run->instream);
+	simulator->resetSimulator(run->context);
+	if (run->timingfile) {
+		readTiming(simulator, run->context, run->timingfile);
+	}
+	run->number_instructions = simulator->getNumberOfInstructions(run->context);
+
+	/* simulate until the end, stopping after each cycle print */
+	if (run->reference) {
+		while (simulator->simulateStep(run->context, nullstream)) {
+			recordRegion(run);
+		}
+	} else {
+		simulator->setJITMode(run->context, run->jit_mode);
+		while (simulator->run(run->context, nullstream, 0, RUN_CYCLE_PRINT) != RUN_EXIT) {
+			recordRegion(run);
+		}
+	}
+	recordRegion(run);
+
+	current_run = 0;
+	fclose(nullstream);
+	return 0;
+}
+
+/**
+  * @brief Simulates the binaries of all targets concurrently and prints
+  *        a table of their results side by side. Targets without binary
+  *        are left out.
+  * @param[in] binfile Path of the binaries, "%t" is replaced by the 
+  *                    name of each target.
+  * @param[in] reference Use the reference step-by-step interpreter.
+  * @param[in] jit_mode Mode of the just-in-time compiler.
+  * @param[in] timingfile Path of a timing model file, 0 for the default.
+  */
+static void compareTargets(const char* binfile, int reference, int jit_mode, 
+	const char* timingfile) {
+
+	target_run_t runs[NUM_TARGETS];
+	char path[FILENAME_MAX];
+	const char* placeholder = strstr(binfile, "%t");
+	uint32_t max_regions = 0;
+	uint64_t branches = 0;
+	uint32_t i;
+	int num_runs = 0;
+	int failed = 0;
+	int base = -1;
+	int j;
+
+	if (!placeholder) {
+		simerror("The binfile has to contain \"%t\" for target \"all\"!");
+	}
+
+	/* open the binaries of all targets */
+	for (j = 0; j < NUM_TARGETS; j++) {
+		snprintf(path, FILENAME_MAX, "%.*s%s%s", (int) (placeholder - binfile), binfile,
+			target_names[j], placeholder + 2);
+		memset(&(runs[num_runs]), 0, sizeof(target_run_t));
+		runs[num_runs].instream = fopen(path, "r");
+		if (!runs[num_runs].instream) {
+			continue;
+		}
+		runs[num_runs].sim_lib = j;
+		runs[num_runs].reference = reference;
+		runs[num_runs].jit_mode = jit_mode;
+		runs[num_runs].timingfile = timingfile;
+		loadTarget(j, &(runs[num_runs].simulator));
+		runs[num_runs].context = gen_simulator_create_context(&(runs[num_runs].simulator));
+		if (!runs[num_runs].context) {
+			simerror("Could not allocate memory for simulator context!");
+		}
+		num_runs++;
+	}
+	if (!num_runs) {
+		simerror("Could not open the binary of any target!");
+	}
+
+	for (j = 0; j < num_runs; j++) {
+		if (pthread_create(&(runs[j].thread), 0, runTarget, &(runs[j]))) {
+			simerror("Could not create thread!");
+		}
+	}
+	for (j = 0; j < num_runs; j++) {
+		pthread_join(runs[j].thread, 0);
+		fclose(runs[j].instream);
+		if (runs[j].sim_lib == 0) {
+			base = j;
+		}
+		if (runs[j].num_regions > max_regions) {
+			max_regions = runs[j].num_regions;
+		}
+		if (runs[j].failed) {
+			fprintf(stderr, "%s: Target %s failed: %s\n", progname, 
+				target_names[runs[j].sim_lib], runs[j].error);
+			failed = 1;
+		}
+	}
+
+	/* all threads have finished, so the error terminates the program */
+	if (failed) {
+		for (j = 0; j < num_runs; j++) {
+			gen_simulator_destroy_context(runs[j].context);
+			free(runs[j].region_cycles);
+		}
+		simerror("Could not simulate all targets!");
+	}
+
+	/* print the table, one column per target */
+	fprintf(outstream, "Comparison of all targets for %s:\n\n%-14s", binfile, "");
+	for (j = 0; j < num_runs; j++) {
+		fprintf(outstream, "%*s", COMPARE_COLUMN_WIDTH, target_names[runs[j].sim_lib]);
+	}
+	fprintf(outstream, "\n%-14s", "Return value");
+	for (j = 0; j < num_runs; j++) {
+		fprintf(outstream, "%*s0x%08x", COMPARE_COLUMN_WIDTH - 10, "", runs[j].results.return_value);
+	}
+	fprintf(outstream, "\n%-14s", "Instructions");
+	for (j = 0; j < num_runs; j++) {
+		fprintf(outstream, "%*u", COMPARE_COLUMN_WIDTH, runs[j].number_instructions);
+	}
+	fprintf(outstream, "\n%-14s", "Executed");
+	for (j = 0; j < num_runs; j++) {
+		fprintf(outstream, "%*llu", COMPARE_COLUMN_WIDTH, (unsigned long long) runs[j].results.instructions);
+	}
+	/* branches are only counted by a branch predictor */
+	for (j = 0; j < num_runs; j++) {
+		branches += runs[j].results.branches.branches;
+	}
+	if (branches) {
+		fprintf(outstream, "\n%-14s", "Branches");
+		for (j = 0; j < num_runs; j++) {
+			fprintf(outstream, "%*llu", COMPARE_COLUMN_WIDTH, 
+				(unsigned long long) runs[j].results.branches.branches);
+		}
+		fprintf(outstream, "\n%-14s", "Mispredicted");
+		for (j = 0; j < num_runs; j++) {
+			fprintf(outstream, "%*llu", COMPARE_COLUMN_WIDTH, 
+				(unsigned long long) runs[j].results.branches.mispredictions);
+		}
+	}
+	fprintf(outstream, "\n%-14s", "Cycles");
+	for (j = 0; j < num_runs; j++) {
+		fprintf(outstream, "%*llu", COMPARE_COLUMN_WIDTH, (unsigned long long) runs[j].results.cycles);
+	}
+	/* speedup relative to plain v8 */
+	if (base != -1) {
+		fprintf(outstream, "\n%-14s", "Speedup");
+		for (j = 0; j < num_runs; j++) {
+			fprintf(outstream, "%*.3f", COMPARE_COLUMN_WIDTH, 
+				runs[j].results.cycles ? (double) runs[base].results.cycles / runs[j].results.cycles : 0.0);
+		}
+	}
+	for (i = 0; i < max_regions; i++) {
+		fprintf(outstream, "\nRegion %-7u", i + 1);
+		for (j = 0; j < num_runs; j++) {
+			if (i < runs[j].num_regions) {
+				fprintf(outstream, "%*llu", COMPARE_COLUMN_WIDTH, (unsigned long long) runs[j].region_cycles[i]);
+			} else {
+				fprintf(outstream, "%*s", COMPARE_COLUMN_WIDTH, "-");
+			}
+		}
+	}
+	fprintf(outstream, "\n");
+
+	/* clean up memory */
+	for (j = 0; j < num_runs; j++) {
+		gen_simulator_destroy_context(runs[j].context);
+		free(runs[j].region_cycles);
+	}
+}
+
+int main(int argc, char** argv) {
+
 	/* pointer to simulator object */
 	gen_simulator_t* simulator;
-
-	/* paths to all supported targets */
-	const char* sim_libraries[] = { 
-		"shared/libsim_sparc_v8.so",
-		"shared/libsim_sparc_v8-blockicc-movcc.so",
-		"shared/libsim_sparc_v8-blockpreg-selcc.so",
-		"shared/libsim_sparc_v8-blockicc-selcc.so"
-	};
+	/* context of the simulated binary */
+	sim_context_t* context;
 
 	/* save which target is selected,
 	 * currently undefined */
 	int sim_lib = -1;
+	/* binary file, opened after all options are known */
+	char* binfile = 0;
+	/* trigger and window of the fast-forward mode, default = off */
+	char trigger = 0;
+	uint64_t trigger_value = 0;
+	uint32_t window = 0;
+	/* interval, clusters and samples of the sampled simulation, 
+	   default = off */
+	uint32_t sampling_interval = 0;
+	uint32_t sampling_clusters = SAMPLING_MAX_CLUSTERS;
+	uint32_t sampling_samples = SAMPLING_SAMPLES;
+	char* end;
 	/* return status of getopt() */
 	int opt;
+	static const struct option long_options[] = {
+		{ "cycle-stats", no_argument, 0, 'C' },
+		{ "profile", no_argument, 0, 'p' },
+		{ "call-stacks", required_argument, 0, 'c' },
+		{ 0, 0, 0, 0 }
+	};
 
 	/* saving silent status of simulator, default = not silent */
 	int silent = 0;
-/* 	int i; */
+	/* saving whether the reference interpreter shall be used, 
+	   default = threaded code engine */
+	int reference = 0;
+	/* saving the mode of the just-in-time compiler, default = off */
+	int jit_mode = JIT_MODE_OFF;
+	/* saving whether the regions are summarized instead of printing 
+	   their cycles, default = print */
+	int region_table = 0;
+	/* saving whether the region table contains percentiles, default = no */
+	int cycle_stats = 0;
+	/* saving whether the branch statistics are printed, default = no */
+	int branch_table = 0;
+	/* saving whether the program is profiled, default = no */
+	int profile = 0;
+	/* folded stacks file and function map file, default = no call tracing */
+	FILE* stackstream = 0;
+	char* mapfile = 0;
+	FILE* cyclestream;
+	/* snapshot files to save the initial state to and to start from */
+	char* save_snapshot_file = 0;
+	char* load_snapshot_file = 0;
+	/* timing model file, default = cycles of sparc_target.h */
+	char* timingfile = 0;
+	FILE* snapshot_stream;
+	sim_snapshot_t* snapshot;
 
 	/* make program name globally available */
 	progname = argv[0];
@@ -116,7 +607,7 @@ int main(int argc, char** argv) {
 	outstream = stdout;
 
 	/* parse input options */
-	while ((opt = getopt(argc, argv, "ht:i:o:s")) != -1) {
+	while ((opt = getopt_long(argc, argv, "ht:i:o:srjdM:RCBpc:m:S:L:F:W:P:", long_options, 0)) != -1) {
 		switch (opt) {
 			case 't':
 				if (!(strcmp(optarg, "v8"))) {
@@ -127,14 +618,12 @@ int main(int argc, char** argv) {
 					sim_lib = 2;
 				} else if (!(strcmp(optarg, "v8-blockicc-selcc"))) {
 					sim_lib = 3;
+				} else if (!(strcmp(optarg, "all"))) {
+					sim_lib = SIM_LIB_ALL;
 				}
 				break;
 			case 'i':
-				instream = fopen(optarg, "r");
-				if (instream == NULL) {
-					fprintf(stderr, "%s: Could not open file \"%s\" for reading!\n", progname, optarg);
-					exit(EXIT_FAILURE);
-				}
+				binfile = optarg;
 				break;
 			case 'o':
 				outstream = fopen(optarg, "w");
@@ -149,6 +638,76 @@ int main(int argc, char** argv) {
 			case 's':
 				silent = 1;
 				break;
+			case 'r':
+				reference = 1;
+				break;
+			case 'j':
+				jit_mode = JIT_MODE_ON;
+				break;
+			case 'd':
+				jit_mode = JIT_MODE_CHECK;
+				break;
+			case 'M':
+				timingfile = optarg;
+				break;
+			case 'R':
+				region_table = 1;
+				break;
+			case 'C':
+				region_table = 1;
+				cycle_stats = 1;
+				break;
+			case 'B':
+				branch_table = 1;
+				break;
+			case 'p':
+				profile = 1;
+				break;
+			case 'c':
+				stackstream = fopen(optarg, "w");
+				if (stackstream == NULL) {
+					fprintf(stderr, "%s: Could not open file \"%s\" for writing!\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'm':
+				mapfile = optarg;
+				break;
+			case 'S':
+				save_snapshot_file = optarg;
+				break;
+			case 'L':
+				load_snapshot_file = optarg;
+				break;
+			case 'F':
+				trigger = optarg[0];
+				trigger_value = strtoull(optarg + 1, &end, 0);
+				if ((trigger != 'i' && trigger != 'p' && trigger != 'c') || 
+					optarg[1] == '\0' || *end != '\0') {
+					fprintf(stderr, "%s: Invalid fast-forward trigger \"%s\".\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'P':
+				sampling_interval = (uint32_t) strtoul(optarg, &end, 0);
+				if (*end == ':') {
+					sampling_clusters = (uint32_t) strtoul(end + 1, &end, 0);
+				}
+				if (*end == ':') {
+					sampling_samples = (uint32_t) strtoul(end + 1, &end, 0);
+				}
+				if (!sampling_interval || !sampling_clusters || !sampling_samples || *end != '\0') {
+					fprintf(stderr, "%s: Invalid sampling \"%s\".\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'W':
+				window = (uint32_t) strtoul(optarg, &end, 0);
+				if (optarg[0] == '\0' || *end != '\0') {
+					fprintf(stderr, "%s: Invalid window \"%s\".\n", progname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
 			default:
 				fprintf(stderr, "%s: Unknown option \"-%c\".\n", progname, opt);
 				exit(EXIT_FAILURE);
@@ -164,99 +723,220 @@ int main(int argc, char** argv) {
 			"\tv8-blockpreg-selcc - Original Sparc-V8 target with conditional select, "
 			"predicated blocks on predicate registers and hardware loops.\n" 
 			"\tv8-blockicc-selcc  - Original Sparc-V8 target with conditional select, "
-			"predicated blocks on condition codes and hardware loops.\n\n", 
+			"predicated blocks on condition codes and hardware loops.\n"
+			"\tall                - Comparison of all targets.\n\n", 
 			progname);
 		exit(EXIT_FAILURE);
 	}
 
-	/* allocate memory for assembler struct */
-	simulator = malloc(sizeof(gen_simulator_t));
-	if (!simulator) {
-		simerror("%s: Could not allocate memory for generic simulator!");
+	if ((trigger || sampling_interval) && reference) {
+		fprintf(stderr, "%s: Fast-forwarding and sampling are not supported by the "
+			"reference interpreter.\n", progname);
+		exit(EXIT_FAILURE);
 	}
-
-	/* open shared library */
-	lib_handle = dlopen(sim_libraries[sim_lib], RTLD_LAZY);
-    if (!lib_handle) 
-    {  
-		free(simulator); 
-        fprintf(stderr, "%s\n", dlerror());
+	if (trigger && sampling_interval) {
+		fprintf(stderr, "%s: Fast-forwarding and sampling cannot be combined.\n", progname);
 		exit(EXIT_FAILURE);
-    }   
-    
-	/* get assembler init function */
-    *(void **) (&init_fct) = dlsym(lib_handle, "simulator_init");
-    if ((dl_error = dlerror()) != NULL)  
-    {   
-        dlclose(lib_handle);
-		free(simulator);
-        fprintf(stderr, "%s: %s\n", progname, dl_error);
-        fprintf(stderr, "%s: Error when opening shared library %s!\n", progname, sim_libraries[sim_lib]);
+	}
+	if ((profile || stackstream) && sampling_interval) {
+		fprintf(stderr, "%s: Profiling and sampling cannot be combined.\n", progname);
 		exit(EXIT_FAILURE);
-    }
+	}
 
-	/* let assembler register its target specific functions */
-	if (init_fct(simulator, simerror)) {
-		free(simulator);
-		simerror("Could not initialize target specific simulator correctly!");
+	/* compare all targets, each with its own binary */
+	if (sim_lib == SIM_LIB_ALL) {
+		if (!binfile || save_snapshot_file || load_snapshot_file || trigger || sampling_interval ||
+			profile || stackstream) {
+			fprintf(stderr, "%s: Target \"all\" needs a binfile and does not support "
+				"snapshots, fast-forwarding, sampling and profiling.\n", progname);
+			exit(EXIT_FAILURE);
+		}
+		instream = 0;
+		compareTargets(binfile, reference, jit_mode, timingfile);
+		if (outstream != stdout) {
+			fclose(outstream);
+		}
+		for (sim_lib = 0; sim_lib < NUM_TARGETS; sim_lib++) {
+			if (lib_handles[sim_lib] && dlclose(lib_handles[sim_lib])) {
+				fprintf(stderr, "%s: Could not close shared library!",
+					progname);
+				exit(EXIT_FAILURE);
+			}
+		}
+		exit(EXIT_SUCCESS);
 	}
 
-	/* let assembler register its target specific functions */
-	if (gen_simulator_init(simulator, simerror)) {
+	if (binfile) {
+		instream = fopen(binfile, "r");
+		if (instream == NULL) {
+			fprintf(stderr, "%s: Could not open file \"%s\" for reading!\n", progname, binfile);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	/* allocate memory for assembler struct */
+	simulator = malloc(sizeof(gen_simulator_t));
+	if (!simulator) {
+		simerror("Could not allocate memory for generic simulator!");
+	}
+
+	/* open shared library and let simulator register its functions */
+	loadTarget(sim_lib, simulator);
+
+	/* create context for the simulation */
+	context = gen_simulator_create_context(simulator);
+	if (!context) {
 		free(simulator);
-		simerror("Could not initialize generic simulator correctly!");
+		simerror("Could not allocate memory for simulator context!");
 	}
 
 	/* read file header */
-	simulator->readFileHeader(instream);
+	simulator->readFileHeader(context, instream);
 
 	/* check target ID */
-	if ((simulator->checkTargetID())) {
-		simulator->cleanUp();
+	if ((simulator->checkTargetID(context))) {
+		simulator->cleanUp(context);
 		free(simulator);
 		simerror("Target ID not supported by current simulator!");
 	}
 
 	/* read memory */
-	simulator->readMemory(instream);
+	simulator->readMemory(context, instream);
 
 	/* read instructions */
-	simulator->readInstructions(instream);
+	simulator->readInstructions(context, instream);
 
 	/* initialize all registers */
-	simulator->resetSimulator();
+	simulator->resetSimulator(context);
+
+	/* read the timing model before the first simulation */
+	if (timingfile) {
+		readTiming(simulator, context, timingfile);
+	}
+
+	/* compiled blocks do not access the models of the timing model */
+	if (jit_mode != JIT_MODE_OFF && !reference && simulator->hasModels(context)) {
+		simulator->cleanUp(context);
+		free(simulator);
+		simerror("The just-in-time compiler ('-j'/'-d') cannot be combined with cache, "
+			"predictor and pipeline models!");
+	}
+
+	/* name the functions of the call stacks */
+	if (mapfile) {
+		readMap(simulator, context, mapfile);
+	}
+
+	/* continue from a saved state */
+	if (load_snapshot_file) {
+		snapshot_stream = fopen(load_snapshot_file, "rb");
+		snapshot = snapshot_stream ? simulator->readSnapshot(context, snapshot_stream) : 0;
+		if (snapshot_stream) {
+			fclose(snapshot_stream);
+		}
+		if (!snapshot) {
+			simulator->cleanUp(context);
+			free(simulator);
+			simerror("Could not read snapshot!");
+		}
+		simulator->restoreSnapshot(context, snapshot);
+		simulator->freeSnapshot(snapshot);
+	}
+
+	/* save the initial state */
+	if (save_snapshot_file) {
+		snapshot = simulator->saveSnapshot(context);
+		snapshot_stream = fopen(save_snapshot_file, "wb");
+		if (!snapshot_stream || simulator->writeSnapshot(snapshot, snapshot_stream)) {
+			if (snapshot_stream) {
+				fclose(snapshot_stream);
+			}
+			simulator->freeSnapshot(snapshot);
+			simulator->cleanUp(context);
+			free(simulator);
+			simerror("Could not write snapshot!");
+		}
+		fclose(snapshot_stream);
+		simulator->freeSnapshot(snapshot);
+	}
 
 	/* print out instructions */
-	simulator->printInstructions(outstream);
+	simulator->printInstructions(context, outstream);
 
 	/* print out memory contents */
 	if (!silent) {
-		simulator->printMemory(outstream);
+		simulator->printMemory(context, outstream);
 	}
 
 	/* print out register contents */
-	/* simulator->printRegisters(outstream);*/
+	/* simulator->printRegisters(context, outstream);*/
+
+	/* the cycles of the regions are printed as they are closed, 
+	   unless they are summarized */
+	cyclestream = region_table ? 0 : outstream;
+	simulator->setCycleStatistics(context, cycle_stats);
+	simulator->setProfiling(context, profile);
+	simulator->setCallTracing(context, stackstream != 0);
 
 	/* simulate steps as long as possible */
-	while(simulator->simulateStep(outstream));
+	if (reference) {
+		while(simulator->simulateStep(context, cyclestream));
+	} else if (trigger) {
+		simulator->setJITMode(context, jit_mode);
+		simulateWindows(simulator, context, trigger, trigger_value, window, cyclestream);
+	} else if (sampling_interval) {
+		if (simulateSampled(simulator, context, outstream, jit_mode, sampling_interval,
+			sampling_clusters, sampling_samples)) {
+			simulator->cleanUp(context);
+			free(simulator);
+			simerror("Could not allocate memory for sampled simulation!");
+		}
+	} else {
+		simulator->setJITMode(context, jit_mode);
+		simulator->run(context, cyclestream, 0, 0);
+	}
 
 	fprintf(outstream, "\nFinished simulation...\n");
 
 	/* print out register contents */
 	if (!silent) {
-		simulator->printRegisters(outstream);
+		simulator->printRegisters(context, outstream);
 	}
 
 	/* print out memory contents */
 	if (!silent) {
-		simulator->printMemory(outstream);
+		simulator->printMemory(context, outstream);
 	}
 
-	/* print results of simulation */
-	simulator->printResults(outstream);
+	/* print the accumulated regions */
+	if (region_table) {
+		simulator->printRegions(context, outstream);
+	}
+
+	/* print the statistics of each branch */
+	if (branch_table) {
+		simulator->printBranches(context, outstream);
+	}
+
+	/* print the hotspots of the profile */
+	if (profile) {
+		simulator->printProfile(context, outstream);
+	}
+
+	/* print the functions and write their call stacks */
+	if (stackstream) {
+		simulator->printFunctions(context, outstream);
+		simulator->writeCallStacks(context, stackstream);
+		fclose(stackstream);
+	}
+
+	/* print results of simulation, the sampled simulation printed its estimation */
+	if (!sampling_interval) {
+		simulator->printResults(context, outstream);
+	}
 
 	/* clean up memory */
-	simulator->cleanUp();
+	gen_simulator_destroy_context(context);
 
 	/* free memory of assembler data structure */
 	free(simulator);
@@ -270,7 +950,7 @@ int main(int argc, char** argv) {
 	}
 
 	/* close library handle */
-	if (dlclose(lib_handle)) {
+	if (dlclose(lib_handles[sim_lib])) {
 		fprintf(stderr, "%s: Could not close shared library!",
 			progname);
 		exit(EXIT_FAILURE);
@@ -0,0 +1,195 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/sim_pipeline.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparc_target.h"
+#include "sparc.tab.h"
+#include "sim_pipeline.h"
+
+/**
+  * @brief Collects the interlock information of an instruction. Loads 
+  *        deliver their result after the memory stage, all other results
+  *        are forwarded. Conditional branches and predicated blocks 
+  *        evaluate their condition before execute, while conditional 
+  *        moves, selects and predicate sets evaluate it in execute. The
+  *        end of a hardware loop branches back without a stall.
+  * @param[in] instruction The instruction.
+  * @param[out] info The interlock information.
+  */
+static void collectInfo(const sparc_instruction* instruction, pipeline_info_t* info) {
+
+	const sparc_operand* operands = instruction->operands;
+	uint32_t i;
+	uint32_t first = 1;
+	uint32_t reads = 0;
+
+	memset(info, 0, sizeof(pipeline_info_t));
+
+	switch (instruction->opcode) {
+		case LDSB:
+		case LDSH:
+		case LDUB:
+		case LDUH:
+		case LD:
+		case LDSBA:
+		case LDSHA:
+		case LDUBA:
+		case LDUHA:
+		case LDA:
+			info->load_rd = (uint8_t) operands[0].value.reg;
+			info->load_count = 1;
+			break;
+		case LDD:
+		case LDDA:
+			info->load_rd = (uint8_t) operands[0].value.reg;
+			info->load_count = 2;
+			break;
+		/* stores read their data register */
+		case STB:
+		case STH:
+		case ST:
+		case STD:
+		case STBA:
+		case STHA:
+		case STA:
+		case STDA:
+			info->store = 1;
+			first = 0;
+			break;
+		case ANDCC:
+		case ANDNCC:
+		case ORCC:
+		case ORNCC:
+		case XORCC:
+		case XNORCC:
+		case ADDCC:
+		case ADDXCC:
+		case TADDCC:
+		case TADDCCTV:
+		case SUBCC:
+		case SUBXCC:
+		case TSUBCC:
+		case TSUBCCTV:
+		case MULSCC:
+		case UMULCC:
+		case SMULCC:
+		case UDIVCC:
+		case SDIVCC:
+			info->sets = PIPELINE_FLAG_ICC;
+			break;
+		case PREDSET:
+		case PREDCLEAR:
+			info->sets = PIPELINE_FLAG_PREG;
+			break;
+		case BRANCH:
+			if (operands[1].value.icc != CC_A && operands[1].value.icc != CC_N) {
+				info->reads_early = PIPELINE_FLAG_ICC;
+			}
+			break;
+		case PREDBEGIN:
+			info->reads_early = (operands[0].type == OPERAND_TYPE_ICC) ? 
+				PIPELINE_FLAG_ICC : PIPELINE_FLAG_PREG;
+			break;
+		case JUMPL:
+			info->jump = 1;
+			break;
+		/* special registers are not forwarded from loads */
+		case RD:
+			return;
+		default:
+			break;
+	}
+
+	for (i = first; i < instruction->num_operands && reads < 3; i++) {
+		if (operands[i].type == OPERAND_TYPE_REGISTER && operands[i].value.reg != G_REGISTER) {
+			info->reads[reads++] = (uint8_t) operands[i].value.reg;
+		}
+	}
+
+	/* a load into %g0 has no result */
+	if (info->load_rd == G_REGISTER) {
+		info->load_count = 0;
+	}
+}
+
+/**
+  * @brief Builds the interlock information of all instructions, unless
+  *        it has already been built.
+  * @param[in,out] pipeline The pipeline.
+  * @param[in] instructions The instructions of the program.
+  * @param[in] number_instructions Number of instructions.
+  * @return 0 on success, 2 if there is not enough memory.
+  */
+int pipelineBuild(pipeline_t* pipeline, const sparc_instruction* instructions, 
+	uint32_t number_instructions) {
+
+	uint32_t i;
+
+	if (pipeline->info) {
+		return 0;
+	}
+	pipeline->info = malloc((number_instructions ? number_instructions : 1)*sizeof(pipeline_info_t));
+	if (!pipeline->info) {
+		return 2;
+	}
+	for (i = 0; i < number_instructions; i++) {
+		collectInfo(&(instructions[i]), &(pipeline->info[i]));
+	}
+
+	return 0;
+}
+
+/**
+  * @brief Starts with an empty pipeline and store buffer and clears the
+  *        statistics.
+  * @param[in,out] pipeline The pipeline.
+  */
+void pipelineReset(pipeline_t* pipeline) {
+	pipelineDrain(pipeline);
+	memset(&(pipeline->stats), 0, sizeof(pipeline->stats));
+}
+
+/**
+  * @brief Empties the pipeline and the store buffer, e.g. if the cycle 
+  *        counter is not continued.
+  * @param[in,out] pipeline The pipeline.
+  */
+void pipelineDrain(pipeline_t* pipeline) {
+	pipeline->last = PIPELINE_NONE;
+	memset(pipeline->store_done, 0, sizeof(pipeline->store_done));
+	pipeline->store_next = 0;
+}
+
+/**
+  * @brief Frees the interlock information, the parameters are kept.
+  * @param[in,out] pipeline The pipeline.
+  */
+void pipelineFree(pipeline_t* pipeline) {
+	free(pipeline->info);
+	pipeline->info = 0;
+}
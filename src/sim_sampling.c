@@ -0,0 +1,706 @@
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: src/sim_sampling.c
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "sim_sampling.h"
+
+/** Dimensions of the randomly projected basic block vectors */
+#define SAMPLING_DIMENSIONS		15
+/** Maximum number of iterations of k-means */
+#define SAMPLING_MAX_ITERATIONS	100
+/** Fraction of the range of BIC scores the chosen clustering reaches */
+#define SAMPLING_BIC_THRESHOLD	0.9
+/** Quantile of the normal distribution for a 95% confidence interval */
+#define SAMPLING_CONFIDENCE_Z	1.96
+
+/** Interval of instructions of the functional pass */
+typedef struct {
+	/* projected basic block vector, normalized to the instructions */
+	double					bbv[SAMPLING_DIMENSIONS];
+	/* executed instructions, only the last interval may be shorter */
+	uint32_t				instructions;
+	/* cluster of similar intervals */
+	uint32_t				cluster;
+	/* state at the start of the warm-up of a sampled interval */
+	sim_snapshot_t*			checkpoint;
+	/* instructions between the checkpoint and the sampled interval */
+	uint32_t				warmup;
+	/* cycles of a sampled interval */
+	uint64_t				cycles;
+} sampling_interval_t;
+
+/** Sampled intervals, which are simulated from their checkpoints */
+typedef struct {
+	gen_simulator_t*		simulator;
+	sim_context_t*			program;
+	int						jit_mode;
+	sampling_interval_t*	intervals;
+	uint32_t*				samples;
+	uint32_t				num_samples;
+	/* next sample to be simulated */
+	uint32_t				next;
+	/* a context could not be allocated */
+	int						failed;
+	pthread_mutex_t			lock;
+} sampling_work_t;
+
+/**
+  * @brief Returns an element of the random projection matrix, the same
+  *        for every run.
+  * @param[in] pc Word address of the first instruction of a block.
+  * @param[in] dimension Dimension of the projected vector.
+  * @return Element in [-1, 1).
+  */
+static double projection(uint32_t pc, uint32_t dimension) {
+
+	/* splitmix64 of the position in the matrix */
+	uint64_t x = (uint64_t) pc*SAMPLING_DIMENSIONS + dimension + 0x9e3779b97f4a7c15ULL;
+
+	x = (x ^ (x >> 30))*0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27))*0x94d049bb133111ebULL;
+	x = x ^ (x >> 31);
+
+	return (double) (x >> 11)*(2.0/9007199254740992.0) - 1.0;
+}
+
+/**
+  * @brief Executes the whole program functionally and saves the 
+  *        projected basic block vector of every interval.
+  * @param[in] simulator The generic simulator data structure.
+  * @param[in,out] context The simulator context, at the start of the 
+  *                        program.
+  * @param[in] interval Number of instructions of an interval.
+  * @param[out] num_intervals Number of intervals.
+  * @return The intervals, or 0 if memory could not be allocated.
+  */
+static sampling_interval_t* collectIntervals(gen_simulator_t* simulator, sim_context_t* context,
+	uint32_t interval, uint32_t* num_intervals) {
+
+	uint32_t number_instructions = simulator->getNumberOfInstructions(context);
+	uint32_t* counts = calloc(number_instructions, sizeof(uint32_t));
+	double* matrix = malloc(number_instructions*SAMPLING_DIMENSIONS*sizeof(double));
+	sampling_interval_t* intervals = 0;
+	sampling_interval_t* current;
+	uint32_t max_intervals = 0;
+	uint32_t pc, i;
+	double weight;
+	int reason;
+
+	*num_intervals = 0;
+	if (!counts || !matrix) {
+		free(counts);
+		free(matrix);
+		return 0;
+	}
+	for (pc = 0; pc < number_instructions; pc++) {
+		for (i = 0; i < SAMPLING_DIMENSIONS; i++) {
+			matrix[pc*SAMPLING_DIMENSIONS + i] = projection(pc, i);
+		}
+	}
+
+	simulator->setBlockCounts(context, counts);
+	do {
+		reason = simulator->fastForward(context, interval, 0);
+
+		if (*num_intervals == max_intervals) {
+			max_intervals = max_intervals ? 2*max_intervals : 64;
+			current = realloc(intervals, max_intervals*sizeof(sampling_interval_t));
+			if (!current) {
+				free(intervals);
+				intervals = 0;
+				break;
+			}
+			intervals = current;
+		}
+		current = &(intervals[*num_intervals]);
+		memset(current, 0, sizeof(sampling_interval_t));
+
+		for (pc = 0; pc < number_instructions; pc++) {
+			current->instructions += counts[pc];
+		}
+		if (!current->instructions) {
+			break;
+		}
+		for (pc = 0; pc < number_instructions; pc++) {
+			if (counts[pc]) {
+				weight = (double) counts[pc]/current->instructions;
+				for (i = 0; i < SAMPLING_DIMENSIONS; i++) {
+					current->bbv[i] += weight*matrix[pc*SAMPLING_DIMENSIONS + i];
+				}
+				counts[pc] = 0;
+			}
+		}
+		(*num_intervals)++;
+	} while (reason != RUN_EXIT);
+	simulator->setBlockCounts(context, 0);
+
+	free(counts);
+	free(matrix);
+	return intervals;
+}
+
+/**
+  * @brief Returns the squared euclidean distance of two vectors.
+  * @param[in] a First vector.
+  * @param[in] b Second vector.
+  * @return The squared distance.
+  */
+static double squaredDistance(const double* a, const double* b) {
+
+	double distance = 0.0;
+	uint32_t i;
+
+	for (i = 0; i < SAMPLING_DIMENSIONS; i++) {
+		distance += (a[i] - b[i])*(a[i] - b[i]);
+	}
+	return distance;
+}
+
+/**
+  * @brief Clusters the intervals by k-means, starting from the intervals
+  *        which are furthest from each other.
+  * @param[in] intervals The intervals.
+  * @param[in] num_intervals Number of intervals.
+  * @param[in] k Number of clusters.
+  * @param[out] centers Centers of the clusters, k vectors.
+  * @param[out] assignment Cluster of each interval.
+  * @param[out] sizes Number of intervals of each cluster.
+  * @return Sum of the squared distances of all intervals to the center 
+  *         of their cluster.
+  */
+static double clusterIntervals(const sampling_interval_t* intervals, uint32_t num_intervals,
+	uint32_t k, double* centers, uint32_t* assignment, uint32_t* sizes) {
+
+	double distance, nearest, furthest;
+	double sse = 0.0;
+	uint32_t i, j, c, iteration;
+	uint32_t candidate = 0;
+	int changed = 1;
+
+	/* furthest first initialization */
+	memcpy(centers, intervals[0].bbv, sizeof(intervals[0].bbv));
+	for (c = 1; c < k; c++) {
+		furthest = -1.0;
+		for (i = 0; i < num_intervals; i++) {
+			nearest = squaredDistance(intervals[i].bbv, centers);
+			for (j = 1; j < c; j++) {
+				distance = squaredDistance(intervals[i].bbv, &(centers[j*SAMPLING_DIMENSIONS]));
+				if (distance < nearest) {
+					nearest = distance;
+				}
+			}
+			if (nearest > furthest) {
+				furthest = nearest;
+				candidate = i;
+			}
+		}
+		memcpy(&(centers[c*SAMPLING_DIMENSIONS]), intervals[candidate].bbv, sizeof(intervals[0].bbv));
+	}
+
+	for (i = 0; i < num_intervals; i++) {
+		assignment[i] = k;
+	}
+
+	for (iteration = 0; changed && iteration < SAMPLING_MAX_ITERATIONS; iteration++) {
+
+		/* assign every interval to the nearest center */
+		changed = 0;
+		sse = 0.0;
+		for (i = 0; i < num_intervals; i++) {
+			nearest = -1.0;
+			candidate = 0;
+			for (c = 0; c < k; c++) {
+				distance = squaredDistance(intervals[i].bbv, &(centers[c*SAMPLING_DIMENSIONS]));
+				if (nearest < 0.0 || distance < nearest) {
+					nearest = distance;
+					candidate = c;
+				}
+			}
+			if (assignment[i] != candidate) {
+				assignment[i] = candidate;
+				changed = 1;
+			}
+			sse += nearest;
+		}
+
+		/* move every center to the mean of its intervals, centers of 
+		   empty clusters stay */
+		memset(sizes, 0, k*sizeof(uint32_t));
+		for (i = 0; i < num_intervals; i++) {
+			sizes[assignment[i]]++;
+		}
+		for (c = 0; c < k; c++) {
+			if (sizes[c]) {
+				memset(&(centers[c*SAMPLING_DIMENSIONS]), 0, sizeof(intervals[0].bbv));
+			}
+		}
+		for (i = 0; i < num_intervals; i++) {
+			for (j = 0; j < SAMPLING_DIMENSIONS; j++) {
+				centers[assignment[i]*SAMPLING_DIMENSIONS + j] += intervals[i].bbv[j]/sizes[assignment[i]];
+			}
+		}
+	}
+
+	return sse;
+}
+
+/**
+  * @brief Returns the Bayesian information criterion of a clustering,
+  *        assuming spherical gaussian clusters of the same variance.
+  * @param[in] num_intervals Number of intervals.
+  * @param[in] k Number of clusters.
+  * @param[in] sizes Number of intervals of each cluster.
+  * @param[in] sse Sum of the squared distances to the centers.
+  * @return The score, higher is better.
+  */
+static double bicScore(uint32_t num_intervals, uint32_t k, const uint32_t* sizes, double sse) {
+
+	double variance;
+	double likelihood = 0.0;
+	double n = num_intervals;
+	uint32_t c;
+
+	variance = (num_intervals > k) ? sse/(SAMPLING_DIMENSIONS*(n - k)) : 0.0;
+	if (variance < 1e-12) {
+		variance = 1e-12;
+	}
+
+	for (c = 0; c < k; c++) {
+		if (sizes[c]) {
+			likelihood += sizes[c]*log(sizes[c]/n);
+		}
+	}
+	likelihood -= n*SAMPLING_DIMENSIONS/2.0*log(2.0*M_PI*variance);
+	likelihood -= SAMPLING_DIMENSIONS*(n - k)/2.0;
+
+	return likelihood - k*(SAMPLING_DIMENSIONS + 1)/2.0*log(n);
+}
+
+/**
+  * @brief Clusters the intervals for all numbers of clusters up to the
+  *        maximum and keeps the smallest one which reaches 90% of the 
+  *        range of BIC scores (as SimPoint does).
+  * @param[in,out] intervals The intervals, their clusters are set.
+  * @param[in] num_intervals Number of intervals.
+  * @param[in] max_clusters Maximum number of clusters.
+  * @return The number of clusters, 0 if memory could not be allocated.
+  */
+static uint32_t chooseClusters(sampling_interval_t* intervals, uint32_t num_intervals,
+	uint32_t max_clusters) {
+
+	double* centers;
+	double* scores;
+	uint32_t* assignments;
+	uint32_t* sizes;
+	double sse, lowest, highest;
+	uint32_t i, k;
+	uint32_t chosen = 0;
+
+	if (max_clusters > num_intervals) {
+		max_clusters = num_intervals;
+	}
+
+	centers = malloc(max_clusters*SAMPLING_DIMENSIONS*sizeof(double));
+	scores = malloc(max_clusters*sizeof(double));
+	assignments = malloc(max_clusters*num_intervals*sizeof(uint32_t));
+	sizes = malloc(max_clusters*sizeof(uint32_t));
+	if (!centers || !scores || !assignments || !sizes) {
+		goto leave;
+	}
+
+	for (k = 1; k <= max_clusters; k++) {
+		sse = clusterIntervals(intervals, num_intervals, k, centers, 
+			&(assignments[(k - 1)*num_intervals]), sizes);
+		scores[k - 1] = bicScore(num_intervals, k, sizes, sse);
+	}
+
+	lowest = highest = scores[0];
+	for (k = 1; k < max_clusters; k++) {
+		if (scores[k] < lowest) {
+			lowest = scores[k];
+		}
+		if (scores[k] > highest) {
+			highest = scores[k];
+		}
+	}
+	for (chosen = 1; chosen < max_clusters; chosen++) {
+		if (scores[chosen - 1] >= lowest + SAMPLING_BIC_THRESHOLD*(highest - lowest)) {
+			break;
+		}
+	}
+
+	for (i = 0; i < num_intervals; i++) {
+		intervals[i].cluster = assignments[(chosen - 1)*num_intervals + i];
+	}
+
+leave:
+	free(centers);
+	free(scores);
+	free(assignments);
+	free(sizes);
+	return chosen;
+}
+
+/**
+  * @brief Comparison function of qsort() for interval indices.
+  * @param[in] a First index.
+  * @param[in] b Second index.
+  * @return Difference of the indices.
+  */
+static int compareIndices(const void* a, const void* b) {
+	uint32_t x = *(const uint32_t*) a;
+	uint32_t y = *(const uint32_t*) b;
+	return (x > y) - (x < y);
+}
+
+/**
+  * @brief Selects the intervals to be simulated with cycles: the interval
+  *        nearest to the center of each cluster, and further intervals 
+  *        of the cluster chosen at random, which allow to estimate the 
+  *        variance within the cluster.
+  * @param[in] intervals The clustered intervals.
+  * @param[in] num_intervals Number of intervals.
+  * @param[in] k Number of clusters.
+  * @param[in] samples Number of intervals per cluster.
+  * @param[out] num_samples Number of selected intervals.
+  * @return The indices of the selected intervals in ascending order, or
+  *         0 if memory could not be allocated.
+  */
+static uint32_t* selectSamples(const sampling_interval_t* intervals, uint32_t num_intervals,
+	uint32_t k, uint32_t samples, uint32_t* num_samples) {
+
+	uint32_t* selected = malloc(num_intervals*sizeof(uint32_t));
+	uint32_t* members = malloc(num_intervals*sizeof(uint32_t));
+	double center[SAMPLING_DIMENSIONS];
+	double distance, nearest;
+	uint32_t num_members, representative;
+	uint32_t c, i, j, swap;
+	/* fixed seed, such that every run simulates the same intervals */
+	uint32_t seed = 1;
+
+	*num_samples = 0;
+	if (!selected || !members) {
+		free(selected);
+		free(members);
+		return 0;
+	}
+
+	for (c = 0; c < k; c++) {
+
+		num_members = 0;
+		memset(center, 0, sizeof(center));
+		for (i = 0; i < num_intervals; i++) {
+			if (intervals[i].cluster == c) {
+				members[num_members++] = i;
+				for (j = 0; j < SAMPLING_DIMENSIONS; j++) {
+					center[j] += intervals[i].bbv[j];
+				}
+			}
+		}
+		if (!num_members) {
+			continue;
+		}
+		for (j = 0; j < SAMPLING_DIMENSIONS; j++) {
+			center[j] /= num_members;
+		}
+
+		/* the representative goes first */
+		representative = 0;
+		nearest = -1.0;
+		for (i = 0; i < num_members; i++) {
+			distance = squaredDistance(intervals[members[i]].bbv, center);
+			if (nearest < 0.0 || distance < nearest) {
+				nearest = distance;
+				representative = i;
+			}
+		}
+		swap = members[0];
+		members[0] = members[representative];
+		members[representative] = swap;
+
+		/* partial Fisher-Yates shuffle of the others */
+		for (i = 1; i < samples && i < num_members; i++) {
+			seed = seed*1103515245 + 12345;
+			j = i + (seed >> 8) % (num_members - i);
+			swap = members[i];
+			members[i] = members[j];
+			members[j] = swap;
+		}
+
+		for (i = 0; i < samples && i < num_members; i++) {
+			selected[(*num_samples)++] = members[i];
+		}
+	}
+
+	free(members);
+	qsort(selected, *num_samples, sizeof(uint32_t), compareIndices);
+	return selected;
+}
+
+/**
+  * @brief Simulates sampled intervals with cycles from their checkpoints,
+  *        the main function of the worker threads. The interval before a
+  *        sample is simulated first, which warms up the cache models, 
+  *        the branch predictor and the pipeline, its cycles are not 
+  *        counted.
+  * @param[in,out] arg The sampled intervals.
+  * @return Always 0.
+  */
+static void* simulateSamples(void* arg) {
+
+	sampling_work_t* work = arg;
+	gen_simulator_t* simulator = work->simulator;
+	sampling_interval_t* current;
+	sim_context_t* context;
+	sim_results_t before, after;
+
+	while (1) {
+		pthread_mutex_lock(&(work->lock));
+		current = (work->next < work->num_samples) ? 
+			&(work->intervals[work->samples[(work->next)++]]) : 0;
+		pthread_mutex_unlock(&(work->lock));
+		if (!current) {
+			break;
+		}
+
+		context = gen_simulator_create_context(simulator);
+		if (!context) {
+			work->failed = 1;
+			break;
+		}
+		simulator->shareProgram(context, work->program);
+		simulator->restoreSnapshot(context, current->checkpoint);
+		simulator->setJITMode(context, work->jit_mode);
+
+		if (current->warmup) {
+			simulator->run(context, 0, current->warmup, 0);
+		}
+		simulator->getResults(context, &before);
+		simulator->run(context, 0, current->instructions, 0);
+		simulator->getResults(context, &after);
+		current->cycles = after.cycles - before.cycles;
+
+		gen_simulator_destroy_context(context);
+	}
+
+	return 0;
+}
+
+/**
+  * @brief Estimates the cycles of the whole program from intervals 
+  *        simulated with cycles (SimPoint). A functional pass collects
+  *        the basic block vector of every interval, similar intervals 
+  *        are clustered and a few intervals per cluster are simulated 
+  *        with cycles from checkpoints, concurrently. The cycles are 
+  *        extrapolated as stratified sample with a 95% confidence 
+  *        interval.
+  * @param[in] simulator The generic simulator data structure.
+  * @param[in,out] context The simulator context at the start of the 
+  *                        program, which is at its end afterwards.
+  * @param[in] outstream File stream where to print the estimation.
+  * @param[in] jit_mode Mode of the just-in-time compiler.
+  * @param[in] interval Number of instructions of an interval.
+  * @param[in] max_clusters Maximum number of clusters.
+  * @param[in] samples Number of intervals per cluster simulated with 
+  *                    cycles, at least 2 for a confidence interval.
+  * @return 0 on success, 1 if memory could not be allocated.
+  */
+int simulateSampled(gen_simulator_t* simulator, sim_context_t* context, FILE* outstream,
+	int jit_mode, uint32_t interval, uint32_t max_clusters, uint32_t samples) {
+
+	sampling_interval_t* intervals = 0;
+	sampling_work_t work;
+	sim_snapshot_t* initial;
+	sim_context_t* functional = 0;
+	sim_results_t results;
+	pthread_t* threads = 0;
+	uint32_t num_intervals, k, c, i, j, n, count, sample;
+	uint32_t num_threads;
+	uint64_t instructions = 0;
+	uint64_t cluster_instructions;
+	double cpi, mean, variance, estimate = 0.0, estimate_variance = 0.0;
+	int confidence = 1;
+	int status = 1;
+
+	memset(&work, 0, sizeof(work));
+	pthread_mutex_init(&(work.lock), 0);
+
+	/* functional pass: basic block vectors of all intervals */
+	initial = simulator->saveSnapshot(context);
+	simulator->setJITMode(context, jit_mode);
+	intervals = collectIntervals(simulator, context, interval, &num_intervals);
+	if (!initial || !intervals || !num_intervals) {
+		goto leave;
+	}
+	for (i = 0; i < num_intervals; i++) {
+		instructions += intervals[i].instructions;
+	}
+
+	k = chooseClusters(intervals, num_intervals, max_clusters);
+	work.samples = k ? selectSamples(intervals, num_intervals, k, samples, &(work.num_samples)) : 0;
+	if (!work.samples) {
+		goto leave;
+	}
+
+	/* second functional pass from the start: checkpoints of the samples,
+	   one interval ahead for the warm-up */
+	functional = gen_simulator_create_context(simulator);
+	if (!functional) {
+		goto leave;
+	}
+	simulator->shareProgram(functional, context);
+	simulator->restoreSnapshot(functional, initial);
+	simulator->setJITMode(functional, jit_mode);
+	for (i = 0, j = 0; j < work.num_samples; i++) {
+		while (j < work.num_samples && (work.samples[j] == i || work.samples[j] == i + 1)) {
+			sample = work.samples[j];
+			intervals[sample].checkpoint = simulator->saveSnapshot(functional);
+			if (!intervals[sample].checkpoint) {
+				goto leave;
+			}
+			intervals[sample].warmup = (sample > i) ? intervals[i].instructions : 0;
+			j++;
+		}
+		if (j < work.num_samples) {
+			simulator->fastForward(functional, intervals[i].instructions, 0);
+		}
+	}
+
+	/* simulate the samples with cycles, one thread per processor */
+	work.simulator = simulator;
+	work.program = functional;
+	work.jit_mode = jit_mode;
+	work.intervals = intervals;
+	num_threads = (uint32_t) sysconf(_SC_NPROCESSORS_ONLN);
+	if (num_threads < 1) {
+		num_threads = 1;
+	}
+	if (num_threads > work.num_samples) {
+		num_threads = work.num_samples;
+	}
+	threads = malloc(num_threads*sizeof(pthread_t));
+	if (!threads) {
+		goto leave;
+	}
+	for (i = 0; i < num_threads; i++) {
+		if (pthread_create(&(threads[i]), 0, simulateSamples, &work)) {
+			break;
+		}
+	}
+	/* without any thread, the samples are simulated by this one */
+	if (!i) {
+		simulateSamples(&work);
+	}
+	for (j = 0; j < i; j++) {
+		pthread_join(threads[j], 0);
+	}
+	if (work.failed) {
+		goto leave;
+	}
+
+	/* extrapolate per cluster (stratum) */
+	simulator->getResults(context, &results);
+	fprintf(outstream, "Sampled simulation of %llu instructions in %u intervals of %u "
+		"instructions, %u clusters:\n", (unsigned long long) instructions, num_intervals, interval, k);
+	fprintf(outstream, "Cluster  Intervals  Samples         CPI\n");
+	for (c = 0; c < k; c++) {
+		count = 0;
+		n = 0;
+		mean = 0.0;
+		variance = 0.0;
+		cluster_instructions = 0;
+		for (i = 0; i < num_intervals; i++) {
+			if (intervals[i].cluster == c) {
+				count++;
+				cluster_instructions += intervals[i].instructions;
+			}
+		}
+		for (j = 0; j < work.num_samples; j++) {
+			if (intervals[work.samples[j]].cluster == c) {
+				n++;
+				mean += (double) intervals[work.samples[j]].cycles/intervals[work.samples[j]].instructions;
+			}
+		}
+		if (!n) {
+			continue;
+		}
+		mean /= n;
+		for (j = 0; j < work.num_samples; j++) {
+			if (intervals[work.samples[j]].cluster == c) {
+				cpi = (double) intervals[work.samples[j]].cycles/intervals[work.samples[j]].instructions;
+				variance += (cpi - mean)*(cpi - mean);
+			}
+		}
+		if (n > 1) {
+			variance /= n - 1;
+			estimate_variance += (double) cluster_instructions*cluster_instructions*
+				variance/n*(1.0 - (double) n/count);
+		} else if (count > 1) {
+			confidence = 0;
+		}
+		estimate += cluster_instructions*mean;
+		fprintf(outstream, "%7u  %9u  %7u  %10.4f\n", c + 1, count, n, mean);
+	}
+
+	fprintf(outstream, "Main function returned value 0x%08x.\n", results.return_value);
+	if (confidence) {
+		fprintf(outstream, "Estimated cycles: %.0f +/- %.0f (95%% confidence, +/- %.2f%%).\n",
+			estimate, SAMPLING_CONFIDENCE_Z*sqrt(estimate_variance),
+			estimate ? 100.0*SAMPLING_CONFIDENCE_Z*sqrt(estimate_variance)/estimate : 0.0);
+	} else {
+		fprintf(outstream, "Estimated cycles: %.0f (no confidence interval with one sample "
+			"per cluster).\n", estimate);
+	}
+	status = 0;
+
+leave:
+	if (intervals) {
+		for (i = 0; i < num_intervals; i++) {
+			if (intervals[i].checkpoint) {
+				simulator->freeSnapshot(intervals[i].checkpoint);
+			}
+		}
+	}
+	if (functional) {
+		gen_simulator_destroy_context(functional);
+	}
+	if (initial) {
+		simulator->freeSnapshot(initial);
+	}
+	pthread_mutex_destroy(&(work.lock));
+	free(threads);
+	free(work.samples);
+	free(intervals);
+	return status;
+}
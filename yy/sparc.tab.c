@@ -0,0 +1,2743 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "yy/sparc.y"
+
+/*
+ * SPARC V8 Instruction Set Extension Simulator
+ *
+ * File: yy/sparc.y
+ * 
+ * Copyright (c) 2012 Clemens Bernhard Geyer <clemens.geyer@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy 
+ * of this software and associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including without limitation the 
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or 
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in 
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "sparc_target.h"
+#include "gen_assembler.h"
+
+/** Externally defined line number of current input file. */
+extern int yyline;
+/** Externally defined column number of current input file. */
+extern int yycolumn;
+/** Externally defined name of current program. */
+extern char* progname;
+/** Externally defined assembler struct which provides all printing functions. */
+extern gen_assembler_t* assembler;
+
+
+/** Externally defined output file stream of yacc. */
+extern FILE* yyout;
+/** Externally defined input file stream of yacc. */
+extern FILE* yyin;
+
+/** Save the instruction number. */
+unsigned instr_no = 0;
+
+/** Save the data memory counter. */
+unsigned data_no = 0;
+
+int section = SECTION_UNDEF;
+
+/**
+  * @brief Prints out the given error message and exits the program.
+  * @param[in] e The specific error message to be printed out.
+  */
+int yyerror(char* e) { 
+    fprintf(stderr, "%s: Parsing error in line %d, column %d.\n%s\n", 
+		progname, yyline, yycolumn - 1, e);
+	assembler->cleanUp();
+	/* close open file handles */
+	if (yyin != stdin) {
+		fclose(yyin);
+	}
+	if (yyout != stdout) {
+		fclose(stdout);
+	}
+    exit(EXIT_FAILURE);
+}
+
+
+
+#line 147 "sparc.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "sparc.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_LABEL = 3,                      /* LABEL  */
+  YYSYMBOL_TYPE_ARG = 4,                   /* TYPE_ARG  */
+  YYSYMBOL_REGISTER = 5,                   /* REGISTER  */
+  YYSYMBOL_IMMEDIATE = 6,                  /* IMMEDIATE  */
+  YYSYMBOL_Y_REGISTER = 7,                 /* Y_REGISTER  */
+  YYSYMBOL_P_REGISTER = 8,                 /* P_REGISTER  */
+  YYSYMBOL_LOOPS_REGISTER = 9,             /* LOOPS_REGISTER  */
+  YYSYMBOL_LOOPE_REGISTER = 10,            /* LOOPE_REGISTER  */
+  YYSYMBOL_LOOPB_REGISTER = 11,            /* LOOPB_REGISTER  */
+  YYSYMBOL_ICC = 12,                       /* ICC  */
+  YYSYMBOL_PRED_REG_TF = 13,               /* PRED_REG_TF  */
+  YYSYMBOL_FILE_INFO = 14,                 /* FILE_INFO  */
+  YYSYMBOL_TEXT_INFO = 15,                 /* TEXT_INFO  */
+  YYSYMBOL_GLOBL_INFO = 16,                /* GLOBL_INFO  */
+  YYSYMBOL_ALIGN_INFO = 17,                /* ALIGN_INFO  */
+  YYSYMBOL_TYPE_INFO = 18,                 /* TYPE_INFO  */
+  YYSYMBOL_SIZE_INFO = 19,                 /* SIZE_INFO  */
+  YYSYMBOL_SECTION_INFO = 20,              /* SECTION_INFO  */
+  YYSYMBOL_DATA_INFO = 21,                 /* DATA_INFO  */
+  YYSYMBOL_RODATA_INFO = 22,               /* RODATA_INFO  */
+  YYSYMBOL_BSS_INFO = 23,                  /* BSS_INFO  */
+  YYSYMBOL_ALLOC_INFO = 24,                /* ALLOC_INFO  */
+  YYSYMBOL_DATA_REL_LOCAL_INFO = 25,       /* DATA_REL_LOCAL_INFO  */
+  YYSYMBOL_WRITE_INFO = 26,                /* WRITE_INFO  */
+  YYSYMBOL_WORD = 27,                      /* WORD  */
+  YYSYMBOL_HALF = 28,                      /* HALF  */
+  YYSYMBOL_BYTE = 29,                      /* BYTE  */
+  YYSYMBOL_SKIP = 30,                      /* SKIP  */
+  YYSYMBOL_HI = 31,                        /* HI  */
+  YYSYMBOL_LOW = 32,                       /* LOW  */
+  YYSYMBOL_CYCLE_PRINT = 33,               /* CYCLE_PRINT  */
+  YYSYMBOL_CYCLE_CLEAR = 34,               /* CYCLE_CLEAR  */
+  YYSYMBOL_LOAD = 35,                      /* LOAD  */
+  YYSYMBOL_LOADA = 36,                     /* LOADA  */
+  YYSYMBOL_STORE = 37,                     /* STORE  */
+  YYSYMBOL_STOREA = 38,                    /* STOREA  */
+  YYSYMBOL_LDSTA = 39,                     /* LDSTA  */
+  YYSYMBOL_SWP = 40,                       /* SWP  */
+  YYSYMBOL_LOGIC = 41,                     /* LOGIC  */
+  YYSYMBOL_SHIFT = 42,                     /* SHIFT  */
+  YYSYMBOL_ARITHM = 43,                    /* ARITHM  */
+  YYSYMBOL_SVREST = 44,                    /* SVREST  */
+  YYSYMBOL_BRANCH = 45,                    /* BRANCH  */
+  YYSYMBOL_LDSB = 46,                      /* LDSB  */
+  YYSYMBOL_LDSH = 47,                      /* LDSH  */
+  YYSYMBOL_LDUB = 48,                      /* LDUB  */
+  YYSYMBOL_LDUH = 49,                      /* LDUH  */
+  YYSYMBOL_LD = 50,                        /* LD  */
+  YYSYMBOL_LDD = 51,                       /* LDD  */
+  YYSYMBOL_LDSBA = 52,                     /* LDSBA  */
+  YYSYMBOL_LDSHA = 53,                     /* LDSHA  */
+  YYSYMBOL_LDUBA = 54,                     /* LDUBA  */
+  YYSYMBOL_LDUHA = 55,                     /* LDUHA  */
+  YYSYMBOL_LDA = 56,                       /* LDA  */
+  YYSYMBOL_LDDA = 57,                      /* LDDA  */
+  YYSYMBOL_STB = 58,                       /* STB  */
+  YYSYMBOL_STH = 59,                       /* STH  */
+  YYSYMBOL_ST = 60,                        /* ST  */
+  YYSYMBOL_STD = 61,                       /* STD  */
+  YYSYMBOL_STBA = 62,                      /* STBA  */
+  YYSYMBOL_STHA = 63,                      /* STHA  */
+  YYSYMBOL_STA = 64,                       /* STA  */
+  YYSYMBOL_STDA = 65,                      /* STDA  */
+  YYSYMBOL_LDSTUB = 66,                    /* LDSTUB  */
+  YYSYMBOL_LDSTUBA = 67,                   /* LDSTUBA  */
+  YYSYMBOL_SWAP = 68,                      /* SWAP  */
+  YYSYMBOL_SWAPA = 69,                     /* SWAPA  */
+  YYSYMBOL_AND = 70,                       /* AND  */
+  YYSYMBOL_ANDCC = 71,                     /* ANDCC  */
+  YYSYMBOL_ANDN = 72,                      /* ANDN  */
+  YYSYMBOL_ANDNCC = 73,                    /* ANDNCC  */
+  YYSYMBOL_OR = 74,                        /* OR  */
+  YYSYMBOL_ORCC = 75,                      /* ORCC  */
+  YYSYMBOL_ORN = 76,                       /* ORN  */
+  YYSYMBOL_ORNCC = 77,                     /* ORNCC  */
+  YYSYMBOL_XOR = 78,                       /* XOR  */
+  YYSYMBOL_XORCC = 79,                     /* XORCC  */
+  YYSYMBOL_XNOR = 80,                      /* XNOR  */
+  YYSYMBOL_XNORCC = 81,                    /* XNORCC  */
+  YYSYMBOL_SLL = 82,                       /* SLL  */
+  YYSYMBOL_SRL = 83,                       /* SRL  */
+  YYSYMBOL_SRA = 84,                       /* SRA  */
+  YYSYMBOL_ADD = 85,                       /* ADD  */
+  YYSYMBOL_ADDCC = 86,                     /* ADDCC  */
+  YYSYMBOL_ADDX = 87,                      /* ADDX  */
+  YYSYMBOL_ADDXCC = 88,                    /* ADDXCC  */
+  YYSYMBOL_TADDCC = 89,                    /* TADDCC  */
+  YYSYMBOL_TADDCCTV = 90,                  /* TADDCCTV  */
+  YYSYMBOL_SUB = 91,                       /* SUB  */
+  YYSYMBOL_SUBCC = 92,                     /* SUBCC  */
+  YYSYMBOL_SUBX = 93,                      /* SUBX  */
+  YYSYMBOL_SUBXCC = 94,                    /* SUBXCC  */
+  YYSYMBOL_TSUBCC = 95,                    /* TSUBCC  */
+  YYSYMBOL_TSUBCCTV = 96,                  /* TSUBCCTV  */
+  YYSYMBOL_MULSCC = 97,                    /* MULSCC  */
+  YYSYMBOL_UMUL = 98,                      /* UMUL  */
+  YYSYMBOL_SMUL = 99,                      /* SMUL  */
+  YYSYMBOL_UMULCC = 100,                   /* UMULCC  */
+  YYSYMBOL_SMULCC = 101,                   /* SMULCC  */
+  YYSYMBOL_UDIV = 102,                     /* UDIV  */
+  YYSYMBOL_SDIV = 103,                     /* SDIV  */
+  YYSYMBOL_UDIVCC = 104,                   /* UDIVCC  */
+  YYSYMBOL_SDIVCC = 105,                   /* SDIVCC  */
+  YYSYMBOL_SAVE = 106,                     /* SAVE  */
+  YYSYMBOL_RESTORE = 107,                  /* RESTORE  */
+  YYSYMBOL_SETHI = 108,                    /* SETHI  */
+  YYSYMBOL_NOP = 109,                      /* NOP  */
+  YYSYMBOL_CALL = 110,                     /* CALL  */
+  YYSYMBOL_JUMPL = 111,                    /* JUMPL  */
+  YYSYMBOL_JMP = 112,                      /* JMP  */
+  YYSYMBOL_RD = 113,                       /* RD  */
+  YYSYMBOL_WR = 114,                       /* WR  */
+  YYSYMBOL_MOV = 115,                      /* MOV  */
+  YYSYMBOL_SEL = 116,                      /* SEL  */
+  YYSYMBOL_HWLOOP_INIT = 117,              /* HWLOOP_INIT  */
+  YYSYMBOL_HWLOOP_START = 118,             /* HWLOOP_START  */
+  YYSYMBOL_PREDBEGIN = 119,                /* PREDBEGIN  */
+  YYSYMBOL_PREDEND = 120,                  /* PREDEND  */
+  YYSYMBOL_PREDSET = 121,                  /* PREDSET  */
+  YYSYMBOL_PREDCLEAR = 122,                /* PREDCLEAR  */
+  YYSYMBOL_UNKNOWN = 123,                  /* UNKNOWN  */
+  YYSYMBOL_124_ = 124,                     /* '"'  */
+  YYSYMBOL_125_ = 125,                     /* ','  */
+  YYSYMBOL_126_ = 126,                     /* '-'  */
+  YYSYMBOL_127_ = 127,                     /* ':'  */
+  YYSYMBOL_128_ = 128,                     /* '['  */
+  YYSYMBOL_129_ = 129,                     /* ']'  */
+  YYSYMBOL_130_ = 130,                     /* '('  */
+  YYSYMBOL_131_ = 131,                     /* ')'  */
+  YYSYMBOL_132_ = 132,                     /* '+'  */
+  YYSYMBOL_YYACCEPT = 133,                 /* $accept  */
+  YYSYMBOL_assembler_prog = 134,           /* assembler_prog  */
+  YYSYMBOL_metainfo = 135,                 /* metainfo  */
+  YYSYMBOL_branchtargetdefinition = 136,   /* branchtargetdefinition  */
+  YYSYMBOL_data = 137,                     /* data  */
+  YYSYMBOL_instruction = 138,              /* instruction  */
+  YYSYMBOL_loadinstructions = 139,         /* loadinstructions  */
+  YYSYMBOL_storeinstructions = 140,        /* storeinstructions  */
+  YYSYMBOL_atomicloadstoreinstructions = 141, /* atomicloadstoreinstructions  */
+  YYSYMBOL_swapinstructions = 142,         /* swapinstructions  */
+  YYSYMBOL_sethiinstruction = 143,         /* sethiinstruction  */
+  YYSYMBOL_nopinstruction = 144,           /* nopinstruction  */
+  YYSYMBOL_logicalinstructions = 145,      /* logicalinstructions  */
+  YYSYMBOL_shiftinstructions = 146,        /* shiftinstructions  */
+  YYSYMBOL_arithmeticinstructions = 147,   /* arithmeticinstructions  */
+  YYSYMBOL_saverestoreinstructions = 148,  /* saverestoreinstructions  */
+  YYSYMBOL_branchinstructions = 149,       /* branchinstructions  */
+  YYSYMBOL_callinstruction = 150,          /* callinstruction  */
+  YYSYMBOL_jumplinkinstruction = 151,      /* jumplinkinstruction  */
+  YYSYMBOL_readstatusregisterinstruction = 152, /* readstatusregisterinstruction  */
+  YYSYMBOL_writestatusregisterinstruction = 153, /* writestatusregisterinstruction  */
+  YYSYMBOL_selccinstructions = 154,        /* selccinstructions  */
+  YYSYMBOL_movccinstructions = 155,        /* movccinstructions  */
+  YYSYMBOL_hwloopinstructions = 156,       /* hwloopinstructions  */
+  YYSYMBOL_predicatedblocksinstructions = 157, /* predicatedblocksinstructions  */
+  YYSYMBOL_predicatedreginstructions = 158, /* predicatedreginstructions  */
+  YYSYMBOL_addressdefinition = 159         /* addressdefinition  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  2
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   476
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  133
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  27
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  133
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  493
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   378
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   124,     2,     2,     2,     2,     2,
+     130,   131,     2,   132,   125,   126,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   127,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   128,     2,   129,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   139,   139,   140,   141,   142,   143,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,   159,   174,
+     175,   176,   177,   178,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     202,   208,   214,   215,   221,   222,   225,   226,   234,   244,
+     245,   253,   263,   264,   272,   282,   283,   291,   301,   302,
+     303,   311,   319,   327,   337,   340,   341,   342,   343,   351,
+     359,   367,   375,   383,   393,   394,   395,   396,   404,   412,
+     420,   428,   436,   446,   447,   448,   449,   457,   465,   473,
+     481,   489,   499,   500,   501,   502,   510,   518,   526,   534,
+     542,   552,   555,   558,   559,   560,   568,   576,   584,   594,
+     595,   603,   613,   614,   617,   618,   619,   622,   625,   626,
+     627,   628,   629,   632,   640,   648,   651,   652,   657,   666,
+     669,   670,   671,   672
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "LABEL", "TYPE_ARG",
+  "REGISTER", "IMMEDIATE", "Y_REGISTER", "P_REGISTER", "LOOPS_REGISTER",
+  "LOOPE_REGISTER", "LOOPB_REGISTER", "ICC", "PRED_REG_TF", "FILE_INFO",
+  "TEXT_INFO", "GLOBL_INFO", "ALIGN_INFO", "TYPE_INFO", "SIZE_INFO",
+  "SECTION_INFO", "DATA_INFO", "RODATA_INFO", "BSS_INFO", "ALLOC_INFO",
+  "DATA_REL_LOCAL_INFO", "WRITE_INFO", "WORD", "HALF", "BYTE", "SKIP",
+  "HI", "LOW", "CYCLE_PRINT", "CYCLE_CLEAR", "LOAD", "LOADA", "STORE",
+  "STOREA", "LDSTA", "SWP", "LOGIC", "SHIFT", "ARITHM", "SVREST", "BRANCH",
+  "LDSB", "LDSH", "LDUB", "LDUH", "LD", "LDD", "LDSBA", "LDSHA", "LDUBA",
+  "LDUHA", "LDA", "LDDA", "STB", "STH", "ST", "STD", "STBA", "STHA", "STA",
+  "STDA", "LDSTUB", "LDSTUBA", "SWAP", "SWAPA", "AND", "ANDCC", "ANDN",
+  "ANDNCC", "OR", "ORCC", "ORN", "ORNCC", "XOR", "XORCC", "XNOR", "XNORCC",
+  "SLL", "SRL", "SRA", "ADD", "ADDCC", "ADDX", "ADDXCC", "TADDCC",
+  "TADDCCTV", "SUB", "SUBCC", "SUBX", "SUBXCC", "TSUBCC", "TSUBCCTV",
+  "MULSCC", "UMUL", "SMUL", "UMULCC", "SMULCC", "UDIV", "SDIV", "UDIVCC",
+  "SDIVCC", "SAVE", "RESTORE", "SETHI", "NOP", "CALL", "JUMPL", "JMP",
+  "RD", "WR", "MOV", "SEL", "HWLOOP_INIT", "HWLOOP_START", "PREDBEGIN",
+  "PREDEND", "PREDSET", "PREDCLEAR", "UNKNOWN", "'\"'", "','", "'-'",
+  "':'", "'['", "']'", "'('", "')'", "'+'", "$accept", "assembler_prog",
+  "metainfo", "branchtargetdefinition", "data", "instruction",
+  "loadinstructions", "storeinstructions", "atomicloadstoreinstructions",
+  "swapinstructions", "sethiinstruction", "nopinstruction",
+  "logicalinstructions", "shiftinstructions", "arithmeticinstructions",
+  "saverestoreinstructions", "branchinstructions", "callinstruction",
+  "jumplinkinstruction", "readstatusregisterinstruction",
+  "writestatusregisterinstruction", "selccinstructions",
+  "movccinstructions", "hwloopinstructions",
+  "predicatedblocksinstructions", "predicatedreginstructions",
+  "addressdefinition", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-110)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -110,   131,  -110,  -109,   -96,  -110,    58,    33,    64,    66,
+      63,  -110,    88,    43,    57,    65,  -110,  -110,     7,    -4,
+      11,    12,    -3,    -2,    -1,     0,    80,     9,  -110,    98,
+       1,     2,    10,    68,    81,    93,    84,  -110,    13,  -110,
+       8,   101,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,
+    -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,
+    -110,  -110,  -110,  -110,  -110,  -110,  -110,   113,  -110,  -110,
+      -8,    -7,    -6,    -5,    17,  -110,  -110,  -110,  -110,  -110,
+       4,    90,    18,   116,   114,     5,    91,    16,    92,    29,
+     118,   145,    31,   150,   149,    44,   158,   159,    52,   173,
+     171,  -110,    55,    48,    51,   174,  -110,    54,   178,   176,
+      62,   178,   177,  -110,    67,   181,   182,    69,   184,    76,
+      71,    72,    73,  -110,   183,  -110,   185,   187,  -110,    75,
+     196,   100,   179,   180,   186,   178,    77,    78,    74,    83,
+      82,   178,    85,    86,   178,    87,    89,    21,    94,    96,
+      24,    95,    97,    26,   103,   104,    28,   107,   108,   200,
+     109,    79,   198,   125,    30,   110,   126,   207,  -110,   127,
+     208,   111,   128,   102,   133,   134,   135,   105,   206,   210,
+     132,  -110,   136,  -110,  -110,   112,  -110,  -110,   137,   138,
+     139,   209,   144,   178,    99,   216,   141,   217,   146,   143,
+     218,   148,   151,   152,   153,    32,   251,   154,   155,   156,
+      36,   261,   160,   162,   163,    38,   262,   164,   165,   166,
+      40,   265,  -110,   276,   220,   161,   271,  -110,  -110,   167,
+     289,   282,  -110,   285,  -110,   294,   287,   188,   189,   296,
+     106,   297,  -110,  -110,  -110,  -110,   291,   292,   299,   280,
+     281,   190,   191,   303,   192,   178,   304,   193,   194,   305,
+     195,   197,   306,   307,   311,   314,   199,   201,   202,   318,
+     322,   323,   326,   205,   211,   203,   329,   330,   332,   328,
+     213,   214,   212,   335,   336,   338,   341,   221,   222,   215,
+     343,  -110,   219,   224,    53,   348,  -110,   178,   178,  -110,
+     345,   346,   347,  -110,   230,   231,   232,  -110,   349,  -110,
+    -110,  -110,   353,   178,  -110,  -110,   233,   234,   355,   178,
+    -110,   358,   178,  -110,  -110,  -110,   235,   359,   360,   364,
+     243,  -110,  -110,   238,   365,   366,   369,   248,  -110,  -110,
+     245,   372,   373,   371,   254,  -110,  -110,   249,   376,   377,
+     380,   259,   260,   381,   263,   257,   258,   266,  -110,   267,
+    -110,  -110,   385,   388,   389,   387,  -110,   268,  -110,   270,
+    -110,   272,  -110,   273,   274,  -110,  -110,   269,    42,   278,
+    -110,  -110,   275,    46,   279,  -110,  -110,   277,    60,   284,
+    -110,  -110,   283,    70,   391,  -110,   400,   404,  -110,   405,
+     406,  -110,  -110,  -110,  -110,   288,   178,   290,   293,   407,
+     295,   298,   300,   286,   412,   301,   302,   308,   309,   414,
+     310,   312,   313,   315,   416,   316,   317,   319,   320,  -110,
+    -110,   321,  -110,  -110,   417,   324,   419,   423,  -110,   424,
+     425,   426,   429,  -110,   431,   435,   438,   443,  -110,   442,
+     444,   446,   445,  -110,   449,   450,   451,   454,   333,  -110,
+    -110,  -110,  -110,  -110,  -110,  -110,   331,  -110,  -110,  -110,
+     334,  -110,  -110,  -110,   337,  -110,  -110,  -110,   339,   455,
+     342,   344,   350,   351,  -110,   456,   458,   459,   461,  -110,
+    -110,  -110,  -110
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       2,     0,     1,     0,     0,     8,     0,     0,     0,     0,
+       0,     9,     0,     0,     0,     0,    44,    45,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    64,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,     0,   125,
+       0,     0,     3,     4,     5,     6,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    40,    39,    41,    42,    43,    18,     0,    13,    14,
+       0,     0,     0,     0,     0,    20,    19,    21,    22,    23,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   101,     0,     0,     0,     0,   102,   130,     0,     0,
+       0,     0,     0,   104,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,   126,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   106,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   127,     0,     7,    15,     0,    17,    10,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    58,     0,     0,     0,     0,   131,   132,     0,
+       0,     0,   103,     0,   109,     0,     0,     0,     0,     0,
+       0,     0,   118,   119,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    60,     0,     0,     0,     0,   105,     0,     0,   110,
+       0,     0,     0,   117,     0,     0,     0,   124,     0,    16,
+      12,    11,     0,     0,    46,    49,     0,     0,     0,     0,
+      52,     0,     0,    55,    65,    66,     0,     0,     0,     0,
+       0,    74,    75,     0,     0,     0,     0,     0,    83,    84,
+       0,     0,     0,     0,     0,    92,    93,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   108,     0,
+     112,   113,     0,     0,     0,     0,    47,     0,    50,     0,
+      53,     0,    56,     0,     0,    68,    69,     0,     0,     0,
+      77,    78,     0,     0,     0,    86,    87,     0,     0,     0,
+      95,    96,     0,     0,     0,    59,     0,     0,   133,     0,
+       0,   116,   115,   114,   128,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    61,
+      62,     0,   107,   111,     0,     0,     0,     0,    67,     0,
+       0,     0,     0,    76,     0,     0,     0,     0,    85,     0,
+       0,     0,     0,    94,     0,     0,     0,     0,     0,    48,
+      51,    54,    57,    70,    71,    72,     0,    79,    80,    81,
+       0,    88,    89,    90,     0,    97,    98,    99,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,     0,    73,
+      82,    91,   100
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+    -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,
+    -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,  -110,
+    -110,  -110,  -110,  -110,  -110,  -110,   -31
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     1,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,   110
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     113,    82,    89,    92,    95,    98,   107,   107,    83,    90,
+      93,    96,    99,   108,   111,   102,   125,   114,    66,    80,
+     126,   103,   115,    85,    87,   123,   202,   203,    67,   207,
+     208,   212,   213,   217,   218,   227,   228,   266,   267,    69,
+     104,   273,   274,   280,   281,   287,   288,   411,   412,    77,
+     137,   416,   417,   204,   160,   143,   209,   146,   214,   354,
+     219,    68,   229,    78,   268,   421,   422,    70,   275,    71,
+     282,    79,   289,   117,   413,   426,   427,   165,   418,   161,
+     168,   175,   176,   101,   355,    72,    73,   120,    74,   121,
+     122,    75,   423,   118,    76,   107,   107,   107,   136,   142,
+     145,   106,   428,   185,   190,   119,   186,   237,   238,   128,
+     196,   304,   305,   199,   242,   243,   129,   130,   131,   132,
+     133,   139,   140,   148,    84,    91,    94,    97,   100,   109,
+     112,     2,   135,   141,     3,    81,   127,   105,   116,    86,
+      88,   124,   134,   138,   144,     4,     5,     6,     7,     8,
+       9,    10,    11,   149,   147,   151,   150,   152,    12,    13,
+      14,    15,   254,   154,    16,    17,    18,   155,    19,   153,
+      20,    21,    22,    23,    24,    25,    26,   156,   157,   158,
+     159,   162,   163,   107,   166,   169,   164,   167,   171,   174,
+     172,   180,   170,   181,   173,   182,   177,   178,   179,   183,
+     184,   225,   193,   187,   188,   222,   191,   192,   194,   224,
+     189,   195,   232,   234,   197,   198,   200,   244,   201,   205,
+     210,   245,   252,   292,   316,   206,   211,   255,   215,   256,
+     258,   261,   220,   216,   223,   230,   235,   221,   248,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,   226,   231,   233,   236,   239,   240,
+     241,   246,   249,   250,   269,   247,   357,   358,   251,   253,
+     257,   259,   260,   262,   276,   283,   263,   264,   290,   270,
+     271,   291,   367,   265,   294,   277,   272,   278,   371,   284,
+     285,   373,   293,   279,   296,   297,   286,   295,   298,   299,
+     300,   303,   309,   306,   307,   308,   310,   311,   314,   317,
+     320,   323,   324,   301,   302,   312,   325,   326,   318,   313,
+     321,   315,   319,   330,   327,   322,   328,   331,   332,   333,
+     334,   340,   329,   336,   337,   338,   335,   339,   341,   342,
+     344,   345,   343,   346,   347,   350,   348,   349,   351,   353,
+     352,   356,   359,   360,   361,   362,   363,   364,   366,   369,
+     370,   365,   368,   372,   375,   376,   374,   377,   378,   379,
+     380,   381,   382,   383,   387,   435,   384,   385,   386,   388,
+     389,   390,   391,   392,   393,   394,   395,   397,   396,   398,
+     401,   399,   400,   402,   403,   404,   429,   405,   406,   409,
+     410,   407,   408,   414,   419,   430,   415,   431,   420,   424,
+     432,   433,   438,   434,   425,   436,   442,   443,   437,   448,
+     439,   453,   459,   440,   461,   441,   444,   445,   462,   463,
+     464,   465,   466,   446,     0,   449,   467,   450,   451,   447,
+     468,   454,   455,   469,   456,   452,   470,   471,   474,   472,
+     457,   473,   458,   460,   475,   476,   477,   478,   479,     0,
+     484,   489,   480,   490,   491,   481,   492,   485,   482,   486,
+     483,     0,     0,     0,     0,   487,   488
+};
+
+static const yytype_int16 yycheck[] =
+{
+      31,     5,     5,     5,     5,     5,     5,     5,    12,    12,
+      12,    12,    12,    12,    12,     6,     8,     7,   127,    12,
+      12,    12,    12,    12,    12,    12,     5,     6,   124,     5,
+       6,     5,     6,     5,     6,     5,     6,     5,     6,     6,
+      31,     5,     6,     5,     6,     5,     6,     5,     6,     6,
+      81,     5,     6,    32,     6,    86,    32,    88,    32,     6,
+      32,     3,    32,     6,    32,     5,     6,     3,    32,     3,
+      32,     6,    32,     5,    32,     5,     6,   108,    32,    31,
+     111,     5,     6,     3,    31,    22,    23,     3,    25,     5,
+       6,     3,    32,    12,     6,     5,     5,     5,     8,     8,
+       8,     3,    32,     3,   135,    12,     6,     5,     6,     8,
+     141,     5,     6,   144,     9,    10,     3,   125,   125,   125,
+     125,     5,     8,     5,   128,   128,   128,   128,   128,   128,
+     128,     0,   128,   128,     3,   128,   128,   128,   128,   128,
+     128,   128,   125,   125,   128,    14,    15,    16,    17,    18,
+      19,    20,    21,     8,   125,     5,   125,     8,    27,    28,
+      29,    30,   193,     5,    33,    34,    35,     8,    37,   125,
+      39,    40,    41,    42,    43,    44,    45,   125,     5,     8,
+     125,   130,     8,     5,     8,     8,   132,   125,     7,     5,
+       8,     8,   125,     8,   125,     8,   125,   125,   125,   124,
+       4,     3,   128,    24,    24,     5,   129,   129,   125,   130,
+      24,   129,     5,     5,   129,   129,   129,    11,   129,   125,
+     125,    11,    13,     3,   255,   129,   129,   128,   125,    13,
+      13,    13,   125,   129,   125,   125,   125,   129,   126,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   129,   129,   129,   129,   125,   125,
+     125,   129,   125,   125,    13,   129,   297,   298,   129,   125,
+     129,   125,   129,   125,    13,    13,   125,   125,    13,   125,
+     125,     5,   313,   130,    13,   125,   130,   125,   319,   125,
+     125,   322,   131,   130,     5,    13,   130,   130,    13,     5,
+      13,     5,     3,     6,    13,    13,    26,    26,     5,     5,
+       5,     5,     5,   125,   125,   125,     5,     3,   125,   128,
+     125,   129,   128,     5,   125,   128,   125,     5,     5,     3,
+     125,     3,   130,   130,     5,     5,   125,     5,   125,   125,
+       5,     5,   130,     5,     3,   130,   125,   125,     5,   125,
+     131,     3,     7,     7,     7,   125,   125,   125,     5,   125,
+       5,    12,   129,     5,     5,     5,   131,     3,   125,   131,
+       5,     5,     3,   125,     3,   406,   131,     5,     5,   125,
+     131,     5,     5,     3,   125,   125,     5,   130,   125,   131,
+       5,   125,   125,     5,     5,     8,     5,   129,   128,   125,
+     131,   129,   129,   125,   125,     5,   131,     3,   131,   125,
+       5,     5,     5,   125,   131,   125,   130,     5,   125,     5,
+     125,     5,     5,   125,     5,   125,   125,   125,     5,     5,
+       5,     5,     3,   125,    -1,   125,     5,   125,   125,   130,
+       5,   125,   125,     5,   125,   130,     3,     5,     3,     5,
+     130,     5,   131,   129,     5,     5,     5,     3,   125,    -1,
+       5,     5,   131,     5,     5,   131,     5,   125,   131,   125,
+     131,    -1,    -1,    -1,    -1,   125,   125
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,   134,     0,     3,    14,    15,    16,    17,    18,    19,
+      20,    21,    27,    28,    29,    30,    33,    34,    35,    37,
+      39,    40,    41,    42,    43,    44,    45,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   127,   124,     3,     6,
+       3,     3,    22,    23,    25,     3,     6,     6,     6,     6,
+      12,   128,     5,    12,   128,    12,   128,    12,   128,     5,
+      12,   128,     5,    12,   128,     5,    12,   128,     5,    12,
+     128,     3,     6,    12,    31,   128,     3,     5,    12,   128,
+     159,    12,   128,   159,     7,    12,   128,     5,    12,    12,
+       3,     5,     6,    12,   128,     8,    12,   128,     8,     3,
+     125,   125,   125,   125,   125,   128,     8,   159,   125,     5,
+       8,   128,     8,   159,   128,     8,   159,   125,     5,     8,
+     125,     5,     8,   125,     5,     8,   125,     5,     8,   125,
+       6,    31,   130,     8,   132,   159,     8,   125,   159,     8,
+     125,     7,     8,   125,     5,     5,     6,   125,   125,   125,
+       8,     8,     8,   124,     4,     3,     6,    24,    24,    24,
+     159,   129,   129,   128,   125,   129,   159,   129,   129,   159,
+     129,   129,     5,     6,    32,   125,   129,     5,     6,    32,
+     125,   129,     5,     6,    32,   125,   129,     5,     6,    32,
+     125,   129,     5,   125,   130,     3,   129,     5,     6,    32,
+     125,   129,     5,   129,     5,   125,   129,     5,     6,   125,
+     125,   125,     9,    10,    11,    11,   129,   129,   126,   125,
+     125,   129,    13,   125,   159,   128,    13,   129,    13,   125,
+     129,    13,   125,   125,   125,   130,     5,     6,    32,    13,
+     125,   125,   130,     5,     6,    32,    13,   125,   125,   130,
+       5,     6,    32,    13,   125,   125,   130,     5,     6,    32,
+      13,     5,     3,   131,    13,   130,     5,    13,    13,     5,
+      13,   125,   125,     5,     5,     6,     6,    13,    13,     3,
+      26,    26,   125,   128,     5,   129,   159,     5,   125,   128,
+       5,   125,   128,     5,     5,     5,     3,   125,   125,   130,
+       5,     5,     5,     3,   125,   125,   130,     5,     5,     5,
+       3,   125,   125,   130,     5,     5,     5,     3,   125,   125,
+     130,     5,   131,   125,     6,    31,     3,   159,   159,     7,
+       7,     7,   125,   125,   125,    12,     5,   159,   129,   125,
+       5,   159,     5,   159,   131,     5,     5,     3,   125,   131,
+       5,     5,     3,   125,   131,     5,     5,     3,   125,   131,
+       5,     5,     3,   125,   125,     5,   125,   130,   131,   125,
+     125,     5,     5,     5,     8,   129,   128,   129,   129,   125,
+     131,     5,     6,    32,   125,   131,     5,     6,    32,   125,
+     131,     5,     6,    32,   125,   131,     5,     6,    32,     5,
+       5,     3,     5,     5,   125,   159,   125,   125,     5,   125,
+     125,   125,   130,     5,   125,   125,   125,   130,     5,   125,
+     125,   125,   130,     5,   125,   125,   125,   130,   131,     5,
+     129,     5,     5,     5,     5,     5,     3,     5,     5,     5,
+       3,     5,     5,     5,     3,     5,     5,     5,     3,   125,
+     131,   131,   131,   131,     5,   125,   125,   125,   125,     5,
+       5,     5,     5
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   133,   134,   134,   134,   134,   134,   135,   135,   135,
+     135,   135,   135,   135,   135,   135,   135,   135,   136,   137,
+     137,   137,   137,   137,   138,   138,   138,   138,   138,   138,
+     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
+     138,   138,   138,   138,   138,   138,   139,   139,   139,   140,
+     140,   140,   141,   141,   141,   142,   142,   142,   143,   143,
+     143,   143,   143,   143,   144,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   147,   147,   147,   147,   147,   147,   147,
+     147,   147,   148,   148,   148,   148,   148,   148,   148,   148,
+     148,   149,   150,   151,   151,   151,   151,   151,   151,   152,
+     152,   152,   153,   153,   154,   154,   154,   155,   156,   156,
+     156,   156,   156,   157,   157,   157,   158,   158,   158,   158,
+     159,   159,   159,   159
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     2,     2,     2,     4,     1,     1,
+       4,     6,     6,     2,     2,     4,     6,     4,     2,     2,
+       2,     2,     2,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     6,     7,    10,     6,
+       7,    10,     6,     7,    10,     6,     7,    10,     4,     7,
+       5,     8,     8,    11,     1,     6,     6,     9,     7,     7,
+      10,    10,    10,    13,     6,     6,     9,     7,     7,    10,
+      10,    10,    13,     6,     6,     9,     7,     7,    10,    10,
+      10,    13,     6,     6,     9,     7,     7,    10,    10,    10,
+      13,     2,     2,     4,     2,     5,     3,     8,     6,     4,
+       5,     8,     6,     6,     7,     7,     7,     5,     4,     4,
+       4,     4,     1,     2,     5,     1,     2,     3,     7,     2,
+       1,     3,     3,     6
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 6: /* assembler_prog: assembler_prog instruction  */
+#line 143 "yy/sparc.y"
+                                     { instr_no++; }
+#line 1602 "sparc.tab.c"
+    break;
+
+  case 8: /* metainfo: TEXT_INFO  */
+#line 147 "yy/sparc.y"
+                    { section = SECTION_TEXT; }
+#line 1608 "sparc.tab.c"
+    break;
+
+  case 9: /* metainfo: DATA_INFO  */
+#line 148 "yy/sparc.y"
+                    { section = SECTION_DATA; }
+#line 1614 "sparc.tab.c"
+    break;
+
+  case 10: /* metainfo: SECTION_INFO RODATA_INFO ',' ALLOC_INFO  */
+#line 149 "yy/sparc.y"
+                                                  { section = SECTION_DATA; }
+#line 1620 "sparc.tab.c"
+    break;
+
+  case 11: /* metainfo: SECTION_INFO DATA_REL_LOCAL_INFO ',' ALLOC_INFO ',' WRITE_INFO  */
+#line 150 "yy/sparc.y"
+                                                                         { section = SECTION_DATA; }
+#line 1626 "sparc.tab.c"
+    break;
+
+  case 12: /* metainfo: SECTION_INFO BSS_INFO ',' ALLOC_INFO ',' WRITE_INFO  */
+#line 151 "yy/sparc.y"
+                                                              { section = SECTION_DATA; }
+#line 1632 "sparc.tab.c"
+    break;
+
+  case 14: /* metainfo: ALIGN_INFO IMMEDIATE  */
+#line 153 "yy/sparc.y"
+                               { if ((yyvsp[0].value) < 0 || (yyvsp[0].value) > 32) {yyerror("Unknown alignment number!");} }
+#line 1638 "sparc.tab.c"
+    break;
+
+  case 15: /* metainfo: TYPE_INFO LABEL ',' TYPE_ARG  */
+#line 154 "yy/sparc.y"
+                                       { /* fprintf(stderr, "Label %s - Type: %s\n", $2, $4); */ }
+#line 1644 "sparc.tab.c"
+    break;
+
+  case 18: /* branchtargetdefinition: LABEL ':'  */
+#line 160 "yy/sparc.y"
+        {
+		if (section == SECTION_TEXT) { 
+			if (instr_no == 0 && (strcmp((yyvsp[-1].string), "main"))) {
+				yyerror("First instruction label has to be main!");
+			}
+			assembler->saveLabel(instr_no, (yyvsp[-1].string)); 
+		} else if (section == SECTION_DATA) {
+			assembler->saveLabel(data_no, (yyvsp[-1].string));
+		} else {
+			yyerror("Label was found in unknown section!");
+		}
+	}
+#line 1661 "sparc.tab.c"
+    break;
+
+  case 19: /* data: WORD IMMEDIATE  */
+#line 174 "yy/sparc.y"
+                     { assembler->saveData(data_no, (yyvsp[0].value), 4); data_no += 4; }
+#line 1667 "sparc.tab.c"
+    break;
+
+  case 20: /* data: WORD LABEL  */
+#line 175 "yy/sparc.y"
+                     {assembler->saveDataLabel(data_no, (yyvsp[0].string), 4); data_no += 4; }
+#line 1673 "sparc.tab.c"
+    break;
+
+  case 21: /* data: HALF IMMEDIATE  */
+#line 176 "yy/sparc.y"
+                         { assembler->saveData(data_no, (yyvsp[0].value), 2); data_no += 2; }
+#line 1679 "sparc.tab.c"
+    break;
+
+  case 22: /* data: BYTE IMMEDIATE  */
+#line 177 "yy/sparc.y"
+                         { assembler->saveData(data_no, (yyvsp[0].value), 1); data_no += 1; }
+#line 1685 "sparc.tab.c"
+    break;
+
+  case 23: /* data: SKIP IMMEDIATE  */
+#line 178 "yy/sparc.y"
+                         { data_no += (yyvsp[0].value); }
+#line 1691 "sparc.tab.c"
+    break;
+
+  case 39: /* instruction: movccinstructions  */
+#line 197 "yy/sparc.y"
+        {
+		if (!(assembler->hasMovCC())) { 
+			yyerror("Target does not support conditional moves!"); 
+		} 
+	}
+#line 1701 "sparc.tab.c"
+    break;
+
+  case 40: /* instruction: selccinstructions  */
+#line 203 "yy/sparc.y"
+        {
+		if (!(assembler->hasSelCC())) { 
+			yyerror("Target does not support conditional selects!"); 
+		} 
+	}
+#line 1711 "sparc.tab.c"
+    break;
+
+  case 41: /* instruction: hwloopinstructions  */
+#line 209 "yy/sparc.y"
+        {
+		if (!(assembler->hasHWLoops())) {
+			yyerror("Target does not support hardware loops!");
+		}
+	}
+#line 1721 "sparc.tab.c"
+    break;
+
+  case 43: /* instruction: predicatedreginstructions  */
+#line 216 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredBlocksReg()) && !(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate registers!");
+		}
+	}
+#line 1731 "sparc.tab.c"
+    break;
+
+  case 44: /* instruction: CYCLE_PRINT  */
+#line 221 "yy/sparc.y"
+                      { assembler->saveSimulatorInstr(instr_no, CYCLE_PRINT);}
+#line 1737 "sparc.tab.c"
+    break;
+
+  case 45: /* instruction: CYCLE_CLEAR  */
+#line 222 "yy/sparc.y"
+                      { assembler->saveSimulatorInstr(instr_no, CYCLE_CLEAR);}
+#line 1743 "sparc.tab.c"
+    break;
+
+  case 46: /* loadinstructions: LOAD '[' addressdefinition ']' ',' REGISTER  */
+#line 225 "yy/sparc.y"
+                                                              { assembler->saveAddrInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-3].address)); }
+#line 1749 "sparc.tab.c"
+    break;
+
+  case 47: /* loadinstructions: LOAD ICC '[' addressdefinition ']' ',' REGISTER  */
+#line 227 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1761 "sparc.tab.c"
+    break;
+
+  case 48: /* loadinstructions: LOAD '[' P_REGISTER ']' PRED_REG_TF '[' addressdefinition ']' ',' REGISTER  */
+#line 235 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 1773 "sparc.tab.c"
+    break;
+
+  case 49: /* storeinstructions: STORE REGISTER ',' '[' addressdefinition ']'  */
+#line 244 "yy/sparc.y"
+                                                                { assembler->saveAddrInstr(instr_no, (yyvsp[-5].value), (yyvsp[-4].value), (yyvsp[-1].address)); }
+#line 1779 "sparc.tab.c"
+    break;
+
+  case 50: /* storeinstructions: STORE ICC REGISTER ',' '[' addressdefinition ']'  */
+#line 246 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-6].value), (yyvsp[-4].value), (yyvsp[-1].address));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1791 "sparc.tab.c"
+    break;
+
+  case 51: /* storeinstructions: STORE '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' '[' addressdefinition ']'  */
+#line 254 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-9].value), (yyvsp[-4].value), (yyvsp[-1].address));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 1803 "sparc.tab.c"
+    break;
+
+  case 52: /* atomicloadstoreinstructions: LDSTA '[' addressdefinition ']' ',' REGISTER  */
+#line 263 "yy/sparc.y"
+                                                                          { assembler->saveAddrInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-3].address)); }
+#line 1809 "sparc.tab.c"
+    break;
+
+  case 53: /* atomicloadstoreinstructions: LDSTA ICC '[' addressdefinition ']' ',' REGISTER  */
+#line 265 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1821 "sparc.tab.c"
+    break;
+
+  case 54: /* atomicloadstoreinstructions: LDSTA '[' P_REGISTER ']' PRED_REG_TF '[' addressdefinition ']' ',' REGISTER  */
+#line 273 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 1833 "sparc.tab.c"
+    break;
+
+  case 55: /* swapinstructions: SWP '[' addressdefinition ']' ',' REGISTER  */
+#line 282 "yy/sparc.y"
+                                                             { assembler->saveAddrInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-3].address)); }
+#line 1839 "sparc.tab.c"
+    break;
+
+  case 56: /* swapinstructions: SWP ICC '[' addressdefinition ']' ',' REGISTER  */
+#line 284 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1851 "sparc.tab.c"
+    break;
+
+  case 57: /* swapinstructions: SWP '[' P_REGISTER ']' PRED_REG_TF '[' addressdefinition ']' ',' REGISTER  */
+#line 292 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-3].address));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 1863 "sparc.tab.c"
+    break;
+
+  case 58: /* sethiinstruction: SETHI IMMEDIATE ',' REGISTER  */
+#line 301 "yy/sparc.y"
+                                               { assembler->saveSethiInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-2].value)); }
+#line 1869 "sparc.tab.c"
+    break;
+
+  case 59: /* sethiinstruction: SETHI HI '(' LABEL ')' ',' REGISTER  */
+#line 302 "yy/sparc.y"
+                                              { assembler->saveSethiLabelInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-3].string)); }
+#line 1875 "sparc.tab.c"
+    break;
+
+  case 60: /* sethiinstruction: SETHI ICC IMMEDIATE ',' REGISTER  */
+#line 304 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveSethiInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-3].value));
+	}
+#line 1887 "sparc.tab.c"
+    break;
+
+  case 61: /* sethiinstruction: SETHI ICC HI '(' LABEL ')' ',' REGISTER  */
+#line 312 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveSethiLabelInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-3].string));
+		assembler->addICC(instr_no, (yyvsp[-6].value));
+	}
+#line 1899 "sparc.tab.c"
+    break;
+
+  case 62: /* sethiinstruction: SETHI '[' P_REGISTER ']' PRED_REG_TF IMMEDIATE ',' REGISTER  */
+#line 320 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveSethiInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-5].value), (yyvsp[-3].value));
+	}
+#line 1911 "sparc.tab.c"
+    break;
+
+  case 63: /* sethiinstruction: SETHI '[' P_REGISTER ']' PRED_REG_TF HI '(' LABEL ')' ',' REGISTER  */
+#line 328 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveSethiLabelInstr(instr_no, SETHI, (yyvsp[0].value), (yyvsp[-3].string));
+		assembler->addPReg(instr_no, (yyvsp[-8].value), (yyvsp[-6].value));
+	}
+#line 1923 "sparc.tab.c"
+    break;
+
+  case 64: /* nopinstruction: NOP  */
+#line 337 "yy/sparc.y"
+                    { assembler->saveSethiInstr(instr_no, SETHI, G_REGISTER + 0, 0); }
+#line 1929 "sparc.tab.c"
+    break;
+
+  case 65: /* logicalinstructions: LOGIC REGISTER ',' REGISTER ',' REGISTER  */
+#line 340 "yy/sparc.y"
+                                                              { assembler->saveRegRegInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 1935 "sparc.tab.c"
+    break;
+
+  case 66: /* logicalinstructions: LOGIC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 341 "yy/sparc.y"
+                                                    { assembler->saveRegImmInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 1941 "sparc.tab.c"
+    break;
+
+  case 67: /* logicalinstructions: LOGIC REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 342 "yy/sparc.y"
+                                                            { assembler->saveRegLabelInstr(instr_no, (yyvsp[-8].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string)); }
+#line 1947 "sparc.tab.c"
+    break;
+
+  case 68: /* logicalinstructions: LOGIC ICC REGISTER ',' REGISTER ',' REGISTER  */
+#line 344 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1959 "sparc.tab.c"
+    break;
+
+  case 69: /* logicalinstructions: LOGIC ICC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 352 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 1971 "sparc.tab.c"
+    break;
+
+  case 70: /* logicalinstructions: LOGIC ICC REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 360 "yy/sparc.y"
+        { 
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addICC(instr_no, (yyvsp[-8].value));
+	}
+#line 1983 "sparc.tab.c"
+    break;
+
+  case 71: /* logicalinstructions: LOGIC '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' REGISTER ',' REGISTER  */
+#line 368 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 1995 "sparc.tab.c"
+    break;
+
+  case 72: /* logicalinstructions: LOGIC '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 376 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2007 "sparc.tab.c"
+    break;
+
+  case 73: /* logicalinstructions: LOGIC '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 384 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-12].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addPReg(instr_no, (yyvsp[-10].value), (yyvsp[-8].value));
+	}
+#line 2019 "sparc.tab.c"
+    break;
+
+  case 74: /* shiftinstructions: SHIFT REGISTER ',' REGISTER ',' REGISTER  */
+#line 393 "yy/sparc.y"
+                                                            { assembler->saveRegRegInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2025 "sparc.tab.c"
+    break;
+
+  case 75: /* shiftinstructions: SHIFT REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 394 "yy/sparc.y"
+                                                    { assembler->saveRegImmInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2031 "sparc.tab.c"
+    break;
+
+  case 76: /* shiftinstructions: SHIFT REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 395 "yy/sparc.y"
+                                                            { assembler->saveRegLabelInstr(instr_no, (yyvsp[-8].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string)); }
+#line 2037 "sparc.tab.c"
+    break;
+
+  case 77: /* shiftinstructions: SHIFT ICC REGISTER ',' REGISTER ',' REGISTER  */
+#line 397 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2049 "sparc.tab.c"
+    break;
+
+  case 78: /* shiftinstructions: SHIFT ICC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 405 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2061 "sparc.tab.c"
+    break;
+
+  case 79: /* shiftinstructions: SHIFT ICC REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 413 "yy/sparc.y"
+        { 
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addICC(instr_no, (yyvsp[-8].value));
+	}
+#line 2073 "sparc.tab.c"
+    break;
+
+  case 80: /* shiftinstructions: SHIFT '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' REGISTER ',' REGISTER  */
+#line 421 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2085 "sparc.tab.c"
+    break;
+
+  case 81: /* shiftinstructions: SHIFT '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 429 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2097 "sparc.tab.c"
+    break;
+
+  case 82: /* shiftinstructions: SHIFT '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 437 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-12].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addPReg(instr_no, (yyvsp[-10].value), (yyvsp[-8].value));
+	}
+#line 2109 "sparc.tab.c"
+    break;
+
+  case 83: /* arithmeticinstructions: ARITHM REGISTER ',' REGISTER ',' REGISTER  */
+#line 446 "yy/sparc.y"
+                                                                  { assembler->saveRegRegInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2115 "sparc.tab.c"
+    break;
+
+  case 84: /* arithmeticinstructions: ARITHM REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 447 "yy/sparc.y"
+                                                     { assembler->saveRegImmInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2121 "sparc.tab.c"
+    break;
+
+  case 85: /* arithmeticinstructions: ARITHM REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 448 "yy/sparc.y"
+                                                             { assembler->saveRegLabelInstr(instr_no, (yyvsp[-8].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string)); }
+#line 2127 "sparc.tab.c"
+    break;
+
+  case 86: /* arithmeticinstructions: ARITHM ICC REGISTER ',' REGISTER ',' REGISTER  */
+#line 450 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2139 "sparc.tab.c"
+    break;
+
+  case 87: /* arithmeticinstructions: ARITHM ICC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 458 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2151 "sparc.tab.c"
+    break;
+
+  case 88: /* arithmeticinstructions: ARITHM ICC REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 466 "yy/sparc.y"
+        { 
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addICC(instr_no, (yyvsp[-8].value));
+	}
+#line 2163 "sparc.tab.c"
+    break;
+
+  case 89: /* arithmeticinstructions: ARITHM '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' REGISTER ',' REGISTER  */
+#line 474 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2175 "sparc.tab.c"
+    break;
+
+  case 90: /* arithmeticinstructions: ARITHM '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 482 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2187 "sparc.tab.c"
+    break;
+
+  case 91: /* arithmeticinstructions: ARITHM '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 490 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-12].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addPReg(instr_no, (yyvsp[-10].value), (yyvsp[-8].value));
+	}
+#line 2199 "sparc.tab.c"
+    break;
+
+  case 92: /* saverestoreinstructions: SVREST REGISTER ',' REGISTER ',' REGISTER  */
+#line 499 "yy/sparc.y"
+                                                                   { assembler->saveRegRegInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2205 "sparc.tab.c"
+    break;
+
+  case 93: /* saverestoreinstructions: SVREST REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 500 "yy/sparc.y"
+                                                     { assembler->saveRegImmInstr(instr_no, (yyvsp[-5].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2211 "sparc.tab.c"
+    break;
+
+  case 94: /* saverestoreinstructions: SVREST REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 501 "yy/sparc.y"
+                                                             { assembler->saveRegLabelInstr(instr_no, (yyvsp[-8].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string)); }
+#line 2217 "sparc.tab.c"
+    break;
+
+  case 95: /* saverestoreinstructions: SVREST ICC REGISTER ',' REGISTER ',' REGISTER  */
+#line 503 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2229 "sparc.tab.c"
+    break;
+
+  case 96: /* saverestoreinstructions: SVREST ICC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 511 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-6].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addICC(instr_no, (yyvsp[-5].value));
+	}
+#line 2241 "sparc.tab.c"
+    break;
+
+  case 97: /* saverestoreinstructions: SVREST ICC REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 519 "yy/sparc.y"
+        { 
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addICC(instr_no, (yyvsp[-8].value));
+	}
+#line 2253 "sparc.tab.c"
+    break;
+
+  case 98: /* saverestoreinstructions: SVREST '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' REGISTER ',' REGISTER  */
+#line 527 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegRegInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2265 "sparc.tab.c"
+    break;
+
+  case 99: /* saverestoreinstructions: SVREST '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 535 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegImmInstr(instr_no, (yyvsp[-9].value), (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-7].value), (yyvsp[-5].value));
+	}
+#line 2277 "sparc.tab.c"
+    break;
+
+  case 100: /* saverestoreinstructions: SVREST '[' P_REGISTER ']' PRED_REG_TF REGISTER ',' LOW '(' LABEL ')' ',' REGISTER  */
+#line 543 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRegLabelInstr(instr_no, (yyvsp[-12].value), (yyvsp[0].value), (yyvsp[-7].value), (yyvsp[-3].string));
+		assembler->addPReg(instr_no, (yyvsp[-10].value), (yyvsp[-8].value));
+	}
+#line 2289 "sparc.tab.c"
+    break;
+
+  case 101: /* branchinstructions: BRANCH LABEL  */
+#line 552 "yy/sparc.y"
+                                 { assembler->saveBranchInstr(instr_no, BRANCH, (yyvsp[-1].value), (yyvsp[0].string)); }
+#line 2295 "sparc.tab.c"
+    break;
+
+  case 102: /* callinstruction: CALL LABEL  */
+#line 555 "yy/sparc.y"
+                            { assembler->saveCallInstr(instr_no, CALL, (yyvsp[0].string)); }
+#line 2301 "sparc.tab.c"
+    break;
+
+  case 103: /* jumplinkinstruction: JUMPL addressdefinition ',' REGISTER  */
+#line 558 "yy/sparc.y"
+                                                          { assembler->saveAddrInstr(instr_no, JUMPL, (yyvsp[0].value), (yyvsp[-2].address)); }
+#line 2307 "sparc.tab.c"
+    break;
+
+  case 104: /* jumplinkinstruction: JMP addressdefinition  */
+#line 559 "yy/sparc.y"
+                                { assembler->saveAddrInstr(instr_no, JUMPL, G_REGISTER + 0, (yyvsp[0].address)); }
+#line 2313 "sparc.tab.c"
+    break;
+
+  case 105: /* jumplinkinstruction: JUMPL ICC addressdefinition ',' REGISTER  */
+#line 561 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, JUMPL, (yyvsp[0].value), (yyvsp[-2].address));
+		assembler->addICC(instr_no, (yyvsp[-3].value));
+	}
+#line 2325 "sparc.tab.c"
+    break;
+
+  case 106: /* jumplinkinstruction: JMP ICC addressdefinition  */
+#line 569 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveAddrInstr(instr_no, JUMPL, G_REGISTER + 0, (yyvsp[0].address));
+		assembler->addICC(instr_no, (yyvsp[-1].value));
+	}
+#line 2337 "sparc.tab.c"
+    break;
+
+  case 107: /* jumplinkinstruction: JUMPL '[' P_REGISTER ']' PRED_REG_TF addressdefinition ',' REGISTER  */
+#line 577 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, JUMPL, (yyvsp[0].value), (yyvsp[-2].address));
+		assembler->addPReg(instr_no, (yyvsp[-5].value), (yyvsp[-3].value));
+	}
+#line 2349 "sparc.tab.c"
+    break;
+
+  case 108: /* jumplinkinstruction: JMP '[' P_REGISTER ']' PRED_REG_TF addressdefinition  */
+#line 585 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveAddrInstr(instr_no, JUMPL, G_REGISTER + 0, (yyvsp[0].address));
+		assembler->addPReg(instr_no, (yyvsp[-3].value), (yyvsp[-1].value));
+	}
+#line 2361 "sparc.tab.c"
+    break;
+
+  case 109: /* readstatusregisterinstruction: RD Y_REGISTER ',' REGISTER  */
+#line 594 "yy/sparc.y"
+                                                          { assembler->saveRdInstr(instr_no, RD, (yyvsp[0].value), (yyvsp[-2].value)); }
+#line 2367 "sparc.tab.c"
+    break;
+
+  case 110: /* readstatusregisterinstruction: RD ICC Y_REGISTER ',' REGISTER  */
+#line 596 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsCC())) {
+			yyerror("Target does not support predicate instructions on condition codes!");
+		}
+		assembler->saveRdInstr(instr_no, RD, (yyvsp[0].value), (yyvsp[-3].value));
+		assembler->addICC(instr_no, (yyvsp[-3].value));
+	}
+#line 2379 "sparc.tab.c"
+    break;
+
+  case 111: /* readstatusregisterinstruction: RD '[' P_REGISTER ']' PRED_REG_TF Y_REGISTER ',' REGISTER  */
+#line 604 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicate instructions on predicate registers!");
+		}
+		assembler->saveRdInstr(instr_no, RD, (yyvsp[0].value), (yyvsp[-2].value));
+		assembler->addPReg(instr_no, (yyvsp[-5].value), (yyvsp[-3].value));
+	}
+#line 2391 "sparc.tab.c"
+    break;
+
+  case 112: /* writestatusregisterinstruction: WR REGISTER ',' REGISTER ',' Y_REGISTER  */
+#line 613 "yy/sparc.y"
+                                                                        { assembler->saveRegRegInstr(instr_no, WR, (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2397 "sparc.tab.c"
+    break;
+
+  case 113: /* writestatusregisterinstruction: WR REGISTER ',' IMMEDIATE ',' Y_REGISTER  */
+#line 614 "yy/sparc.y"
+                                                   { assembler->saveRegImmInstr(instr_no, WR, (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value)); }
+#line 2403 "sparc.tab.c"
+    break;
+
+  case 114: /* selccinstructions: SEL ICC IMMEDIATE ',' IMMEDIATE ',' REGISTER  */
+#line 617 "yy/sparc.y"
+                                                                { assembler->saveSelCCImmImmInstr(instr_no, SEL, (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value), (yyvsp[-5].value)); }
+#line 2409 "sparc.tab.c"
+    break;
+
+  case 115: /* selccinstructions: SEL ICC REGISTER ',' IMMEDIATE ',' REGISTER  */
+#line 618 "yy/sparc.y"
+                                                      { assembler->saveSelCCRegImmInstr(instr_no, SEL, (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value), (yyvsp[-5].value)); }
+#line 2415 "sparc.tab.c"
+    break;
+
+  case 116: /* selccinstructions: SEL ICC REGISTER ',' REGISTER ',' REGISTER  */
+#line 619 "yy/sparc.y"
+                                                     { assembler->saveSelCCRegRegInstr(instr_no, SEL, (yyvsp[0].value), (yyvsp[-4].value), (yyvsp[-2].value), (yyvsp[-5].value)); }
+#line 2421 "sparc.tab.c"
+    break;
+
+  case 117: /* movccinstructions: MOV ICC REGISTER ',' REGISTER  */
+#line 622 "yy/sparc.y"
+                                                 { assembler->saveMovCCInstr(instr_no, MOV, (yyvsp[0].value), (yyvsp[-2].value), (yyvsp[-3].value)); }
+#line 2427 "sparc.tab.c"
+    break;
+
+  case 118: /* hwloopinstructions: HWLOOP_INIT LABEL ',' LOOPS_REGISTER  */
+#line 625 "yy/sparc.y"
+                                                         { assembler->saveHWLoopInitInstr(instr_no, HWLOOP_INIT, LOOPS_REGISTER, (yyvsp[-2].string)); }
+#line 2433 "sparc.tab.c"
+    break;
+
+  case 119: /* hwloopinstructions: HWLOOP_INIT LABEL ',' LOOPE_REGISTER  */
+#line 626 "yy/sparc.y"
+                                               { assembler->saveHWLoopInitInstr(instr_no, HWLOOP_INIT, LOOPE_REGISTER, (yyvsp[-2].string)); }
+#line 2439 "sparc.tab.c"
+    break;
+
+  case 120: /* hwloopinstructions: HWLOOP_INIT REGISTER ',' LOOPB_REGISTER  */
+#line 627 "yy/sparc.y"
+                                                  { assembler->saveHWLoopBoundRegInstr(instr_no, HWLOOP_INIT, LOOPB_REGISTER, (yyvsp[-2].value)); }
+#line 2445 "sparc.tab.c"
+    break;
+
+  case 121: /* hwloopinstructions: HWLOOP_INIT IMMEDIATE ',' LOOPB_REGISTER  */
+#line 628 "yy/sparc.y"
+                                                    { assembler->saveHWLoopBoundImmInstr(instr_no, HWLOOP_INIT, LOOPB_REGISTER, (yyvsp[-2].value)); }
+#line 2451 "sparc.tab.c"
+    break;
+
+  case 122: /* hwloopinstructions: HWLOOP_START  */
+#line 629 "yy/sparc.y"
+                       { assembler->saveHWLoopStartInstr(instr_no, HWLOOP_START); }
+#line 2457 "sparc.tab.c"
+    break;
+
+  case 123: /* predicatedblocksinstructions: PREDBEGIN ICC  */
+#line 633 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredBlocksCC())) {
+			yyerror("Target does not support predicated blocks on condition codes!");
+		}
+		assembler->savePredBeginInstr(instr_no, PREDBEGIN);
+		assembler->addICC(instr_no, (yyvsp[0].value));
+	}
+#line 2469 "sparc.tab.c"
+    break;
+
+  case 124: /* predicatedblocksinstructions: PREDBEGIN '[' P_REGISTER ']' PRED_REG_TF  */
+#line 641 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredBlocksReg())) {
+			yyerror("Target does not support predicated blocks on predicate registers!");
+		}
+		assembler->savePredBeginInstr(instr_no, PREDBEGIN);
+		assembler->addPReg(instr_no, (yyvsp[-2].value), (yyvsp[0].value));
+	}
+#line 2481 "sparc.tab.c"
+    break;
+
+  case 125: /* predicatedblocksinstructions: PREDEND  */
+#line 648 "yy/sparc.y"
+                  { assembler->savePredendInstr(instr_no, PREDEND); }
+#line 2487 "sparc.tab.c"
+    break;
+
+  case 126: /* predicatedreginstructions: PREDSET P_REGISTER  */
+#line 651 "yy/sparc.y"
+                                              { assembler->savePredRegInstr(instr_no, PREDSET, (yyvsp[0].value)); }
+#line 2493 "sparc.tab.c"
+    break;
+
+  case 127: /* predicatedreginstructions: PREDSET ICC P_REGISTER  */
+#line 653 "yy/sparc.y"
+        {
+		assembler->savePredRegInstr(instr_no, PREDSET, (yyvsp[0].value));
+		assembler->addICC(instr_no, (yyvsp[-1].value));
+	}
+#line 2502 "sparc.tab.c"
+    break;
+
+  case 128: /* predicatedreginstructions: PREDSET '[' P_REGISTER ']' PRED_REG_TF ICC P_REGISTER  */
+#line 658 "yy/sparc.y"
+        {
+		if (!(assembler->hasPredInstrsReg())) {
+			yyerror("Target does not support predicated instructions on predicate registers!");
+		}
+		assembler->savePredRegInstr(instr_no, PREDSET, (yyvsp[0].value));
+		assembler->addICC(instr_no, (yyvsp[-1].value));
+		assembler->addPReg(instr_no, (yyvsp[-4].value), (yyvsp[-2].value));
+	}
+#line 2515 "sparc.tab.c"
+    break;
+
+  case 129: /* predicatedreginstructions: PREDCLEAR P_REGISTER  */
+#line 666 "yy/sparc.y"
+                               { assembler->savePredRegInstr(instr_no, PREDCLEAR, (yyvsp[0].value)); }
+#line 2521 "sparc.tab.c"
+    break;
+
+  case 130: /* addressdefinition: REGISTER  */
+#line 669 "yy/sparc.y"
+                            { (yyval.address) = assembler->saveAddress((yyvsp[0].value), OPERAND_TYPE_REGISTER, (void*) 0, OPERAND_TYPE_SIMM13); }
+#line 2527 "sparc.tab.c"
+    break;
+
+  case 131: /* addressdefinition: REGISTER '+' REGISTER  */
+#line 670 "yy/sparc.y"
+                                { (yyval.address) = assembler->saveAddress((yyvsp[-2].value), OPERAND_TYPE_REGISTER, (void*) (yyvsp[0].value), OPERAND_TYPE_REGISTER); }
+#line 2533 "sparc.tab.c"
+    break;
+
+  case 132: /* addressdefinition: REGISTER '+' IMMEDIATE  */
+#line 671 "yy/sparc.y"
+                                 { (yyval.address) = assembler->saveAddress((yyvsp[-2].value), OPERAND_TYPE_REGISTER, (void*) (yyvsp[0].value), OPERAND_TYPE_SIMM13); }
+#line 2539 "sparc.tab.c"
+    break;
+
+  case 133: /* addressdefinition: REGISTER '+' LOW '(' LABEL ')'  */
+#line 672 "yy/sparc.y"
+                                        { (yyval.address) = assembler->saveAddress((yyvsp[-5].value), OPERAND_TYPE_REGISTER, (void*) (yyvsp[-1].string), OPERAND_TYPE_LOW_LABEL); }
+#line 2545 "sparc.tab.c"
+    break;
+
+
+#line 2549 "sparc.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 675 "yy/sparc.y"
+
+